@@ -0,0 +1,117 @@
+#include "F3DFrameWriter.h"
+
+#include "log.h"
+
+#include <algorithm>
+
+namespace fs = std::filesystem;
+
+//----------------------------------------------------------------------------
+F3DFrameWriter::F3DFrameWriter(size_t nbWorkers, size_t maxPendingFrames)
+{
+  if (nbWorkers == 0)
+  {
+    // Keep a hardware thread for rendering
+    const size_t nbThreads = std::thread::hardware_concurrency();
+    nbWorkers = std::max<size_t>(1, nbThreads > 1 ? nbThreads - 1 : 1);
+  }
+  this->MaxPendingFrames = maxPendingFrames > 0 ? maxPendingFrames : 2 * nbWorkers;
+
+  this->Workers.reserve(nbWorkers);
+  for (size_t i = 0; i < nbWorkers; i++)
+  {
+    this->Workers.emplace_back(&F3DFrameWriter::Work, this);
+  }
+}
+
+//----------------------------------------------------------------------------
+F3DFrameWriter::~F3DFrameWriter()
+{
+  this->Finish();
+}
+
+//----------------------------------------------------------------------------
+bool F3DFrameWriter::Push(f3d::image&& frame, const fs::path& path)
+{
+  std::unique_lock lock(this->Mutex);
+  this->SpaceCondition.wait(lock,
+    [&]() { return this->Pending.size() < this->MaxPendingFrames || !this->Error.empty(); });
+
+  // Stop producing frames as soon as one could not be written
+  if (!this->Error.empty())
+  {
+    return false;
+  }
+
+  this->Pending.emplace_back(Frame{ std::move(frame), path });
+  this->PendingCondition.notify_one();
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool F3DFrameWriter::Finish()
+{
+  {
+    std::scoped_lock lock(this->Mutex);
+    if (this->Finished)
+    {
+      return this->Error.empty();
+    }
+    this->Finished = true;
+    this->Stopping = true;
+  }
+  this->PendingCondition.notify_all();
+
+  for (std::thread& worker : this->Workers)
+  {
+    worker.join();
+  }
+  this->Workers.clear();
+
+  // Errors are logged from the calling thread only
+  if (!this->Error.empty())
+  {
+    f3d::log::error("Could not write output: ", this->Error);
+    return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void F3DFrameWriter::Work()
+{
+  while (true)
+  {
+    Frame frame;
+    {
+      std::unique_lock lock(this->Mutex);
+      this->PendingCondition.wait(
+        lock, [&]() { return !this->Pending.empty() || this->Stopping || !this->Error.empty(); });
+      if (this->Pending.empty() || !this->Error.empty())
+      {
+        return;
+      }
+      frame = std::move(this->Pending.front());
+      this->Pending.pop_front();
+    }
+    this->SpaceCondition.notify_one();
+
+    try
+    {
+      frame.Image.save(frame.Path);
+    }
+    catch (const f3d::image::write_exception& ex)
+    {
+      {
+        std::scoped_lock lock(this->Mutex);
+        if (this->Error.empty())
+        {
+          this->Error = ex.what();
+        }
+      }
+      this->PendingCondition.notify_all();
+      this->SpaceCondition.notify_all();
+      return;
+    }
+  }
+}
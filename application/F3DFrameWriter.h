@@ -0,0 +1,78 @@
+/**
+ * @class   F3DFrameWriter
+ * @brief   A class used to encode and write output frames in worker threads
+ *
+ * Frames are encoded and written by a pool of worker threads so that the next frame
+ * can be rendered while the previous ones are being saved.
+ * The number of frames waiting to be written is bounded: pushing a frame blocks
+ * until a worker is available to take it, keeping the memory usage under control.
+ * File names are provided by the caller, so the output does not depend on
+ * the order in which workers finish.
+ */
+
+#ifndef F3DFrameWriter_h
+#define F3DFrameWriter_h
+
+#include "image.h"
+
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class F3DFrameWriter
+{
+public:
+  /**
+   * Create a writer with the provided number of worker threads,
+   * 0 means one per available hardware thread except the one used for rendering.
+   * At most maxPendingFrames frames are kept in memory waiting for a worker,
+   * 0 means twice the number of workers.
+   */
+  explicit F3DFrameWriter(size_t nbWorkers = 0, size_t maxPendingFrames = 0);
+
+  /**
+   * Wait for all the pushed frames to be written
+   */
+  ~F3DFrameWriter();
+
+  /**
+   * Queue a frame to be written to the provided path.
+   * Block while too many frames are waiting to be written.
+   * Return false if writing a previous frame failed, in which case the frame is not queued.
+   */
+  bool Push(f3d::image&& frame, const std::filesystem::path& path);
+
+  /**
+   * Wait for all the pushed frames to be written and stop the workers.
+   * Return false and log an error if any frame could not be written.
+   */
+  bool Finish();
+
+  F3DFrameWriter(const F3DFrameWriter&) = delete;
+  F3DFrameWriter& operator=(const F3DFrameWriter&) = delete;
+
+private:
+  struct Frame
+  {
+    f3d::image Image;
+    std::filesystem::path Path;
+  };
+
+  void Work();
+
+  size_t MaxPendingFrames;
+  std::vector<std::thread> Workers;
+  std::deque<Frame> Pending;
+  std::mutex Mutex;
+  std::condition_variable PendingCondition;
+  std::condition_variable SpaceCondition;
+  bool Stopping = false;
+  bool Finished = false;
+  std::string Error;
+};
+
+#endif
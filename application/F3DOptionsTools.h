@@ -30,6 +30,7 @@ static inline const OptionsDict DefaultAppOptions = {
   { "input", "" },
   { "output", "" },
   { "list-bindings", "false" },
+  { "precompute-hdri", "false" },
   { "no-background", "false" },
   { "config", "" },
   { "no-config", "false" },
@@ -110,6 +111,7 @@ static inline const std::map<std::string_view, std::string_view> LibOptionsNames
   { "font-scale", "ui.scale" },
   { "force-reader", "scene.force_reader" },
   { "fps", "ui.fps" },
+  { "frame-stats", "ui.frame_stats" },
   { "grid", "render.grid.enable" },
   { "grid-absolute", "render.grid.absolute" },
   { "grid-color", "render.grid.color" },
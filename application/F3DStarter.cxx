@@ -4,6 +4,7 @@
 #include "F3DConfig.h"
 #include "F3DConfigFileTools.h"
 #include "F3DException.h"
+#include "F3DFrameWriter.h"
 #include "F3DIcon.h"
 #include "F3DNSDelegate.h"
 #include "F3DOptionsTools.h"
@@ -52,6 +53,7 @@
 #include <iostream>
 #include <mutex>
 #include <numeric>
+#include <optional>
 #include <regex>
 #include <set>
 
@@ -97,6 +99,7 @@ public:
   {
     std::string Output;
     bool BindingsList;
+    bool PrecomputeHDRI;
     bool NoBackground;
     bool NoRender;
     std::string RenderingBackend;
@@ -292,10 +295,12 @@ public:
 
   /**
    * Render image and save to file or stdout.
-   * Returns true on success, false on failure (error already logged).
+   * When a frame writer is provided, the image is queued to be saved by its workers instead.
+   * Returns true on success, false on failure (error already logged,
+   * or logged when finishing the frame writer).
    */
   bool renderAndSave(f3d::window& window, const f3d::utils::string_template& outputTemplate,
-    bool toStdout, std::optional<int> frame = std::nullopt)
+    bool toStdout, std::optional<int> frame = std::nullopt, F3DFrameWriter* writer = nullptr)
   {
     f3d::image img = window.renderToImage(AppOptions.NoBackground);
     addOutputImageMetadata(img);
@@ -309,6 +314,16 @@ public:
     else
     {
       const fs::path outputPath = finalizeFilenameTemplate(outputTemplate, frame);
+      if (writer)
+      {
+        if (!writer->Push(std::move(img), outputPath))
+        {
+          return false;
+        }
+        f3d::log::debug("Output image queued to be saved to ", outputPath);
+        return true;
+      }
+
       try
       {
         img.save(outputPath);
@@ -780,6 +795,7 @@ public:
     // Update typed app options from app options
     this->ParseOption(appOptions, "output", this->AppOptions.Output);
     this->ParseOption(appOptions, "list-bindings", this->AppOptions.BindingsList);
+    this->ParseOption(appOptions, "precompute-hdri", this->AppOptions.PrecomputeHDRI);
     this->ParseOption(appOptions, "no-background", this->AppOptions.NoBackground);
     this->ParseOption(appOptions, "no-render", this->AppOptions.NoRender);
     this->ParseOption(appOptions, "rendering-backend", this->AppOptions.RenderingBackend);
@@ -1168,7 +1184,8 @@ int F3DStarter::Start(int argc, char** argv)
   else
   {
     bool offscreen = !this->Internals->AppOptions.Reference.empty() ||
-      !this->Internals->AppOptions.Output.empty() || this->Internals->AppOptions.BindingsList;
+      !this->Internals->AppOptions.Output.empty() || this->Internals->AppOptions.BindingsList ||
+      this->Internals->AppOptions.PrecomputeHDRI;
 
     try
     {
@@ -1260,6 +1277,16 @@ int F3DStarter::Start(int argc, char** argv)
       throw F3DExNoProcess("bindings list requested");
     }
 
+    // Precompute the HDRI caches and exits if needed
+    if (this->Internals->AppOptions.PrecomputeHDRI)
+    {
+      // Rendering once with image based lighting creates the caches of the current HDRI
+      this->Internals->Engine->getOptions().render.hdri.ambient = true;
+      window.render();
+      f3d::log::info("HDRI caches precomputed");
+      throw F3DExNoProcess("HDRI precomputation requested");
+    }
+
     // Play recording if any
     fs::path interactionTestPlayFile =
       f3d::utils::collapsePath(this->Internals->AppOptions.InteractionTestPlayFile);
@@ -1368,7 +1395,7 @@ int F3DStarter::Start(int argc, char** argv)
       f3d::image img = window.renderToImage(this->Internals->AppOptions.NoBackground);
       f3d::image ref(reference);
       f3d::image diff;
-      double error = img.compare(ref);
+      double error = img.compare(ref, &diff);
       const double& threshold = this->Internals->AppOptions.RefThreshold;
       if (error > threshold)
       {
@@ -1382,9 +1409,17 @@ int F3DStarter::Start(int argc, char** argv)
           f3d::log::error("Current rendering difference with reference image: ", error,
             " is higher than the threshold of ", threshold, ".\n");
 
+          // The heatmap of the differences is saved next to the output, eg. `output.diff.png`
+          const fs::path diffOutput = fs::path(output).replace_extension(
+            fs::path(".diff").concat(output.extension().string()));
           try
           {
             img.save(output);
+            if (diff.getWidth() > 0)
+            {
+              diff.save(diffOutput);
+              f3d::log::info("Difference heatmap saved to ", diffOutput);
+            }
           }
           catch (const f3d::image::write_exception& ex)
           {
@@ -1437,17 +1472,36 @@ int F3DStarter::Start(int argc, char** argv)
         f3d::log::info(
           "Saving ", count, " animation frame(s) from time ", startTime, " to ", endTime);
 
+        // Frames are saved by worker threads while the next ones are rendered,
+        // except on stdout where they are written one after the other
+        std::optional<F3DFrameWriter> frameWriter;
+        if (!renderToStdout)
+        {
+          frameWriter.emplace();
+        }
+        F3DFrameWriter* writer = frameWriter ? &frameWriter.value() : nullptr;
+
         for (int frame = 0; frame < count; ++frame)
         {
           const double currentTime = startTime + frame * timeStep;
           animScene.loadAnimationTime(currentTime);
 
-          if (!this->Internals->renderAndSave(window, outputTemplate, renderToStdout, frame))
+          if (!this->Internals->renderAndSave(
+                window, outputTemplate, renderToStdout, frame, writer))
           {
+            if (writer)
+            {
+              writer->Finish();
+            }
             return EXIT_FAILURE;
           }
         }
 
+        if (writer && !writer->Finish())
+        {
+          return EXIT_FAILURE;
+        }
+
         f3d::log::info("Saved ", count, " animation frame(s)");
       }
       else
@@ -1569,23 +1623,19 @@ void F3DStarter::LoadFileGroupInternal(
   // Detect interactively changed options and store them into the dynamic options dict
   // options names are shared between options instance
   F3DOptionsTools::OptionsDict dynamicOptionsDict;
-  std::vector<std::string> optionNames = dynamicOptions.getAllNames();
-  for (const auto& name : optionNames)
+  for (const auto& name : dynamicOptions.getChangedNames(this->Internals->LibOptions))
   {
-    if (!dynamicOptions.isSame(this->Internals->LibOptions, name))
+    if (!dynamicOptions.hasValue(name))
     {
-      if (!dynamicOptions.hasValue(name))
-      {
-        // If a dynamic option has been changed and does not have value, it means it was reset using
-        // the command line reset it using the dedicated syntax
-        dynamicOptionsDict["reset-" + name] = "";
-      }
-      else
-      {
-        // No need for a try/catch block here, this call cannot trigger
-        // an exception with current code path
-        dynamicOptionsDict[name] = dynamicOptions.getAsString(name);
-      }
+      // If a dynamic option has been changed and does not have value, it means it was reset using
+      // the command line reset it using the dedicated syntax
+      dynamicOptionsDict["reset-" + name] = "";
+    }
+    else
+    {
+      // No need for a try/catch block here, this call cannot trigger
+      // an exception with current code path
+      dynamicOptionsDict[name] = dynamicOptions.getAsString(name);
     }
   }
 
@@ -1916,6 +1966,7 @@ void F3DStarter::SaveScreenshot(const std::string& filenameTemplate, bool minima
     options.ui.console = false;
     options.ui.filename = false;
     options.ui.fps = false;
+    options.ui.frame_stats = false;
     options.ui.metadata = false;
     options.ui.animation_progress = "none";
     options.ui.axis = false;
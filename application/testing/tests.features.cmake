@@ -200,6 +200,10 @@ f3d_test(NAME TestSceneHierarchyNonGLTF DATA cow.vtp ARGS --scene-hierarchy UI)
 f3d_test(NAME TestSceneHierarchyMultipleFiles DATA cow.vtp suzanne.obj ARGS --scene-hierarchy --multi-file-mode=all --opacity=0.3 UI)
 f3d_test(NAME TestSceneHierarchyMultiBlock DATA mb.vtm ARGS --scene-hierarchy UI)
 
+# Large scene hierarchies, collapsed on load when the blocks of each group have the same name
+f3d_test(NAME TestSceneHierarchyLargeCollapsed DATA large_hierarchy/large_hierarchy_collapsed.vtm ARGS --scene-hierarchy UI)
+f3d_test(NAME TestSceneHierarchyLargeExpanded DATA large_hierarchy/large_hierarchy_expanded.vtm ARGS --scene-hierarchy UI)
+
 ## Special files handling
 f3d_test(NAME TestRemoveEmptyFileGroups DATA mb/mb_3_0.vtt mb/mb_0_0.vtu ARGS -n --remove-empty-file-groups UI)
 f3d_test(NAME TestMultiFileMetaData DATA mb/recursive ARGS -m --multi-file-mode=all UI)
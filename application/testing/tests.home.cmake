@@ -40,6 +40,12 @@ if(NOT WIN32)
 
     f3d_test(NAME TestXDG_CACHE_HOMECoverage DATA suzanne.ply NO_RENDER NO_BASELINE ENV "XDG_CACHE_HOME=${CMAKE_BINARY_DIR}")
 
+    # Precompute the HDRI caches in an empty cache directory, then check a render reads them
+    set(_precompute_cache_dir "${CMAKE_BINARY_DIR}/Testing/Temporary/precompute_cache")
+    add_test(NAME f3d::TestPrecomputeHDRIClearCache COMMAND ${CMAKE_COMMAND} -E remove_directory "${_precompute_cache_dir}")
+    f3d_test(NAME TestPrecomputeHDRI ARGS --precompute-hdri --hdri-file=${F3D_SOURCE_DIR}/testing/data/shanghai_bund_1k.hdr REGEXP "HDRI caches precomputed" NO_BASELINE LONG_TIMEOUT ENV "XDG_CACHE_HOME=${_precompute_cache_dir}" DEPENDS TestPrecomputeHDRIClearCache)
+    f3d_test(NAME TestPrecomputeHDRIUsed DATA suzanne.ply HDRI shanghai_bund_1k.hdr ARGS --verbose=debug BASELINE_PATH ${F3D_SOURCE_DIR}/testing/baselines/TestHDRI.png REGEXP "Using HDRI LUT cache .*/f3d/lut\\.bin.*Using HDRI image based lighting cache .*/f3d/[^/]+/ibl\\.bin" REGEXP_FAIL "Current rendering difference with reference image" ENV "XDG_CACHE_HOME=${_precompute_cache_dir}" DEPENDS TestPrecomputeHDRI)
+
     # Setting XDG_CACHE_HOME is needed for cache to work when HOME is not set
     f3d_test(NAME TestNoHOMEScreenshot DATA suzanne.ply ARGS --screenshot-filename=TestNoHOMEScreenshot.png --interaction-test-play=${F3D_SOURCE_DIR}/testing/recordings/TestScreenshot.log  REGEXP "saving screenshot to ${CMAKE_BINARY_DIR}/application/testing/TestNoHOMEScreenshot.png" NO_BASELINE ENV "XDG_CACHE_HOME=${CMAKE_BINARY_DIR};HOME=")
     f3d_test(NAME TestNoHOMEConfig DATA suzanne.ply CONFIG config_build REGEXP "Using config directory ${CMAKE_BINARY_DIR}/share/f3d/configs/config_build.d" NO_RENDER NO_BASELINE ENV "XDG_CACHE_HOME=${CMAKE_BINARY_DIR};HOME=")
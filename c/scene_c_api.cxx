@@ -2,6 +2,7 @@
 #include "scene.h"
 #include "types.h"
 
+#include <cstring>
 #include <filesystem>
 #include <log.h>
 #include <vector>
@@ -197,6 +198,113 @@ int f3d_scene_add_multiple(f3d_scene_t* scene, const char** file_paths, size_t c
   return 1;
 }
 
+//----------------------------------------------------------------------------
+f3d_scene_load_handle_t* f3d_scene_add_async(
+  f3d_scene_t* scene, const char** file_paths, size_t count)
+{
+  if (!scene || !file_paths)
+  {
+    return nullptr;
+  }
+
+  f3d::scene* cpp_scene = reinterpret_cast<f3d::scene*>(scene);
+  std::vector<std::filesystem::path> paths;
+  paths.reserve(count);
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (file_paths[i])
+    {
+      paths.emplace_back(file_paths[i]);
+    }
+  }
+
+  try
+  {
+    f3d::scene::load_handle* handle = new f3d::scene::load_handle(cpp_scene->addAsync(paths));
+    return reinterpret_cast<f3d_scene_load_handle_t*>(handle);
+  }
+  catch (const f3d::scene::load_failure_exception& e)
+  {
+    f3d::log::error("Failed to add files asynchronously to scene: ", e.what());
+    return nullptr;
+  }
+}
+
+//----------------------------------------------------------------------------
+f3d_scene_load_status_t f3d_scene_load_handle_get_status(const f3d_scene_load_handle_t* handle)
+{
+  if (!handle)
+  {
+    return F3D_SCENE_LOAD_STATUS_FAILED;
+  }
+
+  const f3d::scene::load_handle* cpp_handle =
+    reinterpret_cast<const f3d::scene::load_handle*>(handle);
+  return static_cast<f3d_scene_load_status_t>(cpp_handle->getStatus());
+}
+
+//----------------------------------------------------------------------------
+f3d_scene_load_status_t f3d_scene_load_handle_wait(const f3d_scene_load_handle_t* handle)
+{
+  if (!handle)
+  {
+    return F3D_SCENE_LOAD_STATUS_FAILED;
+  }
+
+  const f3d::scene::load_handle* cpp_handle =
+    reinterpret_cast<const f3d::scene::load_handle*>(handle);
+  return static_cast<f3d_scene_load_status_t>(cpp_handle->wait());
+}
+
+//----------------------------------------------------------------------------
+double f3d_scene_load_handle_get_progress(const f3d_scene_load_handle_t* handle)
+{
+  if (!handle)
+  {
+    return 0.0;
+  }
+
+  const f3d::scene::load_handle* cpp_handle =
+    reinterpret_cast<const f3d::scene::load_handle*>(handle);
+  return cpp_handle->getProgress();
+}
+
+//----------------------------------------------------------------------------
+void f3d_scene_load_handle_cancel(const f3d_scene_load_handle_t* handle)
+{
+  if (!handle)
+  {
+    return;
+  }
+
+  const f3d::scene::load_handle* cpp_handle =
+    reinterpret_cast<const f3d::scene::load_handle*>(handle);
+  cpp_handle->cancel();
+}
+
+//----------------------------------------------------------------------------
+char* f3d_scene_load_handle_get_error(const f3d_scene_load_handle_t* handle)
+{
+  if (!handle)
+  {
+    return nullptr;
+  }
+
+  const f3d::scene::load_handle* cpp_handle =
+    reinterpret_cast<const f3d::scene::load_handle*>(handle);
+  std::string error = cpp_handle->getError();
+  char* result = new char[error.size() + 1];
+  std::memcpy(result, error.c_str(), error.size() + 1);
+  return result;
+}
+
+//----------------------------------------------------------------------------
+void f3d_scene_load_handle_delete(f3d_scene_load_handle_t* handle)
+{
+  delete reinterpret_cast<f3d::scene::load_handle*>(handle);
+}
+
 //----------------------------------------------------------------------------
 int f3d_scene_add_mesh(f3d_scene_t* scene, const f3d_mesh_t* mesh)
 {
@@ -16,6 +16,22 @@ extern "C"
    */
   typedef struct f3d_scene_t f3d_scene_t;
 
+  /**
+   * @brief Opaque handle to an asynchronous scene load.
+   */
+  typedef struct f3d_scene_load_handle_t f3d_scene_load_handle_t;
+
+  /**
+   * @brief Status of an asynchronous scene load.
+   */
+  typedef enum f3d_scene_load_status_t
+  {
+    F3D_SCENE_LOAD_STATUS_LOADING = 0,
+    F3D_SCENE_LOAD_STATUS_LOADED = 1,
+    F3D_SCENE_LOAD_STATUS_FAILED = 2,
+    F3D_SCENE_LOAD_STATUS_CANCELED = 3
+  } f3d_scene_load_status_t;
+
   /**
    * @brief Add and load a file into the scene.
    *
@@ -35,6 +51,73 @@ extern "C"
    */
   F3D_EXPORT int f3d_scene_add_multiple(f3d_scene_t* scene, const char** file_paths, size_t count);
 
+  /**
+   * @brief Start loading multiple files into the scene asynchronously.
+   *
+   * Files are read in a background thread and added to the scene when the load is polled
+   * or waited for, or by the interactor event loop.
+   * The returned handle must be deleted with f3d_scene_load_handle_delete().
+   *
+   * @param scene Scene handle.
+   * @param file_paths Array of file paths.
+   * @param count Number of file paths in the array.
+   * @return Load handle, NULL on failure.
+   */
+  F3D_EXPORT f3d_scene_load_handle_t* f3d_scene_add_async(
+    f3d_scene_t* scene, const char** file_paths, size_t count);
+
+  /**
+   * @brief Get the status of an asynchronous load without blocking.
+   *
+   * @param handle Load handle.
+   * @return Status of the load.
+   */
+  F3D_EXPORT f3d_scene_load_status_t f3d_scene_load_handle_get_status(
+    const f3d_scene_load_handle_t* handle);
+
+  /**
+   * @brief Block until an asynchronous load is finished.
+   *
+   * @param handle Load handle.
+   * @return Final status of the load.
+   */
+  F3D_EXPORT f3d_scene_load_status_t f3d_scene_load_handle_wait(
+    const f3d_scene_load_handle_t* handle);
+
+  /**
+   * @brief Get the progress of an asynchronous load, between 0 and 1.
+   *
+   * @param handle Load handle.
+   * @return Progress of the load.
+   */
+  F3D_EXPORT double f3d_scene_load_handle_get_progress(const f3d_scene_load_handle_t* handle);
+
+  /**
+   * @brief Request the cancellation of an asynchronous load.
+   *
+   * @param handle Load handle.
+   */
+  F3D_EXPORT void f3d_scene_load_handle_cancel(const f3d_scene_load_handle_t* handle);
+
+  /**
+   * @brief Get the error message of a failed asynchronous load.
+   *
+   * The returned string is heap-allocated and must be freed with f3d_utils_string_free().
+   *
+   * @param handle Load handle.
+   * @return Error message, empty if there is no error.
+   */
+  F3D_EXPORT char* f3d_scene_load_handle_get_error(const f3d_scene_load_handle_t* handle);
+
+  /**
+   * @brief Delete a load handle.
+   *
+   * Deleting the handle does not cancel the load.
+   *
+   * @param handle Load handle.
+   */
+  F3D_EXPORT void f3d_scene_load_handle_delete(f3d_scene_load_handle_t* handle);
+
   /**
    * @brief Add and load a mesh into the scene.
    *
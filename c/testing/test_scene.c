@@ -38,6 +38,38 @@ int test_scene()
 
   f3d_scene_clear(scene);
 
+  // Test adding files asynchronously
+
+  f3d_scene_load_handle_t* handle = f3d_scene_add_async(scene, files, 2);
+  if (!handle)
+  {
+    puts("[ERROR] Failed to start an asynchronous load");
+    f3d_engine_delete(engine);
+    return 1;
+  }
+
+  f3d_scene_load_status_t status = f3d_scene_load_handle_get_status(handle);
+  (void)status;
+
+  if (f3d_scene_load_handle_wait(handle) != F3D_SCENE_LOAD_STATUS_LOADED)
+  {
+    puts("[ERROR] Asynchronous load did not succeed");
+    f3d_scene_load_handle_delete(handle);
+    f3d_engine_delete(engine);
+    return 1;
+  }
+
+  double progress = f3d_scene_load_handle_get_progress(handle);
+  (void)progress;
+
+  char* load_error = f3d_scene_load_handle_get_error(handle);
+  f3d_utils_string_free(load_error);
+
+  f3d_scene_load_handle_cancel(handle);
+  f3d_scene_load_handle_delete(handle);
+
+  f3d_scene_clear(scene);
+
   // Test adding a mesh
 
   float points[] = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.5f, 1.0f, 0.0f };
@@ -3,6 +3,7 @@
 #include <window_c_api.h>
 
 #include <stdio.h>
+#include <stdlib.h>
 
 int test_window()
 {
@@ -59,6 +60,46 @@ int test_window()
   f3d_point3_t display_out;
   f3d_window_get_display_from_world(window, test_world, display_out);
 
+  f3d_frame_stats_t* stats = f3d_window_get_frame_stats(window);
+  if (!stats)
+  {
+    puts("[ERROR] Failed to get frame stats");
+    f3d_engine_delete(engine);
+    return 1;
+  }
+  f3d_window_free_frame_stats(stats);
+  f3d_window_free_frame_stats(NULL);
+
+  f3d_pick_result_t* pick = f3d_window_pick(window, width / 2, height / 2);
+  if (!pick)
+  {
+    puts("[ERROR] Failed to pick");
+    f3d_engine_delete(engine);
+    return 1;
+  }
+  f3d_window_free_pick_result(pick);
+  f3d_window_free_pick_result(NULL);
+
+  unsigned char* frame = malloc((size_t)width * (size_t)height * 3);
+  f3d_window_begin_capture(window, 0, 2);
+  int acquired = 0;
+  for (int i = 0; i < 3; i++)
+  {
+    acquired += f3d_window_acquire_frame(window, frame);
+  }
+  while (f3d_window_flush_frame(window, frame))
+  {
+    acquired++;
+  }
+  f3d_window_end_capture(window);
+  free(frame);
+  if (acquired != 3)
+  {
+    puts("[ERROR] Unexpected number of captured frames");
+    f3d_engine_delete(engine);
+    return 1;
+  }
+
   f3d_engine_delete(engine);
   return 0;
 }
@@ -2,6 +2,8 @@
 #include "image.h"
 #include "window.h"
 
+#include <cstring>
+
 //----------------------------------------------------------------------------
 f3d_window_type_t f3d_window_get_type(f3d_window_t* window)
 {
@@ -172,3 +174,130 @@ void f3d_window_get_display_from_world(
   display_point[1] = cpp_display_point[1];
   display_point[2] = cpp_display_point[2];
 }
+
+//----------------------------------------------------------------------------
+f3d_pick_result_t* f3d_window_pick(f3d_window_t* window, int x, int y)
+{
+  if (!window)
+  {
+    return nullptr;
+  }
+
+  f3d::window* cpp_window = reinterpret_cast<f3d::window*>(window);
+  f3d::window::pick_result_t cpp_result = cpp_window->pick(x, y);
+
+  f3d_pick_result_t* result = new f3d_pick_result_t;
+  result->picked = cpp_result.picked ? 1 : 0;
+  result->position[0] = cpp_result.position[0];
+  result->position[1] = cpp_result.position[1];
+  result->position[2] = cpp_result.position[2];
+  result->name = new char[cpp_result.name.length() + 1];
+  std::strcpy(result->name, cpp_result.name.c_str());
+  result->accelerated = cpp_result.accelerated ? 1 : 0;
+  return result;
+}
+
+//----------------------------------------------------------------------------
+void f3d_window_free_pick_result(f3d_pick_result_t* result)
+{
+  if (!result)
+  {
+    return;
+  }
+
+  delete[] result->name;
+  delete result;
+}
+
+//----------------------------------------------------------------------------
+f3d_frame_stats_t* f3d_window_get_frame_stats(f3d_window_t* window)
+{
+  if (!window)
+  {
+    return nullptr;
+  }
+
+  f3d::window* cpp_window = reinterpret_cast<f3d::window*>(window);
+  f3d::window::frame_stats_t cpp_stats = cpp_window->getFrameStats();
+
+  f3d_frame_stats_t* stats = new f3d_frame_stats_t;
+  stats->frame = cpp_stats.frame;
+  stats->cpu_time = cpp_stats.cpu_time;
+  stats->gpu_time = cpp_stats.gpu_time;
+  stats->pass_count = cpp_stats.passes.size();
+  stats->passes = new f3d_pass_stats_t[cpp_stats.passes.size()];
+  for (size_t i = 0; i < cpp_stats.passes.size(); i++)
+  {
+    const f3d::window::pass_stats_t& cpp_pass = cpp_stats.passes[i];
+    stats->passes[i].name = new char[cpp_pass.name.length() + 1];
+    std::strcpy(stats->passes[i].name, cpp_pass.name.c_str());
+    stats->passes[i].depth = cpp_pass.depth;
+    stats->passes[i].cpu_time = cpp_pass.cpu_time;
+    stats->passes[i].gpu_time = cpp_pass.gpu_time;
+  }
+  return stats;
+}
+
+//----------------------------------------------------------------------------
+void f3d_window_free_frame_stats(f3d_frame_stats_t* stats)
+{
+  if (!stats)
+  {
+    return;
+  }
+
+  for (size_t i = 0; i < stats->pass_count; i++)
+  {
+    delete[] stats->passes[i].name;
+  }
+  delete[] stats->passes;
+  delete stats;
+}
+
+//----------------------------------------------------------------------------
+void f3d_window_begin_capture(f3d_window_t* window, int no_background, unsigned int buffer_count)
+{
+  if (!window)
+  {
+    return;
+  }
+
+  f3d::window* cpp_window = reinterpret_cast<f3d::window*>(window);
+  cpp_window->beginCapture(no_background != 0, buffer_count);
+}
+
+//----------------------------------------------------------------------------
+int f3d_window_acquire_frame(f3d_window_t* window, void* buffer)
+{
+  if (!window || !buffer)
+  {
+    return 0;
+  }
+
+  f3d::window* cpp_window = reinterpret_cast<f3d::window*>(window);
+  return cpp_window->acquireFrame(buffer) ? 1 : 0;
+}
+
+//----------------------------------------------------------------------------
+int f3d_window_flush_frame(f3d_window_t* window, void* buffer)
+{
+  if (!window || !buffer)
+  {
+    return 0;
+  }
+
+  f3d::window* cpp_window = reinterpret_cast<f3d::window*>(window);
+  return cpp_window->flushFrame(buffer) ? 1 : 0;
+}
+
+//----------------------------------------------------------------------------
+void f3d_window_end_capture(f3d_window_t* window)
+{
+  if (!window)
+  {
+    return;
+  }
+
+  f3d::window* cpp_window = reinterpret_cast<f3d::window*>(window);
+  cpp_window->endCapture();
+}
@@ -151,6 +151,127 @@ extern "C"
   F3D_EXPORT void f3d_window_get_display_from_world(
     const f3d_window_t* window, const f3d_point3_t world_point, f3d_point3_t display_point);
 
+  /**
+   * @brief Result of a pick.
+   *
+   * picked is 0 if nothing was picked.
+   * position is the picked position in world coordinates.
+   * name is the label of the picked actor in the scene hierarchy, empty if unknown.
+   * accelerated is 0 if the acceleration structures have not been used.
+   */
+  typedef struct f3d_pick_result_t
+  {
+    int picked;
+    f3d_point3_t position;
+    char* name;
+    int accelerated;
+  } f3d_pick_result_t;
+
+  /**
+   * @brief Pick the scene at a display position.
+   *
+   * The returned structure must be freed by the caller using f3d_window_free_pick_result().
+   *
+   * @param window Window handle.
+   * @param x Horizontal position in pixels from the left of the window.
+   * @param y Vertical position in pixels from the bottom of the window.
+   * @return Pick result, or NULL if window is NULL.
+   */
+  F3D_EXPORT f3d_pick_result_t* f3d_window_pick(f3d_window_t* window, int x, int y);
+
+  /**
+   * @brief Free a pick result structure.
+   *
+   * @param result Pick result structure to free.
+   */
+  F3D_EXPORT void f3d_window_free_pick_result(f3d_pick_result_t* result);
+
+  /**
+   * @brief Rendering times of a render pass, in seconds.
+   *
+   * Times are exclusive of the nested passes.
+   * gpu_time is negative if GPU times are not supported.
+   */
+  typedef struct f3d_pass_stats_t
+  {
+    char* name;
+    unsigned int depth;
+    double cpu_time;
+    double gpu_time;
+  } f3d_pass_stats_t;
+
+  /**
+   * @brief Rendering times of a frame, in seconds, with the stats of its render passes.
+   *
+   * frame is 0 if no frame stats are available yet.
+   * gpu_time is negative if GPU times are not supported.
+   */
+  typedef struct f3d_frame_stats_t
+  {
+    unsigned long long frame;
+    double cpu_time;
+    double gpu_time;
+    size_t pass_count;
+    f3d_pass_stats_t* passes;
+  } f3d_frame_stats_t;
+
+  /**
+   * @brief Get the rendering times of the most recent frame whose GPU times are available.
+   *
+   * The returned structure must be freed by the caller using f3d_window_free_frame_stats().
+   *
+   * @param window Window handle.
+   * @return Frame stats, or NULL if window is NULL.
+   */
+  F3D_EXPORT f3d_frame_stats_t* f3d_window_get_frame_stats(f3d_window_t* window);
+
+  /**
+   * @brief Free a frame stats structure.
+   *
+   * @param stats Frame stats structure to free.
+   */
+  F3D_EXPORT void f3d_window_free_frame_stats(f3d_frame_stats_t* stats);
+
+  /**
+   * @brief Start a streaming capture of the rendered frames.
+   *
+   * Frames are read back asynchronously using buffer_count frames in flight.
+   *
+   * @param window Window handle.
+   * @param no_background If non-zero, capture RGBA frames with a transparent background.
+   * @param buffer_count Number of frames in flight.
+   */
+  F3D_EXPORT void f3d_window_begin_capture(
+    f3d_window_t* window, int no_background, unsigned int buffer_count);
+
+  /**
+   * @brief Render a frame and provide the oldest frame of the capture if the capture is full.
+   *
+   * The buffer must hold at least width * height * channels bytes,
+   * with 3 channels (RGB), or 4 (RGBA) if no_background was set.
+   *
+   * @param window Window handle.
+   * @param buffer Buffer to copy the frame into.
+   * @return 1 if a frame was copied into the buffer, 0 otherwise.
+   */
+  F3D_EXPORT int f3d_window_acquire_frame(f3d_window_t* window, void* buffer);
+
+  /**
+   * @brief Provide the oldest remaining frame of the capture without rendering.
+   *
+   * @param window Window handle.
+   * @param buffer Buffer to copy the frame into.
+   * @return 1 if a frame was copied into the buffer, 0 if there is no remaining frame.
+   */
+  F3D_EXPORT int f3d_window_flush_frame(f3d_window_t* window, void* buffer);
+
+  /**
+   * @brief End the capture and release the capture buffers.
+   *
+   * @param window Window handle.
+   */
+  F3D_EXPORT void f3d_window_end_capture(f3d_window_t* window);
+
 #ifdef __cplusplus
 }
 #endif
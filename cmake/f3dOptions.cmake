@@ -68,17 +68,21 @@ function (f3d_generate_options)
   file(READ ${_f3d_generate_options_INPUT_JSON} _options_json)
   _parse_json_option(${_options_json})
 
-  list(JOIN _options_setter ";\n    else " _options_setter)
-  list(JOIN _options_getter ";\n    else " _options_getter)
-  list(JOIN _options_string_setter ";\n  else " _options_string_setter)
-  list(JOIN _options_string_getter ";\n    else " _options_string_getter)
+  list(LENGTH _options_lister _options_count)
+
+  # Statements are followed by a break, other cases return or throw
+  list(JOIN _options_setter ";\n      break;\n    " _options_setter)
+  list(JOIN _options_getter ";\n    " _options_getter)
+  list(JOIN _options_string_setter ";\n      break;\n    " _options_string_setter)
+  list(JOIN _options_string_getter ";\n    " _options_string_getter)
   list(JOIN _options_lister ",\n  " _options_lister)
-  list(JOIN _options_is_optional ";\n  else " _options_is_optional)
-  list(JOIN _options_reset ";\n  else " _options_reset)
-  list(JOIN _options_has_domain ";\n  else " _options_has_domain)
-  list(JOIN _options_get_enum_domain ";\n  else " _options_get_enum_domain)
-  list(JOIN _options_increase_decrease ";\n  else " _options_increase_decrease)
-  list(JOIN _options_cycle ";\n  else " _options_cycle)
+  list(JOIN _options_differ ";\n  " _options_differ)
+  list(JOIN _options_is_optional ";\n    " _options_is_optional)
+  list(JOIN _options_reset ";\n      break;\n    " _options_reset)
+  list(JOIN _options_has_domain ";\n    " _options_has_domain)
+  list(JOIN _options_get_enum_domain ";\n    " _options_get_enum_domain)
+  list(JOIN _options_increase_decrease ";\n    " _options_increase_decrease)
+  list(JOIN _options_cycle ";\n    " _options_cycle)
 
   configure_file(
     "${_f3d_generate_options_INPUT_PUBLIC_HEADER}"
@@ -138,6 +142,10 @@ function(_parse_json_option _top_json)
 
        set(_option_name "${_option_basename}${_member_name}")
 
+       # Options are dispatched by their index in the list of names
+       list(LENGTH _options_lister _option_index)
+       set(_option_case "case ${_option_index}: ")
+
        # Identify types
        set(_option_actual_type ${_option_type})
        set(_option_variant_type ${_option_type})
@@ -232,21 +240,22 @@ function(_parse_json_option _top_json)
          endif()
          string(APPEND _options_struct "${_option_indent}  ${_option_deprecated_string}${_option_actual_type} ${_member_name} = ${_optional_default_value_initialize};\n")
          set(_optional_getter "")
-         list(APPEND _options_is_optional "if (name == \"${_option_name}\") return false")
-         list(APPEND _options_reset "if (name == \"${_option_name}\") opt.${_option_name} = ${_optional_default_value_initialize}")
+         list(APPEND _options_is_optional "${_option_case}return false")
+         list(APPEND _options_reset "${_option_case}opt.${_option_name} = ${_optional_default_value_initialize}")
        else()
          # No default_value, it is an std::optional
          string(APPEND _options_struct "${_option_indent}  ${_option_deprecated_string}std::optional<${_option_actual_type}> ${_member_name};\n")
          set(_optional_getter ".value()")
-         list(APPEND _options_is_optional "if (name == \"${_option_name}\") return true")
-         list(APPEND _options_reset "if (name == \"${_option_name}\") opt.${_option_name}.reset()")
+         list(APPEND _options_is_optional "${_option_case}return true")
+         list(APPEND _options_reset "${_option_case}opt.${_option_name}.reset()")
        endif()
 
-       list(APPEND _options_setter "if (name == \"${_option_name}\") opt.${_option_name} = ${_option_explicit_constr}{std::get<${_option_variant_type}>(value)}")
-       list(APPEND _options_getter "if (name == \"${_option_name}\") return opt.${_option_name}${_optional_getter}${_option_variant_convert}")
-       list(APPEND _options_string_setter "if (name == \"${_option_name}\") opt.${_option_name} = options_tools::parse<${_option_actual_type}>(str)")
-       list(APPEND _options_string_getter "if (name == \"${_option_name}\") return options_tools::format(opt.${_option_name}${_optional_getter})")
+       list(APPEND _options_setter "${_option_case}opt.${_option_name} = ${_option_explicit_constr}{std::get<${_option_variant_type}>(value)}")
+       list(APPEND _options_getter "${_option_case}return opt.${_option_name}${_optional_getter}${_option_variant_convert}")
+       list(APPEND _options_string_setter "${_option_case}opt.${_option_name} = options_tools::parse<${_option_actual_type}>(str)")
+       list(APPEND _options_string_getter "${_option_case}return options_tools::format(opt.${_option_name}${_optional_getter})")
        list(APPEND _options_lister "\"${_option_name}\"")
+       list(APPEND _options_differ "if (opt.${_option_name} != other.${_option_name}) names.emplace_back(\"${_option_name}\")")
 
 
        # Domain
@@ -274,10 +283,10 @@ function(_parse_json_option _top_json)
 
            # Add range domain to struct and methods
            string(APPEND _options_domains_struct "${_option_indent}    DomainRange<${_option_domain_type}> ${_member_name} = ${_range_value_initialize};\n")
-           list(APPEND _options_has_domain "if (name == \"${_option_name}\") return options_tools::hasDomain(style, options::domain_style::RANGE)")
-           list(APPEND _options_get_enum_domain "if (name == \"${_option_name}\") throw options::incompatible_exception(\"Trying to get enum domain of \" + std::string(\"${_option_name}\") + \" which doesn't have such domain\")")
-           list(APPEND _options_increase_decrease "if (name == \"${_option_name}\") options_tools::increaseDecrease<Up>(opt.${_option_name}, opt.domains.${_option_name})")
-           list(APPEND _options_cycle "if (name == \"${_option_name}\") throw options::incompatible_exception(\"Trying to increase or decrease \" + std::string(\"${_option_name}\") + \" which is not compatible\")")
+           list(APPEND _options_has_domain "${_option_case}return options_tools::hasDomain(style, options::domain_style::RANGE)")
+           list(APPEND _options_get_enum_domain "${_option_case}throw options::incompatible_exception(\"Trying to get enum domain of \" + std::string(\"${_option_name}\") + \" which doesn't have such domain\")")
+           list(APPEND _options_increase_decrease "${_option_case}return options_tools::increaseDecrease<Up>(opt.${_option_name}, opt.domains.${_option_name})")
+           list(APPEND _options_cycle "${_option_case}throw options::incompatible_exception(\"Trying to increase or decrease \" + std::string(\"${_option_name}\") + \" which is not compatible\")")
 
          else()
 
@@ -303,10 +312,10 @@ function(_parse_json_option _top_json)
 
              # Add enum domain to struct and methods
              string(APPEND _options_domains_struct "${_option_indent}    DomainEnum<${_option_domain_type}> ${_member_name} = ${_enum_value_initialize};\n")
-             list(APPEND _options_has_domain "if (name == \"${_option_name}\") return options_tools::hasDomain(style, options::domain_style::ENUM)")
-             list(APPEND _options_get_enum_domain "if (name == \"${_option_name}\") return options_tools::getEnumDomain(opt.domains.${_option_name})")
-             list(APPEND _options_increase_decrease "if (name == \"${_option_name}\") throw options::incompatible_exception(\"Trying to increase or decrease \" + std::string(\"${_option_name}\") + \" which is not compatible\")")
-             list(APPEND _options_cycle "if (name == \"${_option_name}\") options_tools::cycle(opt.${_option_name}, opt.domains.${_option_name})")
+             list(APPEND _options_has_domain "${_option_case}return options_tools::hasDomain(style, options::domain_style::ENUM)")
+             list(APPEND _options_get_enum_domain "${_option_case}return options_tools::getEnumDomain(opt.domains.${_option_name})")
+             list(APPEND _options_increase_decrease "${_option_case}throw options::incompatible_exception(\"Trying to increase or decrease \" + std::string(\"${_option_name}\") + \" which is not compatible\")")
+             list(APPEND _options_cycle "${_option_case}return options_tools::cycle(opt.${_option_name}, opt.domains.${_option_name})")
            else()
 
              # Index domain
@@ -326,20 +335,20 @@ function(_parse_json_option _top_json)
 
                # Add index domain to struct and methods
                string(APPEND _options_domains_struct "${_option_indent}    DomainIndex ${_member_name} = ${_index_value_initialize};\n")
-               list(APPEND _options_has_domain "if (name == \"${_option_name}\") return options_tools::hasDomain(style, options::domain_style::INDEX)")
-               list(APPEND _options_get_enum_domain "if (name == \"${_option_name}\") throw options::incompatible_exception(\"Trying to get enum domain \" + std::string(\"${_option_name}\") + \" which doesn't have such domain\")")
-               list(APPEND _options_increase_decrease "if (name == \"${_option_name}\") options_tools::increaseDecrease<Up>(opt.${_option_name}, opt.domains.${_option_name})")
-               list(APPEND _options_cycle "if (name == \"${_option_name}\") options_tools::cycle(opt.${_option_name}, opt.domains.${_option_name})")
+               list(APPEND _options_has_domain "${_option_case}return options_tools::hasDomain(style, options::domain_style::INDEX)")
+               list(APPEND _options_get_enum_domain "${_option_case}throw options::incompatible_exception(\"Trying to get enum domain \" + std::string(\"${_option_name}\") + \" which doesn't have such domain\")")
+               list(APPEND _options_increase_decrease "${_option_case}return options_tools::increaseDecrease<Up>(opt.${_option_name}, opt.domains.${_option_name})")
+               list(APPEND _options_cycle "${_option_case}return options_tools::cycle(opt.${_option_name}, opt.domains.${_option_name})")
              endif()
            endif()
          endif()
 
        # No domain
        else()
-         list(APPEND _options_has_domain "if (name == \"${_option_name}\") return false")
-         list(APPEND _options_get_enum_domain "if (name == \"${_option_name}\") throw options::incompatible_exception(\"Trying to get enum domain \" + std::string(\"${_option_name}\") + \" which doesn't have one\")")
-         list(APPEND _options_increase_decrease "if (name == \"${_option_name}\") throw options::incompatible_exception(\"Trying to increase or decrease \" + std::string(\"${_option_name}\") + \" which is not compatible\")")
-         list(APPEND _options_cycle "if (name == \"${_option_name}\") throw options::incompatible_exception(\"Trying to cycle \" + std::string(\"${_option_name}\") + \" which is not compatible\")")
+         list(APPEND _options_has_domain "${_option_case}return false")
+         list(APPEND _options_get_enum_domain "${_option_case}throw options::incompatible_exception(\"Trying to get enum domain \" + std::string(\"${_option_name}\") + \" which doesn't have one\")")
+         list(APPEND _options_increase_decrease "${_option_case}throw options::incompatible_exception(\"Trying to increase or decrease \" + std::string(\"${_option_name}\") + \" which is not compatible\")")
+         list(APPEND _options_cycle "${_option_case}throw options::incompatible_exception(\"Trying to cycle \" + std::string(\"${_option_name}\") + \" which is not compatible\")")
        endif()
     else()
       # Group found, add in the structs and recurse
@@ -365,6 +374,7 @@ function(_parse_json_option _top_json)
   set(_options_string_setter ${_options_string_setter} PARENT_SCOPE)
   set(_options_string_getter ${_options_string_getter} PARENT_SCOPE)
   set(_options_lister ${_options_lister} PARENT_SCOPE)
+  set(_options_differ ${_options_differ} PARENT_SCOPE)
   set(_options_is_optional ${_options_is_optional} PARENT_SCOPE)
   set(_options_reset ${_options_reset} PARENT_SCOPE)
   set(_options_has_domain ${_options_has_domain} PARENT_SCOPE)
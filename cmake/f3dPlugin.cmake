@@ -39,6 +39,7 @@ f3d_plugin_declare_reader(
   [SUPPORTS_STREAM]
   [STANDARD_CAN_READ]
   [EXCLUDE_FROM_THUMBNAILER]
+  [THREAD_SAFE]
   [CUSTOM_CODE           <file>]
   EXTENSIONS             <string>...
   MIMETYPES              <string>...)
@@ -56,6 +57,7 @@ The `NAME` argument is required. The arguments are as follows:
   * `SUPPORTS_STREAM`: Flag to indicate that a reader support reading from streams, default is false
   * `CAN_READ`: Style of CAN_READ to use, STATIC, MEMBER or CUSTOM. A CAN_READ is required with SUPPORTS_STREAM
   * `EXCLUDE_FROM_THUMBNAILER`: If specified, the reader will not be used for generating thumbnails.
+  * `THREAD_SAFE`: Flag to indicate that a reader can be updated concurrently with other readers, default is false
   * `CUSTOM_CODE`: A custom code file containing the implementation of ``applyCustomReader`` function.
   * `EXTENSIONS`: (Required) The list of file extensions supported by the reader.
   * `MIMETYPES`: (Required) The list of mimetypes supported by the reader.
@@ -63,7 +65,7 @@ The `NAME` argument is required. The arguments are as follows:
 #]==]
 
 macro(f3d_plugin_declare_reader)
-  cmake_parse_arguments(F3D_READER "EXCLUDE_FROM_THUMBNAILER;SUPPORTS_STREAM" "NAME;VTK_IMPORTER;VTK_READER;FORMAT_DESCRIPTION;SCORE;CAN_READ;CUSTOM_CODE" "EXTENSIONS;MIMETYPES;OPTIONS" ${ARGN})
+  cmake_parse_arguments(F3D_READER "EXCLUDE_FROM_THUMBNAILER;SUPPORTS_STREAM;THREAD_SAFE" "NAME;VTK_IMPORTER;VTK_READER;FORMAT_DESCRIPTION;SCORE;CAN_READ;CUSTOM_CODE" "EXTENSIONS;MIMETYPES;OPTIONS" ${ARGN})
 
   if(F3D_READER_CUSTOM_CODE)
     set(F3D_READER_HAS_CUSTOM_CODE 1)
@@ -143,6 +145,16 @@ macro(f3d_plugin_declare_reader)
       SET "${F3D_READER_JSON}" "exclude_thumbnailer" "false")
   endif()
 
+  if (F3D_READER_THREAD_SAFE)
+    set(F3D_READER_HAS_THREAD_SAFE 1)
+    string(JSON F3D_READER_JSON
+      SET "${F3D_READER_JSON}" "thread_safe" "true")
+  else()
+    set(F3D_READER_HAS_THREAD_SAFE 0)
+    string(JSON F3D_READER_JSON
+      SET "${F3D_READER_JSON}" "thread_safe" "false")
+  endif()
+
   list(TRANSFORM F3D_READER_OPTIONS PREPEND "{ \"${F3D_READER_NAME}.")
   list(TRANSFORM F3D_READER_OPTIONS APPEND "\", \"\" }")
   list(JOIN F3D_READER_OPTIONS ", " F3D_READER_OPTIONS)
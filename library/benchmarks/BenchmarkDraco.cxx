@@ -0,0 +1,118 @@
+#include "BenchmarkHelpers.h"
+
+#include <engine.h>
+#include <scene.h>
+
+#include "draco/compression/encode.h"
+#include "draco/mesh/triangle_soup_mesh_builder.h"
+
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+constexpr int GridSize = 8;
+
+// Encode a small triangulated grid, shifted by its index, with Draco
+std::vector<char> EncodePrimitive(int index, int& nbFaces)
+{
+  nbFaces = GridSize * GridSize * 2;
+  draco::TriangleSoupMeshBuilder builder;
+  builder.Start(nbFaces);
+  const int posId =
+    builder.AddAttribute(draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32);
+
+  int face = 0;
+  for (int i = 0; i < GridSize; i++)
+  {
+    for (int j = 0; j < GridSize; j++)
+    {
+      const float x = static_cast<float>(index * (GridSize + 1) + i);
+      const float y = static_cast<float>(j);
+      const float p0[3] = { x, y, 0.f };
+      const float p1[3] = { x + 1.f, y, 0.f };
+      const float p2[3] = { x + 1.f, y + 1.f, 0.f };
+      const float p3[3] = { x, y + 1.f, 0.f };
+      builder.SetAttributeValuesForFace(posId, draco::FaceIndex(face++), p0, p1, p2);
+      builder.SetAttributeValuesForFace(posId, draco::FaceIndex(face++), p0, p2, p3);
+    }
+  }
+
+  std::unique_ptr<draco::Mesh> mesh = builder.Finalize();
+  draco::Encoder encoder;
+  draco::EncoderBuffer buffer;
+  if (!encoder.EncodeMeshToBuffer(*mesh, &buffer).ok())
+  {
+    throw std::runtime_error("cannot encode a Draco primitive");
+  }
+  return { buffer.data(), buffer.data() + buffer.size() };
+}
+
+// Write a .glb with a single mesh containing many Draco compressed primitives
+void WriteDracoGLB(const std::filesystem::path& path, int nbPrimitives)
+{
+  std::vector<char> bin;
+  std::ostringstream bufferViews, accessors, primitives;
+  for (int i = 0; i < nbPrimitives; i++)
+  {
+    int nbFaces = 0;
+    const std::vector<char> encoded = ::EncodePrimitive(i, nbFaces);
+
+    const char* sep = i == 0 ? "" : ",";
+    bufferViews << sep << R"({"buffer":0,"byteOffset":)" << bin.size() << R"(,"byteLength":)"
+                << encoded.size() << "}";
+    accessors << sep << R"({"componentType":5125,"count":)" << nbFaces * 3
+              << R"(,"type":"SCALAR"},)"
+              << R"({"componentType":5126,"count":)" << (GridSize + 1) * (GridSize + 1)
+              << R"(,"type":"VEC3","min":[)" << i * (GridSize + 1) << R"(,0,0],"max":[)"
+              << i * (GridSize + 1) + GridSize << "," << GridSize << ",0]}";
+    primitives << sep << R"({"attributes":{"POSITION":)" << 2 * i + 1 << R"(},"indices":)"
+               << 2 * i << R"(,"extensions":{"KHR_draco_mesh_compression":{"bufferView":)" << i
+               << R"(,"attributes":{"POSITION":0}}}})";
+
+    bin.insert(bin.end(), encoded.begin(), encoded.end());
+    bin.resize((bin.size() + 3) & ~static_cast<size_t>(3), '\0');
+  }
+
+  std::ostringstream json;
+  json << R"({"asset":{"version":"2.0"},)"
+       << R"("extensionsUsed":["KHR_draco_mesh_compression"],)"
+       << R"("extensionsRequired":["KHR_draco_mesh_compression"],)"
+       << R"("scene":0,"scenes":[{"nodes":[0]}],"nodes":[{"mesh":0}],)"
+       << R"("meshes":[{"primitives":[)" << primitives.str() << "]}],"
+       << R"("accessors":[)" << accessors.str() << "],"
+       << R"("bufferViews":[)" << bufferViews.str() << "],"
+       << R"("buffers":[{"byteLength":)" << bin.size() << "}]}";
+  std::string jsonStr = json.str();
+  jsonStr.resize((jsonStr.size() + 3) & ~static_cast<size_t>(3), ' ');
+
+  std::ofstream file(path, std::ios::binary);
+  auto writeUInt32 = [&](uint32_t value) { file.write(reinterpret_cast<char*>(&value), 4); };
+  file.write("glTF", 4);
+  writeUInt32(2);
+  writeUInt32(static_cast<uint32_t>(12 + 8 + jsonStr.size() + 8 + bin.size()));
+  writeUInt32(static_cast<uint32_t>(jsonStr.size()));
+  file.write("JSON", 4);
+  file.write(jsonStr.data(), static_cast<std::streamsize>(jsonStr.size()));
+  writeUInt32(static_cast<uint32_t>(bin.size()));
+  file.write("BIN\0", 4);
+  file.write(bin.data(), static_cast<std::streamsize>(bin.size()));
+}
+}
+
+void BenchmarkDraco(BenchmarkRunner& runner, f3d::engine& engine)
+{
+  // primitives of a glTF mesh are decoded concurrently by the Draco plugin
+  if (runner.IsSelected("scene/add_gltf_draco"))
+  {
+    f3d::scene& scene = engine.getScene();
+    const std::filesystem::path path = runner.GetSettings().TemporaryDir / "f3d_benchmark.glb";
+    ::WriteDracoGLB(path, 2000);
+    runner.Run(
+      "scene/add_gltf_draco", [&]() { scene.add(path); }, [&]() { scene.clear(); },
+      static_cast<double>(std::filesystem::file_size(path)));
+    scene.clear();
+    std::filesystem::remove(path);
+  }
+}
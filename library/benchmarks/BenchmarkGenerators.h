@@ -0,0 +1,298 @@
+#ifndef BenchmarkGenerators_h
+#define BenchmarkGenerators_h
+
+#include <mesh_view.h>
+#include <types.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Deterministic inputs generated for the libf3d benchmarks, so that they do not depend on
+ * the testing data.
+ */
+namespace BenchmarkGenerators
+{
+/**
+ * A wavy grid of resolution x resolution quads, each split in two triangles
+ */
+struct Grid
+{
+  std::vector<float> Points;
+  std::vector<float> Normals;
+  std::vector<unsigned int> Triangles;
+
+  size_t GetNumberOfPoints() const
+  {
+    return this->Points.size() / 3;
+  }
+
+  size_t GetNumberOfTriangles() const
+  {
+    return this->Triangles.size() / 3;
+  }
+};
+
+inline Grid GenerateGrid(unsigned int resolution)
+{
+  Grid grid;
+  grid.Points.reserve(3 * (resolution + 1) * (resolution + 1));
+  grid.Normals.reserve(3 * (resolution + 1) * (resolution + 1));
+  for (unsigned int j = 0; j <= resolution; j++)
+  {
+    for (unsigned int i = 0; i <= resolution; i++)
+    {
+      const float u = static_cast<float>(i) / resolution;
+      const float v = static_cast<float>(j) / resolution;
+      const float z = 0.05f * std::sin(20.f * u) * std::cos(20.f * v);
+      grid.Points.insert(grid.Points.end(), { 2.f * u - 1.f, 2.f * v - 1.f, z });
+
+      // analytic normal of the wavy surface
+      const float dzdx = 0.5f * std::cos(20.f * u) * std::cos(20.f * v);
+      const float dzdy = -0.5f * std::sin(20.f * u) * std::sin(20.f * v);
+      const float norm = std::sqrt(dzdx * dzdx + dzdy * dzdy + 1.f);
+      grid.Normals.insert(grid.Normals.end(), { -dzdx / norm, -dzdy / norm, 1.f / norm });
+    }
+  }
+
+  grid.Triangles.reserve(6 * resolution * resolution);
+  for (unsigned int j = 0; j < resolution; j++)
+  {
+    for (unsigned int i = 0; i < resolution; i++)
+    {
+      const unsigned int i0 = j * (resolution + 1) + i;
+      const unsigned int i1 = i0 + 1;
+      const unsigned int i2 = i0 + resolution + 2;
+      const unsigned int i3 = i0 + resolution + 1;
+      grid.Triangles.insert(grid.Triangles.end(), { i0, i1, i2, i0, i2, i3 });
+    }
+  }
+  return grid;
+}
+
+/**
+ * Copy the grid into a f3d::mesh_t
+ */
+inline f3d::mesh_t ToMesh(const Grid& grid)
+{
+  f3d::mesh_t mesh;
+  mesh.points = grid.Points;
+  mesh.normals = grid.Normals;
+  mesh.face_sides.assign(grid.GetNumberOfTriangles(), 3);
+  mesh.face_indices = grid.Triangles;
+  return mesh;
+}
+
+/**
+ * A zero-copy view on a grid.
+ * If frames is more than one, the grid is animated over [0, 1] with precomputed points for
+ * each frame, so that loading a time only changes the viewed buffer.
+ */
+class GridView : public f3d::mesh_view
+{
+public:
+  GridView(const Grid& grid, unsigned int frames)
+    : View(grid)
+  {
+    this->Offsets.resize(grid.GetNumberOfTriangles() + 1);
+    std::ranges::generate(this->Offsets, [n = 0u]() mutable { return 3 * n++; });
+
+    for (unsigned int f = 1; f < frames; f++)
+    {
+      std::vector<float> points = grid.Points;
+      for (size_t i = 2; i < points.size(); i += 3)
+      {
+        points[i] *= std::cos(6.28f * f / frames);
+      }
+      this->Frames.emplace_back(std::move(points));
+    }
+  }
+
+  [[nodiscard]] std::array<double, 2> getTimeRange() const override
+  {
+    return { 0.0, this->Frames.empty() ? 0.0 : 1.0 };
+  }
+
+  [[nodiscard]] memory_view_t getMemoryView(double time) const override
+  {
+    const float* points = this->View.Points.data();
+    if (!this->Frames.empty())
+    {
+      const auto frame = static_cast<size_t>(time * this->Frames.size());
+      points = frame == 0 ? points : this->Frames[std::min(frame, this->Frames.size()) - 1].data();
+    }
+
+    memory_view_t view;
+    view.pointCount = this->View.GetNumberOfPoints();
+    view.points = { "", data_type::F32, points, 3, 3, !this->Frames.empty() };
+    view.normals = { "", data_type::F32, this->View.Normals.data(), 3, 3, false };
+    view.polygons.offsetCount = this->Offsets.size();
+    view.polygons.offsets = { "", data_type::U32, this->Offsets.data(), 1, 1, false };
+    view.polygons.indexCount = this->View.Triangles.size();
+    view.polygons.indices = { "", data_type::U32, this->View.Triangles.data(), 1, 1, false };
+    return view;
+  }
+
+private:
+  const Grid& View;
+  std::vector<unsigned int> Offsets;
+  std::vector<std::vector<float>> Frames;
+};
+
+inline void WriteOBJ(const std::filesystem::path& path, const Grid& grid)
+{
+  std::ofstream file(path);
+  for (size_t i = 0; i < grid.Points.size(); i += 3)
+  {
+    file << "v " << grid.Points[i] << " " << grid.Points[i + 1] << " " << grid.Points[i + 2]
+         << "\n";
+  }
+  for (size_t i = 0; i < grid.Normals.size(); i += 3)
+  {
+    file << "vn " << grid.Normals[i] << " " << grid.Normals[i + 1] << " " << grid.Normals[i + 2]
+         << "\n";
+  }
+  for (size_t i = 0; i < grid.Triangles.size(); i += 3)
+  {
+    // OBJ indices start at 1
+    const unsigned int a = grid.Triangles[i] + 1;
+    const unsigned int b = grid.Triangles[i + 1] + 1;
+    const unsigned int c = grid.Triangles[i + 2] + 1;
+    file << "f " << a << "//" << a << " " << b << "//" << b << " " << c << "//" << c << "\n";
+  }
+}
+
+// binary files are written with the host endianness, assumed little endian
+inline void WritePLY(const std::filesystem::path& path, const Grid& grid)
+{
+  std::ofstream file(path, std::ios::binary);
+  file << "ply\nformat binary_little_endian 1.0\n"
+       << "element vertex " << grid.GetNumberOfPoints() << "\n"
+       << "property float x\nproperty float y\nproperty float z\n"
+       << "property float nx\nproperty float ny\nproperty float nz\n"
+       << "element face " << grid.GetNumberOfTriangles() << "\n"
+       << "property list uchar uint vertex_indices\nend_header\n";
+
+  for (size_t i = 0; i < grid.GetNumberOfPoints(); i++)
+  {
+    file.write(reinterpret_cast<const char*>(&grid.Points[3 * i]), 3 * sizeof(float));
+    file.write(reinterpret_cast<const char*>(&grid.Normals[3 * i]), 3 * sizeof(float));
+  }
+  const uint8_t count = 3;
+  for (size_t i = 0; i < grid.Triangles.size(); i += 3)
+  {
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    file.write(reinterpret_cast<const char*>(&grid.Triangles[i]), 3 * sizeof(unsigned int));
+  }
+}
+
+inline void WriteSTL(const std::filesystem::path& path, const Grid& grid)
+{
+  std::ofstream file(path, std::ios::binary);
+  const std::vector<char> header(80, 0);
+  file.write(header.data(), header.size());
+
+  const auto nbTriangles = static_cast<uint32_t>(grid.GetNumberOfTriangles());
+  file.write(reinterpret_cast<const char*>(&nbTriangles), sizeof(nbTriangles));
+  const uint16_t attributes = 0;
+  for (size_t i = 0; i < grid.Triangles.size(); i += 3)
+  {
+    file.write(reinterpret_cast<const char*>(&grid.Normals[3 * grid.Triangles[i]]),
+      3 * sizeof(float));
+    for (int v = 0; v < 3; v++)
+    {
+      file.write(reinterpret_cast<const char*>(&grid.Points[3 * grid.Triangles[i + v]]),
+        3 * sizeof(float));
+    }
+    file.write(reinterpret_cast<const char*>(&attributes), sizeof(attributes));
+  }
+}
+
+/**
+ * Write a .splat file of nbSplats gaussians randomly distributed in a unit cube
+ */
+inline void WriteSplat(const std::filesystem::path& path, size_t nbSplats)
+{
+  struct splat_t
+  {
+    float position[3];
+    float scale[3];
+    uint8_t color[4];
+    uint8_t rotation[4];
+  };
+
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+  std::vector<splat_t> splats(nbSplats);
+  for (splat_t& splat : splats)
+  {
+    for (int c = 0; c < 3; c++)
+    {
+      splat.position[c] = distribution(generator);
+      splat.scale[c] = 0.005f;
+      splat.color[c] = static_cast<uint8_t>(generator() % 256);
+      splat.rotation[c] = 128;
+    }
+    splat.color[3] = 128;
+    splat.rotation[3] = 255;
+  }
+
+  std::ofstream file(path, std::ios::binary);
+  file.write(reinterpret_cast<const char*>(splats.data()),
+    static_cast<std::streamsize>(splats.size() * sizeof(splat_t)));
+}
+
+/**
+ * Write an IFC4 file of a grid of gridSize x gridSize columns, each an extruded circle,
+ * so that each column is tessellated as its own geometry
+ */
+inline void WriteIFC(const std::filesystem::path& path, unsigned int gridSize)
+{
+  std::ofstream file(path);
+  file << "ISO-10303-21;\nHEADER;\n"
+       << "FILE_DESCRIPTION(('ViewDefinition [CoordinationView]'),'2;1');\n"
+       << "FILE_NAME('f3d_benchmark.ifc','',(''),(''),'','','');\n"
+       << "FILE_SCHEMA(('IFC4'));\nENDSEC;\nDATA;\n"
+       << "#1=IFCCARTESIANPOINT((0.,0.,0.));\n"
+       << "#2=IFCDIRECTION((0.,0.,1.));\n"
+       << "#3=IFCDIRECTION((1.,0.,0.));\n"
+       << "#4=IFCAXIS2PLACEMENT3D(#1,#2,#3);\n"
+       << "#5=IFCGEOMETRICREPRESENTATIONCONTEXT($,'Model',3,1.E-05,#4,$);\n"
+       << "#6=IFCSIUNIT(*,.LENGTHUNIT.,$,.METRE.);\n"
+       << "#7=IFCUNITASSIGNMENT((#6));\n"
+       << "#8=IFCPROJECT('0f3dBenchmarkProject00',$,'f3d benchmark',$,$,$,$,(#5),#7);\n"
+       << "#9=IFCLOCALPLACEMENT($,#4);\n"
+       << "#10=IFCCIRCLEPROFILEDEF(.AREA.,$,$,0.2);\n";
+
+  unsigned int id = 11;
+  for (unsigned int i = 0; i < gridSize; i++)
+  {
+    for (unsigned int j = 0; j < gridSize; j++)
+    {
+      // GlobalId are 22 characters long
+      const std::string index = std::to_string(i * gridSize + j);
+      const std::string globalId = "0f3dColumn" + std::string(12 - index.size(), '0') + index;
+      file << "#" << id << "=IFCCARTESIANPOINT((" << i << ".," << j << ".,0.));\n"
+           << "#" << id + 1 << "=IFCAXIS2PLACEMENT3D(#" << id << ",$,$);\n"
+           << "#" << id + 2 << "=IFCEXTRUDEDAREASOLID(#10,#" << id + 1 << ",#2,3.);\n"
+           << "#" << id + 3 << "=IFCSHAPEREPRESENTATION(#5,'Body','SweptSolid',(#" << id + 2
+           << "));\n"
+           << "#" << id + 4 << "=IFCPRODUCTDEFINITIONSHAPE($,$,(#" << id + 3 << "));\n"
+           << "#" << id + 5 << "=IFCCOLUMN('" << globalId << "',$,'column',$,$,#9,#" << id + 4
+           << ",$,$);\n";
+      id += 6;
+    }
+  }
+  file << "ENDSEC;\nEND-ISO-10303-21;\n";
+}
+}
+
+#endif
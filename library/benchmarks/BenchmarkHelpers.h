@@ -0,0 +1,190 @@
+#ifndef BenchmarkHelpers_h
+#define BenchmarkHelpers_h
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <fstream>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+/**
+ * Timing harness of the libf3d benchmarks.
+ * Each benchmark is run a number of warmup times, then measured a number of repetitions,
+ * and is reported with its timing statistics and memory usage.
+ */
+class BenchmarkRunner
+{
+public:
+  struct Settings
+  {
+    int Repetitions = 10;
+    int Warmups = 1;
+    std::string Filter;
+    std::filesystem::path DataDir;
+    std::filesystem::path TemporaryDir;
+  };
+
+  explicit BenchmarkRunner(Settings settings)
+    : Parameters(std::move(settings))
+  {
+  }
+
+  const Settings& GetSettings() const
+  {
+    return this->Parameters;
+  }
+
+  /**
+   * Return true if the benchmark is selected by the filter.
+   * Can be used to skip expensive preparations of benchmarks that will not run.
+   */
+  bool IsSelected(const std::string& name) const
+  {
+    const std::string& filter = this->Parameters.Filter;
+    return filter.empty() || name.find(filter) != std::string::npos;
+  }
+
+  /**
+   * Run and measure a benchmark if it is selected by the filter.
+   * `setup`, if any, is called before each run and is not measured.
+   * `bytes`, if not zero, is the amount of data processed by a run, used to report a throughput.
+   * Exceptions are reported as a failed benchmark.
+   */
+  void Run(const std::string& name, const std::function<void()>& function,
+    const std::function<void()>& setup = nullptr, double bytes = 0.0)
+  {
+    if (!this->IsSelected(name))
+    {
+      return;
+    }
+
+    std::cout << name << "... " << std::flush;
+
+    nlohmann::json result;
+    result["name"] = name;
+    result["rss_before_mb"] = BenchmarkRunner::GetResidentMemory();
+
+    std::vector<double> times;
+    try
+    {
+      for (int i = 0; i < this->Parameters.Warmups + this->Parameters.Repetitions; i++)
+      {
+        if (setup)
+        {
+          setup();
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const double elapsed =
+          std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+            .count();
+
+        if (i >= this->Parameters.Warmups)
+        {
+          times.emplace_back(elapsed);
+        }
+      }
+    }
+    catch (const std::exception& ex)
+    {
+      std::cout << "failed: " << ex.what() << "\n";
+      result["error"] = ex.what();
+      this->Failed = true;
+      this->Results.emplace_back(std::move(result));
+      return;
+    }
+
+    std::ranges::sort(times);
+    const double mean = std::accumulate(times.begin(), times.end(), 0.0) / times.size();
+    const double variance = std::accumulate(times.begin(), times.end(), 0.0,
+                              [&](double acc, double t) { return acc + (t - mean) * (t - mean); }) /
+      times.size();
+
+    result["repetitions"] = times.size();
+    result["min_ms"] = times.front();
+    result["median_ms"] = BenchmarkRunner::Percentile(times, 50);
+    result["p90_ms"] = BenchmarkRunner::Percentile(times, 90);
+    result["p99_ms"] = BenchmarkRunner::Percentile(times, 99);
+    result["max_ms"] = times.back();
+    result["mean_ms"] = mean;
+    result["stddev_ms"] = std::sqrt(variance);
+    if (bytes > 0.0)
+    {
+      result["throughput_mb_s"] =
+        bytes / (1024.0 * 1024.0) / (BenchmarkRunner::Percentile(times, 50) / 1000.0);
+    }
+    result["rss_after_mb"] = BenchmarkRunner::GetResidentMemory();
+    result["peak_rss_mb"] = BenchmarkRunner::GetPeakResidentMemory();
+
+    std::cout << result["median_ms"].get<double>() << " ms (median)\n";
+    this->Results.emplace_back(std::move(result));
+  }
+
+  /**
+   * Return true if any benchmark failed
+   */
+  bool HasFailed() const
+  {
+    return this->Failed;
+  }
+
+  const std::vector<nlohmann::json>& GetResults() const
+  {
+    return this->Results;
+  }
+
+private:
+  // nearest rank percentile of sorted values
+  static double Percentile(const std::vector<double>& sorted, double percent)
+  {
+    const auto rank = static_cast<size_t>(std::ceil(percent / 100.0 * sorted.size()));
+    return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+  }
+
+  // resident memory in MB, 0 if not supported by the platform
+  static double GetResidentMemory()
+  {
+#ifdef __linux__
+    std::ifstream statm("/proc/self/statm");
+    long size = 0;
+    long resident = 0;
+    if (statm >> size >> resident)
+    {
+      return static_cast<double>(resident) * sysconf(_SC_PAGESIZE) / (1024.0 * 1024.0);
+    }
+#endif
+    return 0.0;
+  }
+
+  // peak resident memory in MB since the start of the process, 0 if not supported
+  static double GetPeakResidentMemory()
+  {
+#ifdef __linux__
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+      return static_cast<double>(usage.ru_maxrss) / 1024.0;
+    }
+#endif
+    return 0.0;
+  }
+
+  Settings Parameters;
+  std::vector<nlohmann::json> Results;
+  bool Failed = false;
+};
+
+#endif
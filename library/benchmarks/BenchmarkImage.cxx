@@ -0,0 +1,61 @@
+#include "BenchmarkHelpers.h"
+
+#include <image.h>
+
+#include <random>
+
+void BenchmarkImage(BenchmarkRunner& runner)
+{
+  constexpr unsigned int width = 1920;
+  constexpr unsigned int height = 1080;
+  constexpr unsigned int channels = 3;
+  constexpr double bytes = width * height * channels;
+
+  // a smooth gradient with noise, closer to a rendering than pure noise for the encoders
+  std::mt19937 generator(0);
+  std::vector<uint8_t> pixels(width * height * channels);
+  for (unsigned int j = 0; j < height; j++)
+  {
+    for (unsigned int i = 0; i < width; i++)
+    {
+      uint8_t* pixel = &pixels[(j * width + i) * channels];
+      pixel[0] = static_cast<uint8_t>(255 * i / width);
+      pixel[1] = static_cast<uint8_t>(255 * j / height);
+      pixel[2] = static_cast<uint8_t>(generator() % 32);
+    }
+  }
+
+  f3d::image reference(width, height, channels);
+  reference.setContent(pixels.data());
+
+  // identical images and images with a few different pixels
+  f3d::image identical(width, height, channels);
+  identical.setContent(pixels.data());
+
+  for (size_t i = 0; i < pixels.size(); i += 4099)
+  {
+    pixels[i] = static_cast<uint8_t>(255 - pixels[i]);
+  }
+  f3d::image different(width, height, channels);
+  different.setContent(pixels.data());
+
+  runner.Run("image/compare_identical", [&]() { (void)reference.compare(identical); }, nullptr,
+    bytes);
+  runner.Run("image/compare_different", [&]() { (void)reference.compare(different); }, nullptr,
+    bytes);
+
+  const std::filesystem::path& tmpDir = runner.GetSettings().TemporaryDir;
+  runner.Run("image/save_png",
+    [&]() { reference.save(tmpDir / "f3d_benchmark.png", f3d::image::SaveFormat::PNG); }, nullptr,
+    bytes);
+  runner.Run("image/save_jpg",
+    [&]() { reference.save(tmpDir / "f3d_benchmark.jpg", f3d::image::SaveFormat::JPG); }, nullptr,
+    bytes);
+  runner.Run("image/save_buffer_png",
+    [&]() { (void)reference.saveBuffer(f3d::image::SaveFormat::PNG); }, nullptr, bytes);
+  runner.Run("image/save_buffer_bmp",
+    [&]() { (void)reference.saveBuffer(f3d::image::SaveFormat::BMP); }, nullptr, bytes);
+
+  std::filesystem::remove(tmpDir / "f3d_benchmark.png");
+  std::filesystem::remove(tmpDir / "f3d_benchmark.jpg");
+}
@@ -0,0 +1,70 @@
+#include "BenchmarkHelpers.h"
+
+#include <options.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+void BenchmarkOptions(BenchmarkRunner& runner)
+{
+  // All the options with a value as strings, like a config file providing every option
+  f3d::options reference;
+  std::vector<std::pair<std::string, std::string>> config;
+  for (const std::string& name : reference.getNames())
+  {
+    config.emplace_back(name, reference.getAsString(name));
+  }
+
+  // Repeat the application so that a run is long enough to be measured
+  constexpr int nbApplications = 100;
+
+  f3d::options opt;
+  runner.Run("options/set_as_string",
+    [&]()
+    {
+      for (int i = 0; i < nbApplications; i++)
+      {
+        for (const auto& [name, value] : config)
+        {
+          opt.setAsString(name, value);
+        }
+      }
+    });
+
+  runner.Run("options/get_as_string",
+    [&]()
+    {
+      for (int i = 0; i < nbApplications; i++)
+      {
+        for (const auto& [name, value] : config)
+        {
+          (void)opt.getAsString(name);
+        }
+      }
+    });
+
+  runner.Run("options/set_get",
+    [&]()
+    {
+      for (int i = 0; i < nbApplications; i++)
+      {
+        for (const auto& [name, value] : config)
+        {
+          opt.set(name, reference.get(name));
+        }
+      }
+    });
+
+  runner.Run("options/is_same",
+    [&]()
+    {
+      for (int i = 0; i < nbApplications; i++)
+      {
+        for (const auto& [name, value] : config)
+        {
+          (void)opt.isSame(reference, name);
+        }
+      }
+    });
+}
@@ -0,0 +1,70 @@
+#include "BenchmarkGenerators.h"
+#include "BenchmarkHelpers.h"
+
+#include <camera.h>
+#include <engine.h>
+#include <image.h>
+#include <options.h>
+#include <scene.h>
+#include <window.h>
+
+#include <string>
+#include <utility>
+
+void BenchmarkRendering(BenchmarkRunner& runner, f3d::engine& engine)
+{
+  f3d::scene& scene = engine.getScene();
+  f3d::window& window = engine.getWindow();
+  f3d::camera& camera = window.getCamera();
+  f3d::options& options = engine.getOptions();
+
+  window.setSize(1920, 1080);
+
+  // 2M triangles, the first render is part of the warmup
+  if (runner.IsSelected("window/render"))
+  {
+    const BenchmarkGenerators::Grid grid = BenchmarkGenerators::GenerateGrid(1000);
+    scene.add(BenchmarkGenerators::ToMesh(grid));
+    camera.resetToBounds();
+
+    // rotate the camera before each render so that nothing can be reused from the previous frame
+    const auto rotate = [&]() { camera.azimuth(1.0); };
+    runner.Run("window/render", [&]() { window.render(); }, rotate);
+    runner.Run("window/render_to_image", [&]() { (void)window.renderToImage(); }, rotate);
+    runner.Run(
+      "window/render_to_image_no_background", [&]() { (void)window.renderToImage(true); }, rotate);
+
+    scene.clear();
+  }
+
+  // splats are sorted on the CPU on each render as the camera direction changes
+  for (const auto& [name, nbSplats] :
+    { std::pair<std::string, size_t>{ "window/render_splats_sort_cpu", 1000000 },
+      std::pair<std::string, size_t>{ "window/render_splats_sort_cpu_5m", 5000000 } })
+  {
+    if (!runner.IsSelected(name))
+    {
+      continue;
+    }
+
+    const std::filesystem::path path = runner.GetSettings().TemporaryDir / "f3d_benchmark.splat";
+    BenchmarkGenerators::WriteSplat(path, nbSplats);
+
+    options.model.point_sprites.type = "gaussian";
+    options.model.point_sprites.absolute_size = true;
+    options.model.point_sprites.size = 1.0;
+    options.render.effect.blending.mode = "sort_cpu";
+
+    scene.add(path);
+    camera.resetToBounds();
+    runner.Run(name, [&]() { window.render(); }, [&]() { camera.azimuth(5.0); });
+
+    options.model.point_sprites.type = "none";
+    options.model.point_sprites.absolute_size = false;
+    options.model.point_sprites.size = 10.0;
+    options.render.effect.blending.mode = "none";
+
+    scene.clear();
+    std::filesystem::remove(path);
+  }
+}
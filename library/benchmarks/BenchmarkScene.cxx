@@ -0,0 +1,109 @@
+#include "BenchmarkGenerators.h"
+#include "BenchmarkHelpers.h"
+
+#include <engine.h>
+#include <options.h>
+#include <scene.h>
+
+#include <fstream>
+#include <memory>
+
+void BenchmarkScene(BenchmarkRunner& runner, f3d::engine& engine)
+{
+  f3d::scene& scene = engine.getScene();
+  const std::filesystem::path& tmpDir = runner.GetSettings().TemporaryDir;
+
+  // 500k triangles
+  const BenchmarkGenerators::Grid grid = BenchmarkGenerators::GenerateGrid(500);
+  const auto clear = [&]() { scene.clear(); };
+
+  // scene::add per reader on generated files
+  const std::vector<std::pair<std::string, void (*)(const std::filesystem::path&,
+                                             const BenchmarkGenerators::Grid&)>>
+    writers = { { "obj", &BenchmarkGenerators::WriteOBJ },
+      { "ply", &BenchmarkGenerators::WritePLY }, { "stl", &BenchmarkGenerators::WriteSTL } };
+
+  for (const auto& [extension, writer] : writers)
+  {
+    const std::string name = "scene/add_" + extension;
+    if (runner.IsSelected(name))
+    {
+      const std::filesystem::path path = tmpDir / ("f3d_benchmark_grid." + extension);
+      writer(path, grid);
+      runner.Run(
+        name, [&]() { scene.add(path); }, clear,
+        static_cast<double>(std::filesystem::file_size(path)));
+      std::filesystem::remove(path);
+    }
+  }
+
+  // splat files are memory mapped, buffers are read as a stream
+  if (runner.IsSelected("scene/add_splat") || runner.IsSelected("scene/add_splat_buffer"))
+  {
+    constexpr size_t nbSplats = 1000000;
+    const std::filesystem::path path = tmpDir / "f3d_benchmark.splat";
+    BenchmarkGenerators::WriteSplat(path, nbSplats);
+    const double bytes = static_cast<double>(std::filesystem::file_size(path));
+    runner.Run("scene/add_splat", [&]() { scene.add(path); }, clear, bytes);
+
+    if (runner.IsSelected("scene/add_splat_buffer"))
+    {
+      std::vector<std::byte> buffer(std::filesystem::file_size(path));
+      std::ifstream file(path, std::ios::binary);
+      file.read(
+        reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+
+      f3d::options& options = engine.getOptions();
+      options.scene.force_reader = "Splat";
+      runner.Run(
+        "scene/add_splat_buffer", [&]() { scene.add(buffer.data(), buffer.size()); }, clear,
+        bytes);
+      options.scene.force_reader.reset();
+    }
+    std::filesystem::remove(path);
+  }
+
+#ifdef F3D_BENCHMARKS_WEBIFC
+  // IFC geometries are tessellated by web-ifc, then stitched concurrently by the reader
+  if (runner.IsSelected("scene/add_ifc"))
+  {
+    const std::filesystem::path path = tmpDir / "f3d_benchmark.ifc";
+    BenchmarkGenerators::WriteIFC(path, 100);
+    runner.Run(
+      "scene/add_ifc", [&]() { scene.add(path); }, clear,
+      static_cast<double>(std::filesystem::file_size(path)));
+    std::filesystem::remove(path);
+  }
+#endif
+
+  // in memory meshes, copied with mesh_t or viewed with mesh_view
+  const double meshBytes = static_cast<double>(sizeof(float) *
+      (grid.Points.size() + grid.Normals.size()) +
+    sizeof(unsigned int) * grid.Triangles.size());
+
+  const f3d::mesh_t mesh = BenchmarkGenerators::ToMesh(grid);
+  runner.Run("scene/add_mesh", [&]() { scene.add(mesh); }, clear, meshBytes);
+
+  const auto view = std::make_shared<BenchmarkGenerators::GridView>(grid, 1);
+  runner.Run("scene/add_mesh_view", [&]() { scene.add(view); }, clear, meshBytes);
+
+  // animation stepping of an animated mesh_view, only the viewed buffer changes between frames
+  constexpr int nbSteps = 50;
+  const auto animatedView = std::make_shared<BenchmarkGenerators::GridView>(grid, 10);
+  runner.Run(
+    "scene/load_animation_time",
+    [&]()
+    {
+      for (int i = 0; i <= nbSteps; i++)
+      {
+        scene.loadAnimationTime(static_cast<double>(i) / nbSteps);
+      }
+    },
+    [&]()
+    {
+      scene.clear();
+      scene.add(animatedView);
+    });
+
+  scene.clear();
+}
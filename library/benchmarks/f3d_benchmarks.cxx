@@ -0,0 +1,151 @@
+#include "BenchmarkHelpers.h"
+
+#include <engine.h>
+#include <log.h>
+
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <thread>
+
+#ifdef F3D_BENCHMARKS_DRACO
+void BenchmarkDraco(BenchmarkRunner& runner, f3d::engine& engine);
+#endif
+void BenchmarkImage(BenchmarkRunner& runner);
+void BenchmarkOptions(BenchmarkRunner& runner);
+void BenchmarkRendering(BenchmarkRunner& runner, f3d::engine& engine);
+void BenchmarkScene(BenchmarkRunner& runner, f3d::engine& engine);
+
+namespace
+{
+void PrintUsage()
+{
+  std::cout << "Usage: f3d_benchmarks [options]\n"
+               "  --backend=<auto|egl|osmesa|none>  Rendering backend, rendering benchmarks are "
+               "skipped with none (default: auto)\n"
+               "  --output=<file.json>              Write the results as JSON\n"
+               "  --repetitions=<n>                 Measured runs per benchmark (default: 10)\n"
+               "  --warmups=<n>                     Unmeasured runs per benchmark (default: 1)\n"
+               "  --filter=<string>                 Only run benchmarks containing the string\n"
+               "  --temporary-dir=<dir>             Directory of the generated inputs\n";
+}
+
+std::optional<f3d::engine> CreateEngine(const std::string& backend)
+{
+  if (backend == "egl")
+  {
+    return f3d::engine::createEGL();
+  }
+  if (backend == "osmesa")
+  {
+    return f3d::engine::createOSMesa();
+  }
+  if (backend == "none")
+  {
+    return f3d::engine::createNone();
+  }
+  if (backend == "auto")
+  {
+    return f3d::engine::create(true);
+  }
+  return std::nullopt;
+}
+}
+
+int main(int argc, char* argv[])
+{
+  BenchmarkRunner::Settings settings;
+  settings.TemporaryDir = std::filesystem::temp_directory_path();
+  std::string backend = "auto";
+  std::string output;
+
+  for (int i = 1; i < argc; i++)
+  {
+    const std::string arg = argv[i];
+    const size_t separator = arg.find('=');
+    const std::string key = arg.substr(0, separator);
+    const std::string value = separator == std::string::npos ? "" : arg.substr(separator + 1);
+
+    if (key == "--backend")
+    {
+      backend = value;
+    }
+    else if (key == "--output")
+    {
+      output = value;
+    }
+    else if (key == "--repetitions")
+    {
+      settings.Repetitions = std::max(1, std::stoi(value));
+    }
+    else if (key == "--warmups")
+    {
+      settings.Warmups = std::max(0, std::stoi(value));
+    }
+    else if (key == "--filter")
+    {
+      settings.Filter = value;
+    }
+    else if (key == "--temporary-dir")
+    {
+      settings.TemporaryDir = value;
+    }
+    else
+    {
+      ::PrintUsage();
+      return key == "--help" ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  }
+
+  f3d::log::setVerboseLevel(f3d::log::VerboseLevel::ERROR);
+  f3d::engine::autoloadPlugins();
+
+  std::optional<f3d::engine> engine;
+  try
+  {
+    engine = ::CreateEngine(backend);
+  }
+  catch (const f3d::exception& ex)
+  {
+    std::cerr << "Cannot create the " << backend << " backend: " << ex.what() << "\n";
+    return EXIT_FAILURE;
+  }
+
+  if (!engine)
+  {
+    std::cerr << "Unknown backend: " << backend << "\n";
+    return EXIT_FAILURE;
+  }
+
+  BenchmarkRunner runner(settings);
+  BenchmarkImage(runner);
+  BenchmarkOptions(runner);
+  BenchmarkScene(runner, engine.value());
+#ifdef F3D_BENCHMARKS_DRACO
+  BenchmarkDraco(runner, engine.value());
+#endif
+  if (backend != "none")
+  {
+    BenchmarkRendering(runner, engine.value());
+  }
+
+  if (!output.empty())
+  {
+    const f3d::engine::libInformation info = f3d::engine::getLibInfo();
+
+    nlohmann::json json;
+    json["f3d_version"] = info.VersionFull;
+    json["vtk_version"] = info.VTKVersion;
+    json["backend"] = backend;
+    json["hardware_threads"] = std::thread::hardware_concurrency();
+    json["repetitions"] = settings.Repetitions;
+    json["warmups"] = settings.Warmups;
+    json["benchmarks"] = runner.GetResults();
+
+    std::ofstream file(output);
+    file << json.dump(2) << "\n";
+    std::cout << "Results written to " << output << "\n";
+  }
+
+  return runner.HasFailed() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
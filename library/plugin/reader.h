@@ -178,6 +178,15 @@ public:
     return false;
   }
 
+  /**
+   * Return true if the readers created by this reader can be updated concurrently
+   * with readers of other files, false otherwise
+   */
+  virtual bool isThreadSafe() const
+  {
+    return false;
+  }
+
   /**
    * Set a reader option
    * Return true if the option was found (and set), false otherwise
@@ -207,8 +216,18 @@ public:
     return keys;
   }
 
+  /**
+   * Set the cache path readers can use to store persistent data
+   * Empty by default, meaning no cache should be used
+   */
+  void setCachePath(const std::string& cachePath)
+  {
+    this->CachePath = cachePath;
+  }
+
 protected:
   std::map<std::string, std::string> ReaderOptions;
+  std::string CachePath;
 };
 }
 
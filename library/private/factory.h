@@ -69,6 +69,11 @@ public:
    */
   std::vector<std::string> getAllReaderOptionNames();
 
+  /**
+   * Set the cache path on all readers of all plugins, including plugins loaded later
+   */
+  void setCachePath(const std::string& cachePath);
+
   /**
    * Get static plugin initialization function
    * Return nullptr if it does not exists
@@ -84,6 +89,8 @@ protected:
   std::vector<plugin*> Plugins;
 
   std::map<std::string, plugin_initializer_t> StaticPluginInitializers;
+
+  std::string CachePath;
 };
 }
 #endif
@@ -37,6 +37,7 @@ public:
   scene& add(const mesh_t& mesh) override;
   scene& add(std::shared_ptr<mesh_view> mesh) override;
   scene& add(const std::byte* buffer, std::size_t size) override;
+  load_handle addAsync(const std::vector<std::filesystem::path>& filePaths) override;
   scene& clear() override;
   int addLight(const light_state_t& lightState) const override;
   int getLightCount() const override;
@@ -64,6 +65,35 @@ public:
    */
   void PrintImporterDescription(log::VerboseLevel level);
 
+  /**
+   * Implementation only API.
+   * Add the content of asynchronous loads that are done reading to the scene, in the order
+   * they were started. Stop at the first load still reading, unless `until` is provided,
+   * in which case wait for all loads up to and including `until`.
+   * Must be called from the main thread. Return true if anything was added to the scene.
+   */
+  bool CommitPendingLoads(load_handle::internals* until = nullptr);
+
+  /**
+   * Implementation only API.
+   * Update the mesh streams of the scene which have new snapshots published.
+   * Must be called from the main thread. Return true if any mesh stream was updated.
+   */
+  bool UpdateMeshStreams();
+
+  /**
+   * Implementation only API.
+   * Cancel all pending asynchronous loads and wait for their reading threads.
+   */
+  void CancelPendingLoads();
+
+  /**
+   * Implementation only API.
+   * Wait for all pending asynchronous loads and commit them,
+   * so that synchronous adds are ordered after the loads started before them.
+   */
+  void CommitAllPendingLoads();
+
 private:
   class internals;
   std::unique_ptr<internals> Internals;
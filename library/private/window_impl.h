@@ -59,6 +59,14 @@ public:
   window& setWindowName(std::string_view windowName) override;
   point3_t getWorldFromDisplay(const point3_t& displayPoint) const override;
   point3_t getDisplayFromWorld(const point3_t& worldPoint) const override;
+  pick_result_t pick(int x, int y) override;
+  frame_stats_t getFrameStats() override;
+  window& beginCapture(bool noBackground = false, unsigned int bufferCount = 3) override;
+  bool acquireFrame(image& frame) override;
+  bool acquireFrame(void* buffer) override;
+  bool flushFrame(image& frame) override;
+  bool flushFrame(void* buffer) override;
+  window& endCapture() override;
   ///@}
 
   /**
@@ -200,7 +200,8 @@ public:
 
   /**
    * Set the cache path. The provided path is used as is.
-   * Currently, it's only used to store HDRI baked textures.
+   * It is used to store HDRI baked textures and by readers supporting a cache,
+   * eg: the tessellation cache of the OCCT readers.
    * By default, the cache path is:
    * - Windows: %LOCALAPPDATA%\f3d
    * - Linux: ~/.cache/f3d
@@ -144,8 +144,14 @@ public:
    *  - 0.1: Small visible difference.
    *  - 0.5: Comparable images.
    *  - 1.0: Different type, size or number of components
-   */
-  double compare(const image& reference) const;
+   * Identical images are detected by comparing their content first,
+   * without computing the SSIM, and return 0.
+   * If diff is provided, it is set to a heatmap of the differences, a RGB image of the same size
+   * going from black for identical pixels to red, yellow and white for the most different pixels.
+   * The alpha channel, if any, is ignored. diff is set to an empty image if the images have
+   * different type, size or number of components. diff must not be one of the compared images.
+   */
+  double compare(const image& reference, image* diff = nullptr) const;
 
   /**
    * Save an image to the provided file path, used as is, in the specified format.
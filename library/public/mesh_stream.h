@@ -0,0 +1,86 @@
+#ifndef f3d_mesh_stream_h
+#define f3d_mesh_stream_h
+
+#include "export.h"
+#include "mesh_view.h"
+
+/// @cond
+#include <memory>
+/// @endcond
+
+namespace f3d
+{
+/**
+ * @class   mesh_stream
+ * @brief   A mesh view fed with snapshots published by a producer thread
+ *
+ * The mesh_stream class is a mesh_view to visualize a mesh updated live by another thread, like a
+ * running simulation. The producer thread publishes snapshots of the mesh using `publish`, at its
+ * own rate and without ever blocking, into a lock-free triple buffer. At the next frame, the
+ * interactor event loop picks up the latest complete snapshot, updates the scene with it and
+ * requests a render. Snapshots published in between two frames are skipped.
+ *
+ * The memory referenced by a snapshot must remain valid as long as it can be rendered. This is
+ * handled by providing an `owner` with the snapshot, which is released from the producer thread
+ * once the snapshot has been replaced by a newer one on the rendering side.
+ * At least one snapshot must be published before adding the stream to the scene.
+ *
+ * Example usage:
+ *
+ * ```cpp
+ * auto stream = std::make_shared<f3d::mesh_stream>();
+ * stream->publish(solver.getMemoryView(), solver.getCurrentState());
+ * eng.getScene().add(stream);
+ *
+ * std::thread producer([&]() {
+ *   while (solver.step())
+ *   {
+ *     stream->publish(solver.getMemoryView(), solver.getCurrentState());
+ *   }
+ * });
+ * eng.getInteractor().start();
+ * ```
+ */
+class F3D_EXPORT mesh_stream : public mesh_view
+{
+public:
+  /**
+   * Publish a new snapshot of the mesh, to be rendered at the next frame.
+   * `owner` is kept alive until the snapshot is not used for rendering anymore.
+   * This method never blocks but must always be called from the same thread.
+   */
+  void publish(const memory_view_t& view, std::shared_ptr<const void> owner = nullptr);
+
+  /**
+   * Return true if a snapshot has been published and not been acquired yet.
+   */
+  [[nodiscard]] bool hasNewSnapshot() const;
+
+  /**
+   * Make the latest published snapshot the one returned by getMemoryView.
+   * This is called by the scene from the rendering thread and should not be called by the producer.
+   * Return true if a new snapshot has been acquired.
+   */
+  bool acquireSnapshot();
+
+  /**
+   * Return the last acquired snapshot, whatever the time.
+   */
+  [[nodiscard]] memory_view_t getMemoryView(double time) const override;
+
+  //! @cond
+  mesh_stream();
+  ~mesh_stream() override;
+  mesh_stream(const mesh_stream&) = delete;
+  mesh_stream(mesh_stream&&) = delete;
+  mesh_stream& operator=(const mesh_stream&) = delete;
+  mesh_stream& operator=(mesh_stream&&) = delete;
+  //! @endcond
+
+private:
+  class internals;
+  std::unique_ptr<internals> Internals;
+};
+}
+
+#endif
@@ -100,6 +100,11 @@ public:
    * If `timeDependent` is true, it means that the data in the array can change over time.
    * Set it to false if the data in the array is constant over time, it can help improving
    * performance.
+   * `generation` is optional, if not 0 it must be changed each time the data in the array changes,
+   * so that an array with the same generation as in the previous view is not uploaded again.
+   * `dirtyRanges` is optional, it lists the [begin, end) ranges of tuples which changed since the
+   * previous view. When `data`, `type`, `components` and `stride` are the same as in the previous
+   * view, only these ranges are uploaded to the GPU. If empty, the whole array is uploaded.
    */
   struct data_array_t
   {
@@ -109,6 +114,8 @@ public:
     size_t components = 1;
     size_t stride = 1;
     bool timeDependent = true;
+    uint64_t generation = 0;
+    std::vector<std::array<size_t, 2>> dirtyRanges;
   };
 
   /**
@@ -159,7 +166,8 @@ public:
 
   /**
    * Specify the mesh data by providing a view of the mesh in memory at a given time.
-   * Make sure to add a thread synchronization mechanism if the mesh data is updated asynchronously.
+   * Make sure to add a thread synchronization mechanism if the mesh data is updated asynchronously,
+   * or use mesh_stream to publish snapshots of the mesh from another thread.
    */
   [[nodiscard]] virtual memory_view_t getMemoryView(double time) const = 0;
 
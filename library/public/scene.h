@@ -9,6 +9,7 @@
 /// @cond
 #include <cstddef>
 #include <filesystem>
+#include <memory>
 #include <string>
 #include <vector>
 /// @endcond
@@ -51,6 +52,7 @@ public:
   /**
    * Add and load provided files into the scene
    * Already added file will NOT be reloaded
+   * Pending asynchronous loads are waited for and committed first, see addAsync.
    * If it fails to loads a file, it clears the scene and
    * throw a load_failure_exception.
    * On other failures, throw a load_failure_exception.
@@ -87,6 +89,84 @@ public:
    */
   virtual scene& add(const std::byte* buffer, std::size_t size) = 0;
 
+  /**
+   * Status of a load started with addAsync.
+   */
+  enum class LoadStatus : unsigned char
+  {
+    LOADING,
+    LOADED,
+    FAILED,
+    CANCELED
+  };
+
+  /**
+   * @class   load_handle
+   * @brief   Handle on a load started with addAsync
+   *
+   * Files are read in a background thread while the current scene can still be rendered
+   * and interacted with. Once read, files are committed into the scene, which happens on the next
+   * event loop of the interactor, or when getStatus or wait is called.
+   * Like the rest of the API, the handle must be used from the thread using the engine.
+   */
+  class F3D_EXPORT load_handle
+  {
+  public:
+    /**
+     * Get the current status of the load without blocking.
+     * Commit the files into the scene if they have been read.
+     */
+    LoadStatus getStatus() const;
+
+    /**
+     * Block until the files have been read, commit them into the scene and return the status.
+     */
+    LoadStatus wait() const;
+
+    /**
+     * Get the progress of the load, between 0 and 1.
+     */
+    [[nodiscard]] double getProgress() const;
+
+    /**
+     * Request the cancellation of the load, nothing is added to the scene.
+     * Readers are aborted at their next progress report, if they check for it, and files that
+     * are not being read yet are skipped. Other importers, like USD and Alembic, cannot be
+     * interrupted: they are read to completion in the background and their result is discarded.
+     * Does nothing if the files have already been committed.
+     */
+    void cancel() const;
+
+    /**
+     * Get the error message if the load failed, an empty string otherwise.
+     */
+    [[nodiscard]] std::string getError() const;
+
+    //! @cond
+    struct internals;
+    explicit load_handle(std::shared_ptr<internals> state);
+    //! @endcond
+
+  private:
+    std::shared_ptr<internals> Internals;
+  };
+
+  ///@{
+  /**
+   * Add and load provided files into the scene asynchronously.
+   * Readers are selected immediately, throwing a load_failure_exception if a file does not exist
+   * or is not supported, then files are read in a background thread.
+   * The current scene is untouched until the files are committed, see load_handle.
+   * Loads are committed in the order they were started and before any later synchronous add.
+   * Already added files are NOT reloaded.
+   */
+  virtual load_handle addAsync(const std::vector<std::filesystem::path>& filePaths) = 0;
+  load_handle addAsync(const std::filesystem::path& filePath)
+  {
+    return this->addAsync(std::vector<std::filesystem::path>{ filePath });
+  }
+  ///@}
+
   ///@{
   /**
    * Convenience initializer list signature for add method
@@ -6,7 +6,9 @@
 #include "image.h"
 
 /// @cond
+#include <cstdint>
 #include <string>
+#include <vector>
 /// @endcond
 
 namespace f3d
@@ -119,6 +121,112 @@ public:
    */
   [[nodiscard]] virtual point3_t getDisplayFromWorld(const point3_t& worldPoint) const = 0;
 
+  /**
+   * Result of a pick.
+   * position is the picked position in world coordinates.
+   * name is the label of the picked actor, or block, in the scene hierarchy,
+   * or its node name if it has no label. It is empty if the picked prop is not part of it.
+   * accelerated is true if the acceleration structures of all the actors have been used.
+   */
+  struct pick_result_t
+  {
+    bool picked = false;
+    point3_t position = { 0.0, 0.0, 0.0 };
+    std::string name;
+    bool accelerated = false;
+  };
+
+  /**
+   * Pick the scene at a display position, in pixels from the lower left corner of the window,
+   * and return the closest picked position with the actor it belongs to.
+   * Surfaces are picked on their triangles and point clouds on the points close to the position.
+   * Acceleration structures of the visible actors are built in the background on the first pick,
+   * or after a render of an interactive window once their geometry has been stable for a while,
+   * and rebuilt when it changes, so that picking large scenes is fast.
+   * Until they are built, picking is slower but gives similar results.
+   */
+  [[nodiscard]] virtual pick_result_t pick(int x, int y) = 0;
+
+  /**
+   * Rendering times of a render pass, in seconds.
+   * Times are exclusive of the nested passes, so that the times of all passes
+   * add up to the frame times. gpu_time is negative if GPU times are not supported.
+   */
+  struct pass_stats_t
+  {
+    std::string name;
+    unsigned int depth = 0;
+    double cpu_time = 0.0;
+    double gpu_time = -1.0;
+  };
+
+  /**
+   * Rendering times of a frame, in seconds, with the stats of its render passes
+   * in rendering order. gpu_time is negative if GPU times are not supported.
+   * frame is the index of the frame since the creation of the window,
+   * 0 if no frame stats are available yet.
+   */
+  struct frame_stats_t
+  {
+    uint64_t frame = 0;
+    double cpu_time = 0.0;
+    double gpu_time = -1.0;
+    std::vector<pass_stats_t> passes;
+  };
+
+  /**
+   * Get the rendering times of the most recent frame whose GPU times are available.
+   * GPU times are read back asynchronously in order to not stall the rendering,
+   * so the returned stats are usually a few frames behind the last render.
+   * Frames rendered when only the UI needs to be updated are not included.
+   */
+  [[nodiscard]] virtual frame_stats_t getFrameStats() = 0;
+
+  /**
+   * Start a streaming capture of the rendered frames, to be used in capture loops.
+   * Frames are read back asynchronously using bufferCount frames in flight,
+   * so that reading back a frame overlaps the rendering of the next ones.
+   * Set noBackground to true to capture RGBA frames with a transparent background.
+   * Any previous capture is ended first.
+   */
+  virtual window& beginCapture(bool noBackground = false, unsigned int bufferCount = 3) = 0;
+
+  /**
+   * Render a frame and queue its readback, then provide the oldest frame of the capture
+   * whose readback was queued, if the capture is full. The provided image storage is reused
+   * when it already has the right size and number of channels, so that images can be recycled
+   * from one frame to the next.
+   * Returns true if a frame was provided, false while the capture is filling up.
+   * Frames are provided in rendering order, at most bufferCount frames after being rendered.
+   * Call beginCapture first, returns false if no capture is started.
+   */
+  virtual bool acquireFrame(image& frame) = 0;
+
+  /**
+   * Same as acquireFrame(image&) but the frame is copied into the provided buffer, which must
+   * hold at least getWidth() * getHeight() * channels bytes with 3 channels (RGB),
+   * or 4 channels (RGBA) if noBackground was set.
+   */
+  virtual bool acquireFrame(void* buffer) = 0;
+
+  /**
+   * Provide the oldest frame of the capture whose readback was queued, without rendering.
+   * Use it to get the remaining frames at the end of a capture loop.
+   * Returns false if there is no remaining frame.
+   */
+  virtual bool flushFrame(image& frame) = 0;
+
+  /**
+   * Same as flushFrame(image&) but the frame is copied into the provided buffer.
+   */
+  virtual bool flushFrame(void* buffer) = 0;
+
+  /**
+   * End the capture, discarding the frames that were not provided
+   * and releasing the capture buffers.
+   */
+  virtual window& endCapture() = 0;
+
 protected:
   //! @cond
   window() = default;
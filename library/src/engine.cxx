@@ -94,6 +94,7 @@ engine::engine(
   {
     cachePath /= "f3d";
     this->Internals->Window->SetCachePath(cachePath);
+    factory::instance()->setCachePath(cachePath.string());
   }
 
   this->Internals->Scene =
@@ -530,6 +531,7 @@ std::vector<engine::readerInformation> engine::getReadersInfo()
 engine& engine::setCachePath(const fs::path& cachePath)
 {
   this->Internals->Window->SetCachePath(cachePath);
+  factory::instance()->setCachePath(cachePath.string());
   return *this;
 }
 
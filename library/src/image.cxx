@@ -24,6 +24,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
 #include <regex>
 #include <sstream>
 #include <string>
@@ -97,6 +99,127 @@ public:
     }
   }
 
+  /**
+   * Compare self to reference and return the error, see image::compare.
+   * If diff is provided, it is set to a heatmap of the differences.
+   */
+  static double Compare(const image& self, const image& reference, image* diff)
+  {
+    const unsigned int width = self.getWidth();
+    const unsigned int height = self.getHeight();
+    const unsigned int count = self.getChannelCount();
+    const ChannelType type = self.getChannelType();
+    if (type != reference.getChannelType() || count != reference.getChannelCount() ||
+      width != reference.getWidth() || height != reference.getHeight())
+    {
+      if (diff)
+      {
+        *diff = image();
+      }
+      return 1.0;
+    }
+
+    // Most compared images are identical, compare the buffers first as it is much faster
+    // than computing the SSIM, memcmp being vectorized by the standard library
+    const size_t size = static_cast<size_t>(width) * height * count * self.getChannelTypeSize();
+    if (size == 0 || std::memcmp(self.getContent(), reference.getContent(), size) == 0)
+    {
+      if (diff)
+      {
+        *diff = image(width, height, 3);
+        std::memset(diff->getContent(), 0, static_cast<size_t>(width) * height * 3);
+      }
+      return 0.0;
+    }
+
+    vtkNew<vtkImageSSIM> ssim;
+    std::vector<int> ranges(count);
+    switch (type)
+    {
+      case ChannelType::BYTE:
+        std::ranges::fill(ranges, 256);
+        ssim->SetInputRange(ranges);
+        break;
+      case ChannelType::SHORT:
+        std::ranges::fill(ranges, 65535);
+        ssim->SetInputRange(ranges);
+        break;
+      case ChannelType::FLOAT:
+        ssim->SetInputToAuto();
+        break;
+    }
+
+    // Split the image in tiles processed in parallel by the SMP backend
+    ssim->EnableSMPOn();
+    ssim->SetInputData(self.Internals->Image);
+    ssim->SetInputData(1, reference.Internals->Image);
+    ssim->Update();
+    vtkSmartPointer<vtkDoubleArray> scalars = vtkArrayDownCast<vtkDoubleArray>(
+      vtkDataSet::SafeDownCast(ssim->GetOutputDataObject(0))->GetPointData()->GetScalars());
+
+    // Thanks to the checks above, this is always true
+    assert(scalars != nullptr);
+
+    if (diff)
+    {
+      *diff = internals::CreateHeatmap(scalars, width, height);
+    }
+
+#if VTK_VERSION_NUMBER < VTK_VERSION_CHECK(9, 6, 20260623)
+    // vtkImageSSIM::ComputeErrorMetrics didn't work for RGBA images,
+    // so we need to remove the alpha channel
+    if (count == 4)
+    {
+      const vtkIdType nbTuples = scalars->GetNumberOfTuples();
+      vtkNew<vtkDoubleArray> scalarsWithoutAlpha;
+      scalarsWithoutAlpha->SetNumberOfComponents(3);
+      scalarsWithoutAlpha->SetNumberOfTuples(nbTuples);
+      const double* in = scalars->GetPointer(0);
+      double* out = scalarsWithoutAlpha->GetPointer(0);
+      for (vtkIdType i = 0; i < nbTuples; ++i)
+      {
+        std::copy_n(in + 4 * i, 3, out + 3 * i);
+      }
+
+      scalars = scalarsWithoutAlpha;
+    }
+#endif
+
+    double error, unused;
+    vtkImageSSIM::ComputeErrorMetrics(scalars, error, unused);
+    return error;
+  }
+
+  /**
+   * Create a RGB heatmap of a SSIM map, from black for identical pixels
+   * to red, yellow and white for the most different pixels.
+   * The alpha channel, if any, is ignored.
+   */
+  static image CreateHeatmap(vtkDoubleArray* ssim, unsigned int width, unsigned int height)
+  {
+    image heatmap(width, height, 3);
+    const int nbComps = ssim->GetNumberOfComponents();
+    const int nbColorComps = nbComps == 4 ? 3 : nbComps;
+    const double* values = ssim->GetPointer(0);
+    auto* pixels = static_cast<uint8_t*>(heatmap.getContent());
+
+    const size_t nbPixels = static_cast<size_t>(width) * height;
+    for (size_t i = 0; i < nbPixels; i++)
+    {
+      double distance = 0.0;
+      for (int c = 0; c < nbColorComps; c++)
+      {
+        distance = std::max(distance, 1.0 - values[i * nbComps + c]);
+      }
+      distance = std::clamp(distance, 0.0, 1.0);
+
+      pixels[3 * i] = static_cast<uint8_t>(255.0 * std::clamp(3.0 * distance, 0.0, 1.0));
+      pixels[3 * i + 1] = static_cast<uint8_t>(255.0 * std::clamp(3.0 * distance - 1.0, 0.0, 1.0));
+      pixels[3 * i + 2] = static_cast<uint8_t>(255.0 * std::clamp(3.0 * distance - 2.0, 0.0, 1.0));
+    }
+    return heatmap;
+  }
+
   static void checkSaveFormatCompatibility(const image& self, SaveFormat format)
   {
     ChannelType type = self.getChannelType();
@@ -342,76 +465,9 @@ void* image::getContent() const
 }
 
 //----------------------------------------------------------------------------
-double image::compare(const image& reference) const
+double image::compare(const image& reference, image* diff) const
 {
-  ChannelType type = this->getChannelType();
-  if (type != reference.getChannelType())
-  {
-    return 1.0;
-  }
-
-  unsigned int count = this->getChannelCount();
-  if (count != reference.getChannelCount())
-  {
-    return 1.0;
-  }
-
-  if (this->getWidth() != reference.getWidth() || this->getHeight() != reference.getHeight())
-  {
-    return 1.0;
-  }
-
-  if (this->getWidth() == 0 && this->getHeight() == 0)
-  {
-    return 0.0;
-  }
-
-  vtkNew<vtkImageSSIM> ssim;
-  std::vector<int> ranges(count);
-  switch (type)
-  {
-    case ChannelType::BYTE:
-      std::ranges::fill(ranges, 256);
-      ssim->SetInputRange(ranges);
-      break;
-    case ChannelType::SHORT:
-      std::ranges::fill(ranges, 65535);
-      ssim->SetInputRange(ranges);
-      break;
-    case ChannelType::FLOAT:
-      ssim->SetInputToAuto();
-      break;
-  }
-
-  ssim->SetInputData(this->Internals->Image);
-  ssim->SetInputData(1, reference.Internals->Image);
-  ssim->Update();
-  vtkSmartPointer<vtkDoubleArray> scalars = vtkArrayDownCast<vtkDoubleArray>(
-    vtkDataSet::SafeDownCast(ssim->GetOutputDataObject(0))->GetPointData()->GetScalars());
-
-  // Thanks to the checks above, this is always true
-  assert(scalars != nullptr);
-
-#if VTK_VERSION_NUMBER < VTK_VERSION_CHECK(9, 6, 20260623)
-  // vtkImageSSIM::ComputeErrorMetrics didn't work for RGBA images,
-  // so we need to remove the alpha channel
-  if (count == 4)
-  {
-    vtkNew<vtkDoubleArray> scalarsWithoutAlpha;
-    scalarsWithoutAlpha->SetNumberOfComponents(3);
-    scalarsWithoutAlpha->SetNumberOfTuples(scalars->GetNumberOfTuples());
-    for (vtkIdType i = 0; i < scalars->GetNumberOfTuples(); ++i)
-    {
-      scalarsWithoutAlpha->SetTuple(i, scalars->GetTuple(i));
-    }
-
-    scalars = scalarsWithoutAlpha;
-  }
-#endif
-
-  double error, unused;
-  vtkImageSSIM::ComputeErrorMetrics(scalars, error, unused);
-  return error;
+  return internals::Compare(*this, reference, diff);
 }
 
 //----------------------------------------------------------------------------
@@ -21,13 +21,11 @@
 #include "vtkF3DUserEvents.h"
 
 #include <vtkCallbackCommand.h>
-#include <vtkCellPicker.h>
 #include <vtkGenericRenderWindowInteractor.h>
 #include <vtkMath.h>
 #include <vtkMatrix3x3.h>
 #include <vtkNew.h>
 #include <vtkPicker.h>
-#include <vtkPointPicker.h>
 #include <vtkRenderWindow.h>
 #include <vtkRenderWindowInteractor.h>
 #include <vtkRendererCollection.h>
@@ -339,26 +337,11 @@ public:
     const int sqPosDelta = xDelta * xDelta + yDelta * yDelta;
     if (sqPosDelta < self->DragDistanceTol * self->DragDistanceTol)
     {
-      const int x = self->MiddleButtonDownPosition[0];
-      const int y = self->MiddleButtonDownPosition[1];
-      vtkRenderer* renderer =
-        self->VTKInteractor->GetRenderWindow()->GetRenderers()->GetFirstRenderer();
-
-      bool pickSuccessful = false;
-      double picked[3];
-      if (self->CellPicker->Pick(x, y, 0, renderer))
-      {
-        self->CellPicker->GetPickPosition(picked);
-        pickSuccessful = true;
-      }
-      else if (self->PointPicker->Pick(x, y, 0, renderer))
-      {
-        self->PointPicker->GetPickPosition(picked);
-        pickSuccessful = true;
-      }
-
-      if (pickSuccessful)
+      const window::pick_result_t result =
+        self->Window.pick(self->MiddleButtonDownPosition[0], self->MiddleButtonDownPosition[1]);
+      if (result.picked)
       {
+        const double* picked = result.position.data();
         /*     pos.--------------------.foc
          *       /|                   /
          *      / |                  /
@@ -598,6 +581,18 @@ public:
       this->CommandBuffer.reset();
     }
 
+    // Add the content of finished asynchronous loads to the scene
+    if (this->Scene.CommitPendingLoads())
+    {
+      this->RenderRequested = true;
+    }
+
+    // Show the latest snapshots published by the producers of mesh streams
+    if (this->Scene.UpdateMeshStreams())
+    {
+      this->RenderRequested = true;
+    }
+
     this->AnimationManager->SetDeltaTime(deltaTime);
     this->AnimationManager->Tick();
 
@@ -642,9 +637,6 @@ public:
 
   std::map<std::string, std::string> AliasMap;
 
-  vtkNew<vtkCellPicker> CellPicker;
-  vtkNew<vtkPointPicker> PointPicker;
-
   int MiddleButtonDownPosition[2] = { 0, 0 };
 
   int DragDistanceTol = 3;      /* px */
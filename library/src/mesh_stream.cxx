@@ -0,0 +1,80 @@
+#include "mesh_stream.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace f3d
+{
+//----------------------------------------------------------------------------
+class mesh_stream::internals
+{
+public:
+  struct snapshot
+  {
+    memory_view_t View;
+    std::shared_ptr<const void> Owner;
+  };
+
+  // Triple buffer, the producer writes into the back snapshot, the rendering thread reads the
+  // front snapshot, and the middle one is exchanged atomically with either of them.
+  // The middle index carries a flag telling if it has been published and not acquired yet.
+  static constexpr uint8_t IndexMask = 0x3;
+  static constexpr uint8_t NewSnapshotFlag = 0x4;
+
+  std::array<snapshot, 3> Snapshots;
+  uint8_t Back = 0;
+  uint8_t Front = 1;
+  std::atomic<uint8_t> Middle = 2;
+};
+
+//----------------------------------------------------------------------------
+mesh_stream::mesh_stream()
+  : Internals(std::make_unique<mesh_stream::internals>())
+{
+}
+
+//----------------------------------------------------------------------------
+mesh_stream::~mesh_stream() = default;
+
+//----------------------------------------------------------------------------
+void mesh_stream::publish(const memory_view_t& view, std::shared_ptr<const void> owner)
+{
+  // The previous content of the back snapshot, and its owner, are released here
+  internals::snapshot& back = this->Internals->Snapshots[this->Internals->Back];
+  back.View = view;
+  back.Owner = std::move(owner);
+
+  const uint8_t previous = this->Internals->Middle.exchange(
+    static_cast<uint8_t>(this->Internals->Back | internals::NewSnapshotFlag),
+    std::memory_order_acq_rel);
+  this->Internals->Back = previous & internals::IndexMask;
+}
+
+//----------------------------------------------------------------------------
+bool mesh_stream::hasNewSnapshot() const
+{
+  return (this->Internals->Middle.load(std::memory_order_acquire) & internals::NewSnapshotFlag) !=
+    0;
+}
+
+//----------------------------------------------------------------------------
+bool mesh_stream::acquireSnapshot()
+{
+  if (!this->hasNewSnapshot())
+  {
+    return false;
+  }
+
+  const uint8_t previous =
+    this->Internals->Middle.exchange(this->Internals->Front, std::memory_order_acq_rel);
+  this->Internals->Front = previous & internals::IndexMask;
+  return true;
+}
+
+//----------------------------------------------------------------------------
+mesh_view::memory_view_t mesh_stream::getMemoryView(double) const
+{
+  return this->Internals->Snapshots[this->Internals->Front].View;
+}
+}
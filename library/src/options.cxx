@@ -101,6 +101,12 @@ bool options::isSame(const options& other, std::string_view name) const
   }
 }
 
+//----------------------------------------------------------------------------
+std::vector<std::string> options::getChangedNames(const options& other) const
+{
+  return options_generated::getChangedNames(*this, other);
+}
+
 //----------------------------------------------------------------------------
 bool options::hasValue(std::string_view name) const
 {
@@ -3,11 +3,13 @@
 #include "animationManager.h"
 #include "interactor_impl.h"
 #include "log.h"
+#include "mesh_stream.h"
 #include "options.h"
 #include "scene.h"
 #include "window_impl.h"
 
 #include "F3DStyle.h"
+#include "F3DTrace.h"
 #include "factory.h"
 #include "vtkF3DGenericImporter.h"
 #include "vtkF3DMemoryMesh.h"
@@ -15,6 +17,7 @@
 #include "vtkF3DRenderer.h"
 
 #include <optional>
+#include <vtkAlgorithm.h>
 #include <vtkCallbackCommand.h>
 #include <vtkCellArray.h>
 #include <vtkCellData.h>
@@ -35,11 +38,189 @@
 #include <vtkStridedArray.h>
 #endif
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
 #include <numeric>
+#include <thread>
 #include <vector>
 
 namespace fs = std::filesystem;
 
+namespace
+{
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251110)
+/**
+ * A mesh_view array and the VTK array wrapping it, kept between updates so that the wrapper
+ * is reused as long as the layout of the array does not change
+ */
+struct MeshViewArray
+{
+  const void* Data = nullptr;
+  f3d::mesh_view::data_type Type = f3d::mesh_view::data_type::F32;
+  size_t Components = 0;
+  size_t Stride = 0;
+  vtkIdType Count = 0;
+  uint64_t Generation = 0;
+  vtkSmartPointer<vtkDataArray> Array;
+};
+using MeshViewArrays = std::map<std::string, MeshViewArray>;
+
+/**
+ * Update the wrapper of the mesh_view array identified by key.
+ * If the array is new or its layout changed, a new wrapper is created using createArray
+ * and returned. Otherwise, nullptr is returned and the existing wrapper is kept, marked as
+ * modified with the dirty ranges of the array if its generation changed.
+ */
+vtkDataArray* UpdateMeshViewArray(MeshViewArrays& arrays, const std::string& key,
+  const f3d::mesh_view::data_array_t& view, vtkIdType count,
+  const std::function<vtkSmartPointer<vtkDataArray>()>& createArray)
+{
+  MeshViewArray& array = arrays[key];
+  if (array.Array && array.Data == view.data && array.Type == view.type &&
+    array.Components == view.components && array.Stride == view.stride && array.Count == count)
+  {
+    if (view.timeDependent && (view.generation == 0 || view.generation != array.Generation))
+    {
+      std::vector<std::array<vtkIdType, 2>> ranges;
+      for (const auto& [begin, end] : view.dirtyRanges)
+      {
+        if (begin > end || end > static_cast<size_t>(count))
+        {
+          throw f3d::scene::load_failure_exception(
+            "Mesh view dirty ranges must be ranges of tuples of the array");
+        }
+        ranges.push_back({ static_cast<vtkIdType>(begin), static_cast<vtkIdType>(end) });
+      }
+      vtkF3DMemoryMesh::SetDirtyRanges(array.Array, ranges);
+      array.Generation = view.generation;
+    }
+    return nullptr;
+  }
+
+  array = { view.data, view.type, view.components, view.stride, count, view.generation,
+    createArray() };
+  return array.Array;
+}
+#endif
+}
+
+namespace f3d
+{
+//----------------------------------------------------------------------------
+struct scene::load_handle::internals
+{
+  std::vector<std::pair<std::string, vtkSmartPointer<vtkImporter>>> Importers;
+  std::vector<vtkSmartPointer<vtkRenderWindow>> StagingWindows;
+  std::vector<std::pair<vtkSmartPointer<vtkObject>, vtkSmartPointer<vtkCallbackCommand>>>
+    Observers;
+  size_t NumberOfImporters = 0;
+  std::unique_ptr<std::atomic<double>[]> Progress;
+
+  // Camera index local to the first importer, as ReadStaged expects it.
+  // When a camera index is requested while other loads are pending, it is only known once the
+  // previous load has been committed or dropped, so it is resolved by the worker.
+  vtkIdType CameraIndex = -1;
+  std::shared_ptr<internals> Previous;
+  vtkIdType NumberOfCameras = 0;
+
+  std::thread Worker;
+  std::mutex Mutex;
+  std::condition_variable ReadCondition; // Notified when ReadDone or Status changes
+  bool ReadDone = false;
+  std::string Error;
+
+  std::atomic<bool> CancelRequested = false;
+  std::atomic<LoadStatus> Status = LoadStatus::LOADING;
+
+  // Reset when the scene is destroyed
+  detail::scene_impl* Scene = nullptr;
+
+  /**
+   * Set the status if the load is still loading and notify the workers waiting on it
+   */
+  void SetStatus(LoadStatus status)
+  {
+    std::scoped_lock lock(this->Mutex);
+    LoadStatus expected = LoadStatus::LOADING;
+    this->Status.compare_exchange_strong(expected, status);
+    this->ReadCondition.notify_all();
+  }
+};
+
+//----------------------------------------------------------------------------
+scene::load_handle::load_handle(std::shared_ptr<internals> state)
+  : Internals(std::move(state))
+{
+}
+
+//----------------------------------------------------------------------------
+scene::LoadStatus scene::load_handle::getStatus() const
+{
+  bool readDone = false;
+  {
+    std::scoped_lock lock(this->Internals->Mutex);
+    readDone = this->Internals->ReadDone;
+  }
+  if (readDone && this->Internals->Scene)
+  {
+    this->Internals->Scene->CommitPendingLoads();
+  }
+  return this->Internals->Status;
+}
+
+//----------------------------------------------------------------------------
+scene::LoadStatus scene::load_handle::wait() const
+{
+  {
+    std::unique_lock lock(this->Internals->Mutex);
+    this->Internals->ReadCondition.wait(lock, [&]() { return this->Internals->ReadDone; });
+  }
+  if (this->Internals->Scene)
+  {
+    this->Internals->Scene->CommitPendingLoads(this->Internals.get());
+  }
+  return this->Internals->Status;
+}
+
+//----------------------------------------------------------------------------
+double scene::load_handle::getProgress() const
+{
+  if (this->Internals->Status == LoadStatus::LOADED)
+  {
+    return 1.0;
+  }
+  size_t nbImporters = this->Internals->NumberOfImporters;
+  if (nbImporters == 0)
+  {
+    return 0.0;
+  }
+  double progress = 0.0;
+  for (size_t i = 0; i < nbImporters; i++)
+  {
+    progress += this->Internals->Progress[i];
+  }
+  return progress / static_cast<double>(nbImporters);
+}
+
+//----------------------------------------------------------------------------
+void scene::load_handle::cancel() const
+{
+  this->Internals->CancelRequested = true;
+  this->Internals->SetStatus(LoadStatus::CANCELED);
+}
+
+//----------------------------------------------------------------------------
+std::string scene::load_handle::getError() const
+{
+  std::scoped_lock lock(this->Internals->Mutex);
+  return this->Internals->Error;
+}
+}
+
 namespace f3d::detail
 {
 class scene_impl::internals
@@ -102,11 +283,20 @@ public:
     data->timer->StartTimer();
   }
 
-  void Load(const std::vector<std::pair<std::string, vtkSmartPointer<vtkImporter>>>& importers)
+  void Load(const std::vector<std::pair<std::string, vtkSmartPointer<vtkImporter>>>& importers,
+    const std::vector<vtkSmartPointer<vtkRenderWindow>>& stagingWindows = {})
   {
-    for (const auto& importer : importers)
+    F3D_TRACE_SCOPE("Load");
+    for (size_t i = 0; i < importers.size(); i++)
     {
-      this->MetaImporter->AddImporter(importer);
+      if (stagingWindows.empty())
+      {
+        this->MetaImporter->AddImporter(importers[i]);
+      }
+      else
+      {
+        this->MetaImporter->AddImporter(importers[i], stagingWindows[i]);
+      }
     }
 
     // Initialize the camera on load
@@ -200,12 +390,181 @@ public:
     window.PrintSceneDescription(log::VerboseLevel::DEBUG);
   }
 
+  /**
+   * Importers are serialized with one another unless their reader declares them thread safe
+   */
+  static void DeclareThreadSafety(vtkImporter* importer, const f3d::reader* reader)
+  {
+    vtkF3DImporter* f3dImporter = vtkF3DImporter::SafeDownCast(importer);
+    if (f3dImporter)
+    {
+      f3dImporter->SetThreadSafe(reader->isThreadSafe());
+    }
+  }
+
+  std::vector<std::pair<std::string, vtkSmartPointer<vtkImporter>>> CreateImporters(
+    const std::vector<fs::path>& filePaths)
+  {
+    std::vector<std::pair<std::string, vtkSmartPointer<vtkImporter>>> importers;
+    for (const fs::path& filePath : filePaths)
+    {
+      if (filePath.empty())
+      {
+        log::debug("An empty file to load was provided\n");
+        continue;
+      }
+
+      F3D_TRACE_SCOPE_DETAIL("Create importer", filePath.string());
+
+      if (!vtksys::SystemTools::FileExists(filePath.string(), true))
+      {
+        throw scene::load_failure_exception(filePath.string() + " does not exists");
+      }
+      std::optional<std::string> forceReader = this->Options.scene.force_reader;
+      // Recover the importer for the provided file path
+      const f3d::reader* reader =
+        f3d::factory::instance()->getReader(filePath.string(), forceReader);
+      if (reader)
+      {
+        if (forceReader)
+        {
+          log::debug("Forcing reader ", (*forceReader), " for ", filePath.string());
+        }
+        else
+        {
+          log::debug(
+            "Found a reader for \"", filePath.string(), "\" : \"", reader->getName(), "\"");
+        }
+      }
+      else
+      {
+        if (forceReader)
+        {
+          throw scene::load_failure_exception(*forceReader + " is not a valid force reader");
+        }
+        throw scene::load_failure_exception(filePath.string() +
+          " is not a file of a supported 3D scene file format, use force reader to force a "
+          "specific reader");
+      }
+
+      vtkSmartPointer<vtkImporter> importer = reader->createSceneReader(filePath.string());
+      if (!importer)
+      {
+        // XXX: F3D Plugin CMake logic ensure there is either a scene reader or a geometry reader
+        auto vtkReader = reader->createGeometryReader(filePath.string());
+        assert(vtkReader);
+        vtkSmartPointer<vtkF3DGenericImporter> genericImporter =
+          vtkSmartPointer<vtkF3DGenericImporter>::New();
+        genericImporter->SetInternalReader(vtkReader);
+        importer = genericImporter;
+      }
+      scene_impl::internals::DeclareThreadSafety(importer, reader);
+      importers.emplace_back(filePath.filename().string(), importer);
+    }
+
+    log::debug("\nLoading files: ");
+    if (filePaths.size() == 1)
+    {
+      log::debug(filePaths[0].string());
+    }
+    else
+    {
+      for (const fs::path& filePathStr : filePaths)
+      {
+        log::debug("- ", filePathStr.string());
+      }
+    }
+    log::debug("");
+
+    return importers;
+  }
+
+  /**
+   * Read the importers of an asynchronous load, run in a worker thread
+   */
+  static void ReadAsync(scene::load_handle::internals* state)
+  {
+    F3DTrace::SetThreadName("async loader");
+
+    if (state->Previous)
+    {
+      // Wait for the previous load to be read and committed or dropped to know
+      // how many cameras precede this one
+      std::shared_ptr<scene::load_handle::internals> previous = std::move(state->Previous);
+      std::unique_lock lock(previous->Mutex);
+      while (!previous->ReadCondition.wait_for(lock, std::chrono::milliseconds(50),
+        [&]() { return previous->ReadDone && previous->Status != LoadStatus::LOADING; }))
+      {
+        if (state->CancelRequested)
+        {
+          break;
+        }
+      }
+      state->CameraIndex = previous->CameraIndex -
+        (previous->Status == LoadStatus::LOADED ? previous->NumberOfCameras : 0);
+    }
+
+    std::vector<vtkImporter*> importers;
+    for (const auto& importer : state->Importers)
+    {
+      importers.emplace_back(importer.second);
+    }
+
+    std::vector<vtkSmartPointer<vtkRenderWindow>> windows;
+    std::string error;
+    vtkIdType nbCameras = 0;
+    try
+    {
+      windows = vtkF3DMetaImporter::ReadStaged(
+        importers, state->CameraIndex, nullptr, &state->CancelRequested);
+      if (state->CancelRequested)
+      {
+        error = "load canceled";
+      }
+      else if (windows.empty())
+      {
+        error = "failed to load scene";
+      }
+      for (vtkImporter* importer : importers)
+      {
+        nbCameras += importer->GetNumberOfCameras();
+      }
+    }
+    catch (const std::exception& ex)
+    {
+      error = ex.what();
+    }
+    catch (...)
+    {
+      error = "unknown exception while loading";
+    }
+
+    std::scoped_lock lock(state->Mutex);
+    state->NumberOfCameras = nbCameras;
+    state->StagingWindows = std::move(windows);
+    state->Error = std::move(error);
+    state->ReadDone = true;
+    state->ReadCondition.notify_all();
+  }
+
   options& Options;
   window_impl& Window;
   interactor_impl* Interactor = nullptr;
   animationManager AnimationManager;
 
   vtkNew<vtkF3DMetaImporter> MetaImporter;
+
+  // Asynchronous loads, in the order they were started
+  std::vector<std::shared_ptr<scene::load_handle::internals>> PendingLoads;
+
+  // Mesh streams added to the scene, with the source and importer to update with new snapshots
+  struct MeshStream
+  {
+    std::shared_ptr<mesh_stream> Stream;
+    vtkSmartPointer<vtkF3DMemoryMesh> Source;
+    vtkSmartPointer<vtkF3DGenericImporter> Importer;
+  };
+  std::vector<MeshStream> MeshStreams;
 };
 
 //----------------------------------------------------------------------------
@@ -215,7 +574,10 @@ scene_impl::scene_impl(options& options, window_impl& window)
 }
 
 //----------------------------------------------------------------------------
-scene_impl::~scene_impl() = default;
+scene_impl::~scene_impl()
+{
+  this->CancelPendingLoads();
+}
 
 //----------------------------------------------------------------------------
 scene& scene_impl::add(const fs::path& filePath)
@@ -241,74 +603,229 @@ scene& scene_impl::add(const std::vector<fs::path>& filePaths)
     return *this;
   }
 
-  std::vector<std::pair<std::string, vtkSmartPointer<vtkImporter>>> importers;
-  for (const fs::path& filePath : filePaths)
+  std::vector<std::pair<std::string, vtkSmartPointer<vtkImporter>>> importers =
+    this->Internals->CreateImporters(filePaths);
+  this->CommitAllPendingLoads();
+  this->Internals->Load(importers);
+  return *this;
+}
+
+//----------------------------------------------------------------------------
+scene::load_handle scene_impl::addAsync(const std::vector<fs::path>& filePaths)
+{
+  auto state = std::make_shared<scene::load_handle::internals>();
+  state->Importers = this->Internals->CreateImporters(filePaths);
+
+#ifdef __EMSCRIPTEN__
+  // Loads are read right away, commit the previous ones so that no load waits on another
+  this->CommitPendingLoads();
+#endif
+
+  // Camera index local to the first added importer, as ReadStaged expects it.
+  // Synchronous adds commit pending loads first, so only pending loads can precede this one.
+  if (this->Internals->Options.scene.camera.index.has_value())
   {
-    if (filePath.empty())
+    state->CameraIndex = this->Internals->Options.scene.camera.index.value() -
+      this->Internals->MetaImporter->GetNumberOfCameras();
+    if (!this->Internals->PendingLoads.empty())
     {
-      log::debug("An empty file to load was provided\n");
-      continue;
+      state->Previous = this->Internals->PendingLoads.back();
     }
+  }
+
+  // Record progress and abort readers in their progress callbacks when canceled
+  const size_t nbImporters = state->Importers.size();
+  state->NumberOfImporters = nbImporters;
+  state->Progress = std::make_unique<std::atomic<double>[]>(nbImporters);
+  for (size_t i = 0; i < nbImporters; i++)
+  {
+    state->Progress[i] = 0.0;
+
+    vtkNew<vtkCallbackCommand> progressCallback;
+    progressCallback->SetClientData(&state->Progress[i]);
+    progressCallback->SetCallback(
+      [](vtkObject*, unsigned long, void* clientData, void* callData)
+      {
+        *static_cast<std::atomic<double>*>(clientData) = *static_cast<double*>(callData);
+      });
+    vtkImporter* importer = state->Importers[i].second;
+    importer->AddObserver(vtkCommand::ProgressEvent, progressCallback);
+    state->Observers.emplace_back(importer, progressCallback);
 
-    if (!vtksys::SystemTools::FileExists(filePath.string(), true))
+    // Only readers can be aborted, other importers are read to completion, their result is
+    // discarded. The pipeline resets the abort flag before executing, so it is set from within
+    // the progress events.
+    vtkF3DGenericImporter* genericImporter = vtkF3DGenericImporter::SafeDownCast(importer);
+    vtkAlgorithm* reader = genericImporter ? genericImporter->GetInternalReader() : nullptr;
+    if (reader)
     {
-      throw scene::load_failure_exception(filePath.string() + " does not exists");
+      vtkNew<vtkCallbackCommand> abortCallback;
+      abortCallback->SetClientData(&state->CancelRequested);
+      abortCallback->SetCallback(
+        [](vtkObject* caller, unsigned long, void* clientData, void*)
+        {
+          if (*static_cast<std::atomic<bool>*>(clientData))
+          {
+            static_cast<vtkAlgorithm*>(caller)->AbortExecuteOn();
+          }
+        });
+      reader->AddObserver(vtkCommand::ProgressEvent, abortCallback);
+      state->Observers.emplace_back(reader, abortCallback);
     }
-    std::optional<std::string> forceReader = this->Internals->Options.scene.force_reader;
-    // Recover the importer for the provided file path
-    const f3d::reader* reader = f3d::factory::instance()->getReader(filePath.string(), forceReader);
-    if (reader)
+  }
+
+  if (nbImporters == 0)
+  {
+    state->ReadDone = true;
+    state->Status = LoadStatus::LOADED;
+    return scene::load_handle(state);
+  }
+
+  state->Scene = this;
+#ifdef __EMSCRIPTEN__
+  // No thread support, read right away
+  scene_impl::internals::ReadAsync(state.get());
+#else
+  state->Worker = std::thread(&scene_impl::internals::ReadAsync, state.get());
+#endif
+  this->Internals->PendingLoads.emplace_back(state);
+  return scene::load_handle(state);
+}
+
+//----------------------------------------------------------------------------
+bool scene_impl::CommitPendingLoads(scene::load_handle::internals* until)
+{
+  bool committed = false;
+  auto& pendingLoads = this->Internals->PendingLoads;
+  while (!pendingLoads.empty())
+  {
+    // Commit in the order loads were started
+    std::shared_ptr<scene::load_handle::internals> state = pendingLoads.front();
     {
-      if (forceReader)
+      std::unique_lock lock(state->Mutex);
+      if (until)
       {
-        log::debug("Forcing reader ", (*forceReader), " for ", filePath.string());
+        state->ReadCondition.wait(lock, [&]() { return state->ReadDone; });
       }
-      else
+      else if (!state->ReadDone)
       {
-        log::debug("Found a reader for \"", filePath.string(), "\" : \"", reader->getName(), "\"");
+        break;
       }
     }
+
+    if (state->Worker.joinable())
+    {
+      state->Worker.join();
+    }
+    pendingLoads.erase(pendingLoads.begin());
+    state->Scene = nullptr;
+
+    for (const auto& [object, callback] : state->Observers)
+    {
+      object->RemoveObserver(callback);
+    }
+    state->Observers.clear();
+
+    if (state->CancelRequested)
+    {
+      state->SetStatus(LoadStatus::CANCELED);
+    }
+    else if (!state->Error.empty())
+    {
+      log::error("Asynchronous load failed: ", state->Error);
+      state->SetStatus(LoadStatus::FAILED);
+    }
     else
     {
-      if (forceReader)
+      try
       {
-        throw scene::load_failure_exception(*forceReader + " is not a valid force reader");
+        this->Internals->Load(state->Importers, state->StagingWindows);
+        state->SetStatus(LoadStatus::LOADED);
+        committed = true;
+      }
+      catch (const scene::load_failure_exception& ex)
+      {
+        {
+          std::scoped_lock lock(state->Mutex);
+          state->Error = ex.what();
+        }
+        state->SetStatus(LoadStatus::FAILED);
       }
-      throw scene::load_failure_exception(filePath.string() +
-        " is not a file of a supported 3D scene file format, use force reader to force a specific "
-        "reader");
     }
 
-    vtkSmartPointer<vtkImporter> importer = reader->createSceneReader(filePath.string());
-    if (!importer)
+    // Release the importers, and the files they may hold, of dropped loads
+    state->StagingWindows.clear();
+    if (state->Status != LoadStatus::LOADED)
     {
-      // XXX: F3D Plugin CMake logic ensure there is either a scene reader or a geometry reader
-      auto vtkReader = reader->createGeometryReader(filePath.string());
-      assert(vtkReader);
-      vtkSmartPointer<vtkF3DGenericImporter> genericImporter =
-        vtkSmartPointer<vtkF3DGenericImporter>::New();
-      genericImporter->SetInternalReader(vtkReader);
-      importer = genericImporter;
+      state->Importers.clear();
+    }
+
+    if (state.get() == until)
+    {
+      break;
     }
-    importers.emplace_back(filePath.filename().string(), importer);
   }
+  return committed;
+}
 
-  log::debug("\nLoading files: ");
-  if (filePaths.size() == 1)
+//----------------------------------------------------------------------------
+bool scene_impl::UpdateMeshStreams()
+{
+  bool updated = false;
+  for (const auto& meshStream : this->Internals->MeshStreams)
   {
-    log::debug(filePaths[0].string());
+    if (!meshStream.Stream->acquireSnapshot())
+    {
+      continue;
+    }
+
+    // Force the source to read the new snapshot
+    meshStream.Source->Modified();
+    try
+    {
+      if (this->Internals->MetaImporter->UpdateGenericImporter(meshStream.Importer))
+      {
+        updated = true;
+      }
+    }
+    catch (const load_failure_exception& ex)
+    {
+      log::error("Failed to update mesh stream: ", ex.what());
+    }
   }
-  else
+  return updated;
+}
+
+//----------------------------------------------------------------------------
+void scene_impl::CancelPendingLoads()
+{
+  for (const auto& state : this->Internals->PendingLoads)
   {
-    for (const fs::path& filePathStr : filePaths)
+    state->CancelRequested = true;
+    state->SetStatus(LoadStatus::CANCELED);
+    if (state->Worker.joinable())
     {
-      log::debug("- ", filePathStr.string());
+      state->Worker.join();
     }
+    state->Scene = nullptr;
+    for (const auto& [object, callback] : state->Observers)
+    {
+      object->RemoveObserver(callback);
+    }
+    state->Observers.clear();
+    state->StagingWindows.clear();
+    state->Importers.clear();
   }
-  log::debug("");
+  this->Internals->PendingLoads.clear();
+}
 
-  this->Internals->Load(importers);
-  return *this;
+//----------------------------------------------------------------------------
+void scene_impl::CommitAllPendingLoads()
+{
+  if (!this->Internals->PendingLoads.empty())
+  {
+    this->CommitPendingLoads(this->Internals->PendingLoads.back().get());
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -370,8 +887,10 @@ scene& scene_impl::add(const std::byte* buffer, std::size_t size)
     genericImporter->SetInternalReader(vtkReader);
     importer = genericImporter;
   }
+  scene_impl::internals::DeclareThreadSafety(importer, reader);
 
   log::debug("\nLoading stream");
+  this->CommitAllPendingLoads();
   this->Internals->Load({ { "<stream>", importer } });
   return *this;
 }
@@ -446,6 +965,7 @@ scene& scene_impl::add(const mesh_t& mesh)
   importer->SetInternalReader(vtkSource);
 
   log::debug("Loading 3D scene from memory");
+  this->CommitAllPendingLoads();
   this->Internals->Load({ { "<mesh>", importer } });
   return *this;
 }
@@ -467,6 +987,17 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
   auto timeRange = mesh->getTimeRange();
   vtkSource->SetTimeRange(timeRange[0], timeRange[1]);
 
+  // A mesh stream is first loaded with its latest snapshot
+  // then updated by the interactor event loop when new snapshots are published
+  auto stream = std::dynamic_pointer_cast<mesh_stream>(mesh);
+  if (stream)
+  {
+    stream->acquireSnapshot();
+  }
+
+  // wrappers of the mesh_view arrays, reused across updates
+  auto arrays = std::make_shared<::MeshViewArrays>();
+
   vtkSource->SetUpdateFunction(
     [=](double time, vtkPolyData* polydata)
     {
@@ -498,29 +1029,33 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
         throw scene::load_failure_exception("Mesh view points must have 3 components");
       }
 
-      if (firstTime || memoryView.points.timeDependent)
+      const auto pointCount = static_cast<vtkIdType>(memoryView.pointCount);
+      vtkDataArray* positions = ::UpdateMeshViewArray(*arrays, "points", memoryView.points,
+        pointCount,
+        [&]()
+        {
+          return f3d::mesh_view::dataTypeDispatch(memoryView.points.type,
+            [&]<typename DataT>() -> vtkSmartPointer<vtkDataArray>
+            {
+              vtkNew<vtkStridedArray<DataT>> array;
+              array->SetName(
+                memoryView.points.name.empty() ? "Positions" : memoryView.points.name.c_str());
+              array->SetNumberOfComponents(3);
+              array->SetNumberOfTuples(pointCount);
+              array->ConstructBackend(reinterpret_cast<const DataT*>(memoryView.points.data),
+                memoryView.points.stride, 3);
+              return array;
+            });
+        });
+      if (positions)
       {
         vtkNew<vtkPoints> points;
-
-        f3d::mesh_view::dataTypeDispatch(memoryView.points.type,
-          [&]<typename DataT>()
-          {
-            vtkNew<vtkStridedArray<DataT>> positions;
-            positions->SetName(
-              memoryView.points.name.empty() ? "Positions" : memoryView.points.name.c_str());
-            positions->SetNumberOfComponents(3);
-            positions->SetNumberOfTuples(memoryView.pointCount);
-            positions->ConstructBackend(
-              reinterpret_cast<const DataT*>(memoryView.points.data), memoryView.points.stride, 3);
-
-            points->SetData(positions);
-          });
-
+        points->SetData(positions);
         polydata->SetPoints(points);
       }
 
       // handle normals if provided
-      if (memoryView.normals.data != nullptr && (firstTime || memoryView.normals.timeDependent))
+      if (memoryView.normals.data != nullptr)
       {
         if (memoryView.normals.type != mesh_view::data_type::F32 &&
           memoryView.normals.type != mesh_view::data_type::F64)
@@ -534,24 +1069,31 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
           throw scene::load_failure_exception("Mesh view normals must have 3 components");
         }
 
-        f3d::mesh_view::dataTypeDispatch(memoryView.normals.type,
-          [&]<typename DataT>()
+        vtkDataArray* normals = ::UpdateMeshViewArray(*arrays, "normals", memoryView.normals,
+          pointCount,
+          [&]()
           {
-            vtkNew<vtkStridedArray<DataT>> normals;
-            normals->SetName(
-              memoryView.normals.name.empty() ? "Normals" : memoryView.normals.name.c_str());
-            normals->SetNumberOfComponents(3);
-            normals->SetNumberOfTuples(memoryView.pointCount);
-            normals->ConstructBackend(reinterpret_cast<const DataT*>(memoryView.normals.data),
-              memoryView.normals.stride, 3);
-
-            polydata->GetPointData()->SetNormals(normals);
+            return f3d::mesh_view::dataTypeDispatch(memoryView.normals.type,
+              [&]<typename DataT>() -> vtkSmartPointer<vtkDataArray>
+              {
+                vtkNew<vtkStridedArray<DataT>> array;
+                array->SetName(
+                  memoryView.normals.name.empty() ? "Normals" : memoryView.normals.name.c_str());
+                array->SetNumberOfComponents(3);
+                array->SetNumberOfTuples(pointCount);
+                array->ConstructBackend(reinterpret_cast<const DataT*>(memoryView.normals.data),
+                  memoryView.normals.stride, 3);
+                return array;
+              });
           });
+        if (normals)
+        {
+          polydata->GetPointData()->SetNormals(normals);
+        }
       }
 
       // handle texture coordinates if provided
-      if ((firstTime || memoryView.textureCoordinates.timeDependent) &&
-        memoryView.textureCoordinates.data != nullptr)
+      if (memoryView.textureCoordinates.data != nullptr)
       {
         if (memoryView.textureCoordinates.type != mesh_view::data_type::F32 &&
           memoryView.textureCoordinates.type != mesh_view::data_type::F64)
@@ -566,65 +1108,72 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
             "Mesh view texture coordinates must have 2 components");
         }
 
-        f3d::mesh_view::dataTypeDispatch(memoryView.textureCoordinates.type,
-          [&]<typename DataT>()
+        vtkDataArray* tcoords = ::UpdateMeshViewArray(*arrays, "tcoords",
+          memoryView.textureCoordinates, pointCount,
+          [&]()
           {
-            vtkNew<vtkStridedArray<DataT>> tcoords;
-            tcoords->SetName(memoryView.textureCoordinates.name.empty()
-                ? "TCoords"
-                : memoryView.textureCoordinates.name.c_str());
-            tcoords->SetNumberOfComponents(2);
-            tcoords->SetNumberOfTuples(memoryView.pointCount);
-            tcoords->ConstructBackend(
-              reinterpret_cast<const DataT*>(memoryView.textureCoordinates.data),
-              memoryView.textureCoordinates.stride, 2);
-
-            polydata->GetPointData()->SetTCoords(tcoords);
+            return f3d::mesh_view::dataTypeDispatch(memoryView.textureCoordinates.type,
+              [&]<typename DataT>() -> vtkSmartPointer<vtkDataArray>
+              {
+                vtkNew<vtkStridedArray<DataT>> array;
+                array->SetName(memoryView.textureCoordinates.name.empty()
+                    ? "TCoords"
+                    : memoryView.textureCoordinates.name.c_str());
+                array->SetNumberOfComponents(2);
+                array->SetNumberOfTuples(pointCount);
+                array->ConstructBackend(
+                  reinterpret_cast<const DataT*>(memoryView.textureCoordinates.data),
+                  memoryView.textureCoordinates.stride, 2);
+                return array;
+              });
           });
+        if (tcoords)
+        {
+          polydata->GetPointData()->SetTCoords(tcoords);
+        }
       }
 
       // handle scalars if provided
+      auto createScalars = [](const f3d::mesh_view::data_array_t& scalar, vtkIdType count)
+      {
+        return f3d::mesh_view::dataTypeDispatch(scalar.type,
+          [&]<typename DataT>() -> vtkSmartPointer<vtkDataArray>
+          {
+            vtkNew<vtkStridedArray<DataT>> scalars;
+            scalars->SetName(scalar.name.c_str());
+            scalars->SetNumberOfComponents(static_cast<int>(scalar.components));
+            scalars->SetNumberOfTuples(count);
+            scalars->ConstructBackend(reinterpret_cast<const DataT*>(scalar.data), scalar.stride,
+              static_cast<int>(scalar.components));
+            return scalars;
+          });
+      };
+
       for (const auto& scalar : memoryView.pointScalars)
       {
-        if (firstTime || scalar.timeDependent)
+        if (vtkDataArray* scalars =
+              ::UpdateMeshViewArray(*arrays, "point:" + scalar.name, scalar, pointCount,
+                [&]() { return createScalars(scalar, pointCount); }))
         {
-          f3d::mesh_view::dataTypeDispatch(scalar.type,
-            [&]<typename DataT>()
-            {
-              vtkNew<vtkStridedArray<DataT>> scalars;
-              scalars->SetName(scalar.name.c_str());
-              scalars->SetNumberOfComponents(static_cast<int>(scalar.components));
-              scalars->SetNumberOfTuples(memoryView.pointCount);
-              scalars->ConstructBackend(reinterpret_cast<const DataT*>(scalar.data), scalar.stride,
-                static_cast<int>(scalar.components));
-
-              polydata->GetPointData()->AddArray(scalars);
-            });
+          polydata->GetPointData()->AddArray(scalars);
         }
       }
 
+      const auto cellCount = static_cast<vtkIdType>(memoryView.vertices.offsetCount +
+        memoryView.lines.offsetCount + memoryView.polygons.offsetCount - 3);
       for (const auto& scalar : memoryView.cellScalars)
       {
-        if (firstTime || scalar.timeDependent)
+        if (vtkDataArray* scalars =
+              ::UpdateMeshViewArray(*arrays, "cell:" + scalar.name, scalar, cellCount,
+                [&]() { return createScalars(scalar, cellCount); }))
         {
-          f3d::mesh_view::dataTypeDispatch(scalar.type,
-            [&]<typename DataT>()
-            {
-              vtkNew<vtkStridedArray<DataT>> scalars;
-              scalars->SetName(scalar.name.c_str());
-              scalars->SetNumberOfComponents(static_cast<int>(scalar.components));
-              scalars->SetNumberOfTuples(memoryView.vertices.offsetCount +
-                memoryView.lines.offsetCount + memoryView.polygons.offsetCount - 3);
-              scalars->ConstructBackend(reinterpret_cast<const DataT*>(scalar.data), scalar.stride,
-                static_cast<int>(scalar.components));
-
-              polydata->GetCellData()->AddArray(scalars);
-            });
+          polydata->GetCellData()->AddArray(scalars);
         }
       }
 
-      auto handleCells =
-        [](const f3d::mesh_view::cell_array_t& cells) -> vtkSmartPointer<vtkCellArray>
+      // the current cell array is kept if its offsets and indices wrappers are reused
+      auto handleCells = [&](const f3d::mesh_view::cell_array_t& cells, const std::string& key,
+                           vtkCellArray* current) -> vtkSmartPointer<vtkCellArray>
       {
         if (cells.offsetCount <= 0)
         {
@@ -634,6 +1183,8 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
 
         if (cells.offsetCount == 1) // means there is no cell
         {
+          arrays->erase(key + ":offsets");
+          arrays->erase(key + ":indices");
           return nullptr;
         }
 
@@ -680,46 +1231,59 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
               // for VTK
               using IndexingType = std::make_signed_t<DataT>;
 
-              vtkNew<vtkCellArray> cellArray;
+              const vtkMTimeType currentMTime = current ? current->GetMTime() : 0;
+
+              vtkDataArray* faceOffsets = ::UpdateMeshViewArray(*arrays, key + ":offsets",
+                cells.offsets, static_cast<vtkIdType>(cells.offsetCount),
+                [&]() -> vtkSmartPointer<vtkDataArray>
+                {
+                  vtkNew<vtkStridedArray<IndexingType>> array;
+                  array->SetName(
+                    cells.offsets.name.empty() ? "FaceOffsets" : cells.offsets.name.c_str());
+                  array->SetNumberOfTuples(cells.offsetCount);
+                  array->ConstructBackend(
+                    reinterpret_cast<const IndexingType*>(cells.offsets.data),
+                    cells.offsets.stride);
+                  return array;
+                });
+
+              vtkDataArray* faceIndices = ::UpdateMeshViewArray(*arrays, key + ":indices",
+                cells.indices, static_cast<vtkIdType>(cells.indexCount),
+                [&]() -> vtkSmartPointer<vtkDataArray>
+                {
+                  vtkNew<vtkStridedArray<IndexingType>> array;
+                  array->SetName(
+                    cells.indices.name.empty() ? "FaceIndices" : cells.indices.name.c_str());
+                  array->SetNumberOfTuples(cells.indexCount);
+                  array->ConstructBackend(
+                    reinterpret_cast<const IndexingType*>(cells.indices.data),
+                    cells.indices.stride);
+                  return array;
+                });
+
+              if (current && !faceOffsets && !faceIndices)
+              {
+                // cells modified in place
+                if ((*arrays)[key + ":offsets"].Array->GetMTime() > currentMTime ||
+                  (*arrays)[key + ":indices"].Array->GetMTime() > currentMTime)
+                {
+                  current->Modified();
+                }
+                return current;
+              }
 
-              vtkNew<vtkStridedArray<IndexingType>> faceOffsets;
-              faceOffsets->SetName(
-                cells.offsets.name.empty() ? "FaceOffsets" : cells.offsets.name.c_str());
-              faceOffsets->SetNumberOfTuples(cells.offsetCount);
-              faceOffsets->ConstructBackend(
-                reinterpret_cast<const IndexingType*>(cells.offsets.data), cells.offsets.stride);
-
-              vtkNew<vtkStridedArray<IndexingType>> faceIndices;
-              faceIndices->SetName(
-                cells.indices.name.empty() ? "FaceIndices" : cells.indices.name.c_str());
-              faceIndices->SetNumberOfTuples(cells.indexCount);
-              faceIndices->ConstructBackend(
-                reinterpret_cast<const IndexingType*>(cells.indices.data), cells.indices.stride);
-
-              cellArray->SetData(faceOffsets, faceIndices);
+              vtkNew<vtkCellArray> cellArray;
+              cellArray->SetData(
+                (*arrays)[key + ":offsets"].Array, (*arrays)[key + ":indices"].Array);
               return cellArray;
             }
             return nullptr;
           });
       };
 
-      if (memoryView.vertices.indices.timeDependent || memoryView.vertices.offsets.timeDependent ||
-        firstTime)
-      {
-        polydata->SetVerts(handleCells(memoryView.vertices));
-      }
-
-      if (memoryView.lines.indices.timeDependent || memoryView.lines.offsets.timeDependent ||
-        firstTime)
-      {
-        polydata->SetLines(handleCells(memoryView.lines));
-      }
-
-      if (memoryView.polygons.indices.timeDependent || memoryView.polygons.offsets.timeDependent ||
-        firstTime)
-      {
-        polydata->SetPolys(handleCells(memoryView.polygons));
-      }
+      polydata->SetVerts(handleCells(memoryView.vertices, "vertices", polydata->GetVerts()));
+      polydata->SetLines(handleCells(memoryView.lines, "lines", polydata->GetLines()));
+      polydata->SetPolys(handleCells(memoryView.polygons, "polygons", polydata->GetPolys()));
     });
 
   try
@@ -737,7 +1301,13 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
   std::string name = mesh->getName();
 
   log::debug("Loading 3D scene from memory");
+  this->CommitAllPendingLoads();
   this->Internals->Load({ { name.empty() ? "<mesh_view>" : name, importer } });
+
+  if (stream)
+  {
+    this->Internals->MeshStreams.push_back({ stream, vtkSource.Get(), importer.Get() });
+  }
   return *this;
 #else
   throw scene::load_failure_exception(
@@ -748,6 +1318,12 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
 //----------------------------------------------------------------------------
 scene& scene_impl::clear()
 {
+  // Cancel any asynchronous load as they would be added to the cleared scene
+  this->CancelPendingLoads();
+
+  // Stop updating the mesh streams of the cleared scene
+  this->Internals->MeshStreams.clear();
+
   // Clear the meta importer from all importers
   this->Internals->MetaImporter->Clear();
 
@@ -8,18 +8,24 @@
 #include "options.h"
 #include "utils.h"
 
+#include "F3DFrameCapture.h"
+#include "F3DPicker.h"
 #include "F3DStyle.h"
+#include "F3DTrace.h"
 #include "vtkF3DExternalRenderWindow.h"
 
 #include "vtkF3DGenericImporter.h"
+#include "vtkF3DMetaImporter.h"
 #include "vtkF3DNoRenderWindow.h"
 #include "vtkF3DRenderer.h"
 
 #include <vtkCamera.h>
+#include <vtkDataAssembly.h>
 #include <vtkF3DRenderPass.h>
 #include <vtkImageData.h>
 #include <vtkImageExport.h>
 #include <vtkInformation.h>
+#include <vtkOpenGLRenderWindow.h>
 #include <vtkPNGReader.h>
 #include <vtkPointGaussianMapper.h>
 #include <vtkRenderWindowInteractor.h>
@@ -46,6 +52,8 @@
 
 #include <vtkOSOpenGLRenderWindow.h>
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 
 namespace fs = std::filesystem;
@@ -99,6 +107,155 @@ public:
 #endif
   }
 
+  void ResetCameraIfNeeded()
+  {
+    if ((!this->Options.scene.camera.index.has_value()) && (!this->Camera->GetSuccessfullyReset()))
+    {
+      // Camera wasn't successfully reset last time, it could be a chance that update of dynamic
+      // options will enable successful reset of camera
+      this->Camera->resetToBounds();
+    }
+  }
+
+  /**
+   * Provide the oldest frame of the capture into the image or the buffer,
+   * reusing the image storage when possible
+   */
+  bool AcquireCapturedFrame(image* frame, void* buffer)
+  {
+    if (this->Capture.GetNumberOfPendingFrames() == 0)
+    {
+      return false;
+    }
+
+    if (frame)
+    {
+      const unsigned int width = this->Capture.GetPendingFrameWidth();
+      const unsigned int height = this->Capture.GetPendingFrameHeight();
+      const unsigned int channels = this->Capture.GetNumberOfComponents();
+      if (frame->getWidth() != width || frame->getHeight() != height ||
+        frame->getChannelCount() != channels ||
+        frame->getChannelType() != image::ChannelType::BYTE)
+      {
+        *frame = image(width, height, channels);
+      }
+      buffer = frame->getContent();
+    }
+
+    this->RenWin->MakeCurrent();
+    return this->Capture.Acquire(buffer);
+  }
+
+  /**
+   * Render a frame and queue its readback if render is true, then provide the oldest frame
+   * of the capture if the capture is full or if render is false
+   */
+  bool CaptureFrame(window_impl& self, image* frame, void* buffer, bool render)
+  {
+    if (!this->Capturing)
+    {
+      return false;
+    }
+
+    // Windows without OpenGL, like NONE windows, are read synchronously
+    if (!this->Capture.IsStarted())
+    {
+      if (!render)
+      {
+        return false;
+      }
+      image output = self.renderToImage(this->CaptureNoBackground);
+      if (frame)
+      {
+        *frame = std::move(output);
+      }
+      else
+      {
+        std::memcpy(buffer, output.getContent(),
+          static_cast<size_t>(output.getWidth()) * output.getHeight() * output.getChannelCount());
+      }
+      return true;
+    }
+
+    if (!render)
+    {
+      return this->AcquireCapturedFrame(frame, buffer);
+    }
+
+    self.UpdateDynamicOptions();
+    if (this->CaptureNoBackground)
+    {
+      // black background to avoid blending issues with translucent objects
+      this->Renderer->SetBackground(0, 0, 0);
+    }
+    this->ResetCameraIfNeeded();
+    this->RenWin->Render();
+
+    // acquire the oldest frame before reusing its buffer for the frame just rendered
+    bool provided = false;
+    if (this->Capture.IsFull())
+    {
+      provided = this->AcquireCapturedFrame(frame, buffer);
+    }
+
+    this->RenWin->MakeCurrent();
+    if (!this->Capture.Queue())
+    {
+      log::error("Could not read back the rendered frame");
+    }
+    return provided;
+  }
+
+  /**
+   * Return the label of the scene hierarchy node of the imported actor a picked prop
+   * has been created from, or an empty string if there is none
+   */
+  std::string GetHierarchyLabel(vtkProp* prop)
+  {
+    vtkF3DMetaImporter* importer = this->Renderer->GetMetaImporter();
+    if (!importer || !prop)
+    {
+      return {};
+    }
+
+    vtkProp* original = prop;
+    for (const auto& cs : importer->GetColoringActorsAndMappers())
+    {
+      original = cs.Actor.Get() == prop ? cs.OriginalActor : original;
+    }
+    for (const auto& pss : importer->GetPointSpritesActorsAndMappers())
+    {
+      original = pss.Actor.Get() == prop ? pss.OriginalActor : original;
+    }
+    for (const auto& ngs : importer->GetNormalGlyphsActorsAndMappers())
+    {
+      original = ngs.Actor.Get() == prop ? ngs.OriginalActor : original;
+    }
+    for (const auto& vs : importer->GetVolumePropsAndMappers())
+    {
+      original = vs.Prop.Get() == prop ? vs.OriginalActor : original;
+    }
+
+    for (int i = 0; i < importer->GetImporterInfoCount(); i++)
+    {
+      const vtkF3DMetaImporter::ImporterInfo info = importer->GetImporterInfo(i);
+      const int actorIndex = info.Importer->GetImportedActors()->IsItemPresent(original) - 1;
+      if (actorIndex < 0 || !info.DataAssembly)
+      {
+        continue;
+      }
+
+      const std::vector<int> nodes = info.DataAssembly->SelectNodes(
+        { "//*[@flat_actor_id='" + std::to_string(actorIndex) + "']" });
+      if (!nodes.empty())
+      {
+        return info.DataAssembly->GetAttributeOrDefault(
+          nodes[0], "label", info.DataAssembly->GetNodeName(nodes[0]));
+      }
+    }
+    return {};
+  }
+
   std::unique_ptr<camera_impl> Camera;
   vtkSmartPointer<vtkRenderWindow> RenWin;
   vtkNew<vtkF3DRenderer> Renderer;
@@ -106,6 +263,15 @@ public:
   interactor_impl* Interactor = nullptr;
   fs::path CachePath;
   context::function GetProcAddress;
+
+  F3DFrameCapture Capture;
+  bool Capturing = false;
+  bool CaptureNoBackground = false;
+
+  F3DPicker Picker;
+
+  // Options forwarded to the renderer by the last update of the dynamic options
+  std::optional<options> AppliedOptions;
 };
 
 //----------------------------------------------------------------------------
@@ -191,6 +357,7 @@ window_impl::window_impl(const options& options, const std::optional<Type>& type
 void window_impl::Initialize()
 {
   this->Internals->Renderer->Initialize();
+  this->Internals->AppliedOptions.reset();
 }
 
 //----------------------------------------------------------------------------
@@ -353,9 +520,104 @@ point3_t window_impl::getDisplayFromWorld(const point3_t& worldPoint) const
   return out;
 }
 
+//----------------------------------------------------------------------------
+window::pick_result_t window_impl::pick(int x, int y)
+{
+  pick_result_t result;
+  const F3DPicker::Result picked =
+    this->Internals->Picker.Pick(x, y, this->Internals->Renderer);
+  result.accelerated = picked.Accelerated;
+  if (picked.Picked)
+  {
+    result.picked = true;
+    std::copy_n(picked.Position, 3, result.position.begin());
+    result.name = this->Internals->GetHierarchyLabel(picked.Prop);
+  }
+  return result;
+}
+
+//----------------------------------------------------------------------------
+window::frame_stats_t window_impl::getFrameStats()
+{
+  frame_stats_t stats;
+  if (this->getType() == Type::NONE || this->Internals->RenWin->GetNeverRendered())
+  {
+    return stats;
+  }
+
+  // resolve the frames that completed since the last render, without waiting for the GPU
+  this->Internals->RenWin->MakeCurrent();
+  F3DFrameProfiler& profiler = this->Internals->Renderer->GetFrameProfiler();
+  profiler.Resolve();
+
+  const F3DFrameProfiler::FrameStats& latest = profiler.GetLatestStats();
+  stats.frame = latest.Frame;
+  stats.cpu_time = latest.CPUTime;
+  stats.gpu_time = latest.GPUTime;
+  for (const F3DFrameProfiler::PassStats& pass : latest.Passes)
+  {
+    stats.passes.emplace_back(pass_stats_t{ pass.Name, pass.Depth, pass.CPUTime, pass.GPUTime });
+  }
+  return stats;
+}
+
+//----------------------------------------------------------------------------
+window& window_impl::beginCapture(bool noBackground, unsigned int bufferCount)
+{
+  this->endCapture();
+
+  this->Internals->Capturing = true;
+  this->Internals->CaptureNoBackground = noBackground;
+  if (vtkOpenGLRenderWindow* glRenWin =
+        vtkOpenGLRenderWindow::SafeDownCast(this->Internals->RenWin))
+  {
+    this->Internals->Capture.Start(glRenWin, bufferCount, noBackground);
+  }
+  return *this;
+}
+
+//----------------------------------------------------------------------------
+bool window_impl::acquireFrame(image& frame)
+{
+  return this->Internals->CaptureFrame(*this, &frame, nullptr, true);
+}
+
+//----------------------------------------------------------------------------
+bool window_impl::acquireFrame(void* buffer)
+{
+  return this->Internals->CaptureFrame(*this, nullptr, buffer, true);
+}
+
+//----------------------------------------------------------------------------
+bool window_impl::flushFrame(image& frame)
+{
+  return this->Internals->CaptureFrame(*this, &frame, nullptr, false);
+}
+
+//----------------------------------------------------------------------------
+bool window_impl::flushFrame(void* buffer)
+{
+  return this->Internals->CaptureFrame(*this, nullptr, buffer, false);
+}
+
+//----------------------------------------------------------------------------
+window& window_impl::endCapture()
+{
+  if (this->Internals->Capture.IsStarted())
+  {
+    // buffers are released with the context current
+    this->Internals->RenWin->MakeCurrent();
+    this->Internals->Capture.Stop();
+  }
+  this->Internals->Capturing = false;
+  return *this;
+}
+
 //----------------------------------------------------------------------------
 window_impl::~window_impl()
 {
+  this->endCapture();
+
   if (this->Internals->Interactor)
   {
     // The axis widget should be disabled before calling the renderer destructor
@@ -374,6 +636,7 @@ void window_impl::UpdateActorsVisibility()
 //----------------------------------------------------------------------------
 void window_impl::UpdateDynamicOptions()
 {
+  F3DTrace::Scope traceScope("Update options");
   vtkF3DRenderer* renderer = this->Internals->Renderer;
 
   if (this->Internals->RenWin->IsA("vtkF3DNoRenderWindow"))
@@ -391,110 +654,164 @@ void window_impl::UpdateDynamicOptions()
 
   const options& opt = this->Internals->Options;
 
+  // Only forward the option groups that changed since the last update,
+  // everything is forwarded when no options were applied yet
+  std::optional<options>& applied = this->Internals->AppliedOptions;
+  std::vector<std::string> changedNames;
+  if (applied.has_value())
+  {
+    changedNames = opt.getChangedNames(applied.value());
+  }
+  auto changed = [&](std::initializer_list<std::string_view> prefixes)
+  {
+    return !applied.has_value() ||
+      std::ranges::any_of(changedNames,
+        [&](const std::string& name)
+        {
+          return std::ranges::any_of(
+            prefixes, [&](std::string_view prefix) { return name.starts_with(prefix); });
+        });
+  };
+  traceScope.SetDetail(
+    [&]()
+    {
+      if (!applied.has_value())
+      {
+        return std::string("all options");
+      }
+      std::string detail;
+      for (const std::string& name : changedNames)
+      {
+        detail += (detail.empty() ? "" : ", ") + name;
+      }
+      return detail;
+    });
+
   // Update pending up direction if changed
   renderer->SetPendingUpDirection(opt.scene.up_direction);
 
-  renderer->SetUseNormalGlyphs(opt.model.normal_glyphs.enable);
-  renderer->SetNormalGlyphScaleMultiplier(opt.model.normal_glyphs.scale);
+  if (changed({ "model.normal_glyphs." }))
+  {
+    renderer->SetUseNormalGlyphs(opt.model.normal_glyphs.enable);
+    renderer->SetNormalGlyphScaleMultiplier(opt.model.normal_glyphs.scale);
+  }
 
   // XXX: model.point_sprites.type only has an effect on geometry scene
   // but we set it here for practical reasons
-  vtkF3DRenderer::SplatType splatType = vtkF3DRenderer::SplatType::SPHERE;
-
-  bool enablePointSprites = true;
-  if (opt.model.point_sprites.type == "gaussian")
-  {
-    splatType = vtkF3DRenderer::SplatType::GAUSSIAN;
-  }
-  else if (opt.model.point_sprites.type == "sphere")
-  {
-    splatType = vtkF3DRenderer::SplatType::SPHERE;
-  }
-  else if (opt.model.point_sprites.type == "circle")
-  {
-    splatType = vtkF3DRenderer::SplatType::CIRCLE;
-  }
-  else if (opt.model.point_sprites.type == "stddev")
-  {
-    splatType = vtkF3DRenderer::SplatType::STD_DEV;
-  }
-  else if (opt.model.point_sprites.type == "bound")
+  if (changed({ "model.point_sprites.", "render.effect.blending." }))
   {
-    splatType = vtkF3DRenderer::SplatType::BOUND;
+    vtkF3DRenderer::SplatType splatType = vtkF3DRenderer::SplatType::SPHERE;
+
+    bool enablePointSprites = true;
+    if (opt.model.point_sprites.type == "gaussian")
+    {
+      splatType = vtkF3DRenderer::SplatType::GAUSSIAN;
+    }
+    else if (opt.model.point_sprites.type == "sphere")
+    {
+      splatType = vtkF3DRenderer::SplatType::SPHERE;
+    }
+    else if (opt.model.point_sprites.type == "circle")
+    {
+      splatType = vtkF3DRenderer::SplatType::CIRCLE;
+    }
+    else if (opt.model.point_sprites.type == "stddev")
+    {
+      splatType = vtkF3DRenderer::SplatType::STD_DEV;
+    }
+    else if (opt.model.point_sprites.type == "bound")
+    {
+      splatType = vtkF3DRenderer::SplatType::BOUND;
+    }
+    else if (opt.model.point_sprites.type == "cross")
+    {
+      splatType = vtkF3DRenderer::SplatType::CROSS;
+    }
+    else if (opt.model.point_sprites.type == "none")
+    {
+      enablePointSprites = false;
+    }
+    else
+    {
+      enablePointSprites = false;
+      log::warn(opt.model.point_sprites.type,
+        R"( is an invalid point sprites type. Valid types are: "none", "sphere", "gaussian", "circle", "stddev", "bound", "cross")");
+    }
+
+    renderer->SetUsePointSprites(enablePointSprites);
+    if (enablePointSprites)
+    {
+      renderer->SetPointSpritesType(splatType);
+      renderer->SetPointSpritesSize(
+        opt.model.point_sprites.absolute_size, opt.model.point_sprites.size);
+      renderer->SetPointSpritesUseInstancing(
+        opt.render.effect.blending.mode != "sort" && opt.render.effect.blending.mode != "sort_cpu");
+    }
   }
-  else if (opt.model.point_sprites.type == "cross")
+
+  if (changed({ "render.line_width", "render.point_size", "render.show_edges" }))
   {
-    splatType = vtkF3DRenderer::SplatType::CROSS;
+    renderer->SetLineWidth(opt.render.line_width);
+    renderer->SetPointSize(opt.render.point_size);
+    renderer->ShowEdge(opt.render.show_edges);
   }
-  else if (opt.model.point_sprites.type == "none")
+
+  if (changed({ "ui." }))
   {
-    enablePointSprites = false;
+    renderer->ShowTimer(opt.ui.fps);
+    renderer->ShowFrameStats(opt.ui.frame_stats);
+    renderer->ShowFilename(opt.ui.filename);
+    renderer->SetFilenameInfo(opt.ui.filename_info);
+    renderer->ShowMetaData(opt.ui.metadata);
+    renderer->ShowHDRIFilename(opt.ui.hdri_filename);
+    renderer->ShowSceneHierarchy(opt.ui.scene_hierarchy);
+    renderer->ShowCheatSheet(opt.ui.cheatsheet);
+    renderer->ShowConsole(opt.ui.console);
+    renderer->ShowMinimalConsole(opt.ui.minimal_console);
+    renderer->ShowDropZone(opt.ui.drop_zone.enable);
+    renderer->ShowDropZoneLogo(opt.ui.drop_zone.show_logo);
+    renderer->SetBackdropColor(opt.ui.backdrop.color);
+    renderer->SetBackdropOpacity(opt.ui.backdrop.opacity);
+    renderer->ShowNotification(opt.ui.notifications.enable);
+    renderer->ShowBindings(opt.ui.notifications.show_bindings);
   }
-  else
-  {
-    enablePointSprites = false;
-    log::warn(opt.model.point_sprites.type,
-      R"( is an invalid point sprites type. Valid types are: "none", "sphere", "gaussian", "circle", "stddev", "bound", "cross")");
-  }
-
-  renderer->SetUsePointSprites(enablePointSprites);
-  if (enablePointSprites)
-  {
-    renderer->SetPointSpritesType(splatType);
-    renderer->SetPointSpritesSize(
-      opt.model.point_sprites.absolute_size, opt.model.point_sprites.size);
-    renderer->SetPointSpritesUseInstancing(
-      opt.render.effect.blending.mode != "sort" && opt.render.effect.blending.mode != "sort_cpu");
-  }
-
-  renderer->SetLineWidth(opt.render.line_width);
-  renderer->SetPointSize(opt.render.point_size);
-  renderer->ShowEdge(opt.render.show_edges);
-  renderer->ShowTimer(opt.ui.fps);
-  renderer->ShowFilename(opt.ui.filename);
-  renderer->SetFilenameInfo(opt.ui.filename_info);
-  renderer->ShowMetaData(opt.ui.metadata);
-  renderer->ShowHDRIFilename(opt.ui.hdri_filename);
-  renderer->ShowSceneHierarchy(opt.ui.scene_hierarchy);
-  renderer->ShowCheatSheet(opt.ui.cheatsheet);
-  renderer->ShowConsole(opt.ui.console);
-  renderer->ShowMinimalConsole(opt.ui.minimal_console);
-  renderer->ShowDropZone(opt.ui.drop_zone.enable);
-  renderer->ShowDropZoneLogo(opt.ui.drop_zone.show_logo);
-  renderer->SetBackdropColor(opt.ui.backdrop.color);
-  renderer->SetBackdropOpacity(opt.ui.backdrop.opacity);
-  renderer->ShowNotification(opt.ui.notifications.enable);
-  renderer->ShowBindings(opt.ui.notifications.show_bindings);
 
   if (this->Internals->Interactor)
   {
-    renderer->SetAxesColor(opt.ui.x_color, opt.ui.y_color, opt.ui.z_color);
-    renderer->ShowAxis(opt.ui.axis);
-    renderer->SetInvertZoom(opt.interactor.invert_zoom);
-    renderer->SetInteractionStyle(opt.interactor.style);
+    if (changed({ "ui.", "interactor." }))
+    {
+      renderer->SetAxesColor(opt.ui.x_color, opt.ui.y_color, opt.ui.z_color);
+      renderer->ShowAxis(opt.ui.axis);
+      renderer->SetInvertZoom(opt.interactor.invert_zoom);
+      renderer->SetInteractionStyle(opt.interactor.style);
+    }
 
 #if F3D_MODULE_UI
-    std::string bindsStr = opt.ui.drop_zone.custom_binds;
-    std::vector<std::pair<std::string, std::string>> dropZoneBinds;
-
-    for (const std::string& token : utils::tokenize(bindsStr))
+    // Bindings can change without any option change, always update the binds of a shown drop zone
+    if (opt.ui.drop_zone.enable || changed({ "ui.drop_zone." }))
     {
-      if (!token.empty())
+      std::string bindsStr = opt.ui.drop_zone.custom_binds;
+      std::vector<std::pair<std::string, std::string>> dropZoneBinds;
+
+      for (const std::string& token : utils::tokenize(bindsStr))
       {
-        try
+        if (!token.empty())
         {
-          auto bind = interaction_bind_t::parse(token);
-          auto docPair = this->Internals->Interactor->getBindingDocumentation(bind);
-          dropZoneBinds.push_back({ docPair.first, bind.format() });
-        }
-        catch (const interactor_impl::does_not_exists_exception&)
-        {
-          // skip non-existent binds
-          log::warn("Bind ", token, " does not exist and will be ignored.");
+          try
+          {
+            auto bind = interaction_bind_t::parse(token);
+            auto docPair = this->Internals->Interactor->getBindingDocumentation(bind);
+            dropZoneBinds.push_back({ docPair.first, bind.format() });
+          }
+          catch (const interactor_impl::does_not_exists_exception&)
+          {
+            // skip non-existent binds
+            log::warn("Bind ", token, " does not exist and will be ignored.");
+          }
         }
       }
+      renderer->SetDropZoneBinds(dropZoneBinds);
     }
-    renderer->SetDropZoneBinds(dropZoneBinds);
 #endif
   }
 
@@ -503,164 +820,200 @@ void window_impl::UpdateDynamicOptions()
   F3D_SILENT_WARNING_PUSH()
   F3D_SILENT_WARNING_DECL(4996, "deprecated-declarations")
 
-  if (!opt.ui.dropzone_info.empty())
-  {
-    log::warn("'ui.dropzone_info' is deprecated. Please Use 'ui.drop_zone.custom_binds' instead.");
-    renderer->SetDropZoneInfo(opt.ui.dropzone_info);
-  }
-  else if (!opt.ui.drop_zone.info.empty())
+  if (changed({ "ui." }))
   {
-    log::warn("'ui.drop_zone.info' is deprecated. Please Use 'ui.drop_zone.custom_binds' instead.");
-    renderer->SetDropZoneInfo(opt.ui.drop_zone.info);
-  }
+    if (!opt.ui.dropzone_info.empty())
+    {
+      log::warn(
+        "'ui.dropzone_info' is deprecated. Please Use 'ui.drop_zone.custom_binds' instead.");
+      renderer->SetDropZoneInfo(opt.ui.dropzone_info);
+    }
+    else if (!opt.ui.drop_zone.info.empty())
+    {
+      log::warn(
+        "'ui.drop_zone.info' is deprecated. Please Use 'ui.drop_zone.custom_binds' instead.");
+      renderer->SetDropZoneInfo(opt.ui.drop_zone.info);
+    }
 
-  if (opt.ui.dropzone)
-  {
-    log::warn("'ui.dropzone' is deprecated. Please Use 'ui.drop_zone.enable' instead.");
-    renderer->ShowDropZone(opt.ui.dropzone);
-    renderer->ShowDropZoneLogo(opt.ui.dropzone);
+    if (opt.ui.dropzone)
+    {
+      log::warn("'ui.dropzone' is deprecated. Please Use 'ui.drop_zone.enable' instead.");
+      renderer->ShowDropZone(opt.ui.dropzone);
+      renderer->ShowDropZoneLogo(opt.ui.dropzone);
+    }
   }
   F3D_SILENT_WARNING_POP()
 
-  renderer->ShowArmature(opt.render.armature.enable);
-
-  renderer->SetUseRaytracing(opt.render.raytracing.enable);
-  renderer->SetRaytracingSamples(opt.render.raytracing.samples);
-  renderer->SetUseRaytracingDenoiser(opt.render.raytracing.denoise);
-
-  vtkF3DRenderer::AntiAliasingMode aaMode = vtkF3DRenderer::AntiAliasingMode::NONE;
-  if (opt.render.effect.antialiasing.mode == "fxaa")
-  {
-    aaMode = vtkF3DRenderer::AntiAliasingMode::FXAA;
-  }
-  else if (opt.render.effect.antialiasing.mode == "ssaa")
-  {
-    aaMode = vtkF3DRenderer::AntiAliasingMode::SSAA;
-  }
-  else if (opt.render.effect.antialiasing.mode == "taa")
+  if (changed({ "render.armature.", "render.raytracing." }))
   {
-    aaMode = vtkF3DRenderer::AntiAliasingMode::TAA;
-  }
-  else if (opt.render.effect.antialiasing.mode == "none")
-  {
-    aaMode = vtkF3DRenderer::AntiAliasingMode::NONE;
-  }
-  else
-  {
-    log::warn(opt.render.effect.antialiasing.mode,
-      R"( is an invalid antialiasing mode. Valid modes are: "none", "fxaa", "ssaa", "taa")");
-  }
+    renderer->ShowArmature(opt.render.armature.enable);
 
-  vtkF3DRenderer::BlendingMode blendMode = vtkF3DRenderer::BlendingMode::NONE;
-  if (opt.render.effect.blending.mode == "ddp")
-  {
-    blendMode = vtkF3DRenderer::BlendingMode::DUAL_DEPTH_PEELING;
+    renderer->SetUseRaytracing(opt.render.raytracing.enable);
+    renderer->SetRaytracingSamples(opt.render.raytracing.samples);
+    renderer->SetUseRaytracingDenoiser(opt.render.raytracing.denoise);
   }
-  else if (opt.render.effect.blending.mode == "sort")
+
+  if (changed({ "render.effect.", "render.backface_type" }))
   {
-    blendMode = vtkF3DRenderer::BlendingMode::SORT;
+    vtkF3DRenderer::AntiAliasingMode aaMode = vtkF3DRenderer::AntiAliasingMode::NONE;
+    if (opt.render.effect.antialiasing.mode == "fxaa")
+    {
+      aaMode = vtkF3DRenderer::AntiAliasingMode::FXAA;
+    }
+    else if (opt.render.effect.antialiasing.mode == "ssaa")
+    {
+      aaMode = vtkF3DRenderer::AntiAliasingMode::SSAA;
+    }
+    else if (opt.render.effect.antialiasing.mode == "taa")
+    {
+      aaMode = vtkF3DRenderer::AntiAliasingMode::TAA;
+    }
+    else if (opt.render.effect.antialiasing.mode == "none")
+    {
+      aaMode = vtkF3DRenderer::AntiAliasingMode::NONE;
+    }
+    else
+    {
+      log::warn(opt.render.effect.antialiasing.mode,
+        R"( is an invalid antialiasing mode. Valid modes are: "none", "fxaa", "ssaa", "taa")");
+    }
+
+    vtkF3DRenderer::BlendingMode blendMode = vtkF3DRenderer::BlendingMode::NONE;
+    if (opt.render.effect.blending.mode == "ddp")
+    {
+      blendMode = vtkF3DRenderer::BlendingMode::DUAL_DEPTH_PEELING;
+    }
+    else if (opt.render.effect.blending.mode == "sort")
+    {
+      blendMode = vtkF3DRenderer::BlendingMode::SORT;
+    }
+    else if (opt.render.effect.blending.mode == "sort_cpu")
+    {
+      blendMode = vtkF3DRenderer::BlendingMode::SORT_CPU;
+    }
+    else if (opt.render.effect.blending.mode == "stochastic")
+    {
+      blendMode = vtkF3DRenderer::BlendingMode::STOCHASTIC;
+    }
+    else if (opt.render.effect.blending.mode == "none")
+    {
+      blendMode = vtkF3DRenderer::BlendingMode::NONE;
+    }
+    else
+    {
+      log::warn(opt.render.effect.blending.mode,
+        R"( is an invalid blending mode. Valid modes are: "none", "ddp", "sort", "sort_cpu", "stochastic")");
+    }
+
+    renderer->SetUseSSAOPass(opt.render.effect.ambient_occlusion);
+    renderer->SetAntiAliasingMode(aaMode);
+    renderer->SetUseToneMappingPass(opt.render.effect.tone_mapping);
+    renderer->SetDisplayDepth(opt.render.effect.display_depth);
+    renderer->SetBlendingMode(blendMode);
+    renderer->SetBackfaceType(opt.render.backface_type);
+    renderer->SetFinalShader(opt.render.effect.final_shader);
   }
-  else if (opt.render.effect.blending.mode == "sort_cpu")
+
+  // The background is always set as rendering to an image can override it
+  renderer->SetBackground(opt.render.background.color.data());
+  if (changed({ "render.background.blur.", "render.light." }))
   {
-    blendMode = vtkF3DRenderer::BlendingMode::SORT_CPU;
+    renderer->SetUseBlurBackground(opt.render.background.blur.enable);
+    renderer->SetBlurCircleOfConfusionRadius(opt.render.background.blur.coc);
+    renderer->SetLightIntensity(opt.render.light.intensity);
   }
-  else if (opt.render.effect.blending.mode == "stochastic")
+
+  if (changed({ "render.hdri.", "render.background.skybox" }))
   {
-    blendMode = vtkF3DRenderer::BlendingMode::STOCHASTIC;
+    renderer->SetHDRIFile(opt.render.hdri.file);
+    renderer->SetUseImageBasedLighting(opt.render.hdri.ambient);
+    renderer->ShowHDRISkybox(opt.render.background.skybox);
   }
-  else if (opt.render.effect.blending.mode == "none")
+
+  if (changed({ "ui." }))
   {
-    blendMode = vtkF3DRenderer::BlendingMode::NONE;
+    renderer->SetFontFile(opt.ui.font_file);
+    renderer->SetFontScale(opt.ui.scale);
+    renderer->SetFontColor(opt.ui.font_color);
+    renderer->SetAnimationProgressColor(opt.ui.animation_progress_color);
+    vtkF3DUIActor::AnimationProgressBarMode animationProgressMode =
+      vtkF3DUIActor::AnimationProgressBarMode::NONE;
+    if (opt.ui.animation_progress == "default")
+    {
+      animationProgressMode = vtkF3DUIActor::AnimationProgressBarMode::DEFAULT;
+    }
+    else if (opt.ui.animation_progress == "advanced")
+    {
+      animationProgressMode = vtkF3DUIActor::AnimationProgressBarMode::ADVANCED;
+    }
+    else if (opt.ui.animation_progress != "none")
+    {
+      log::warn(opt.ui.animation_progress,
+        R"( is an invalid animation progress mode. Valid modes are: "none", "default", "advanced". Falling back to "none".)");
+    }
+    renderer->SetAnimationProgressMode(animationProgressMode);
+    renderer->SetDPIAware(opt.ui.dpi_aware);
   }
-  else
+
+  if (changed({ "render.grid.", "render.axes_grid." }))
   {
-    log::warn(opt.render.effect.blending.mode,
-      R"( is an invalid blending mode. Valid modes are: "none", "ddp", "sort", "sort_cpu", "stochastic")");
+    renderer->SetGridUnitSquare(opt.render.grid.unit);
+    renderer->SetGridSubdivisions(opt.render.grid.subdivisions);
+    renderer->SetGridAbsolute(opt.render.grid.absolute);
+    renderer->SetGridReflection(opt.render.grid.reflection);
+    renderer->ShowGrid(opt.render.grid.enable);
+    renderer->SetGridColor(opt.render.grid.color);
+
+    renderer->ShowAxesGrid(opt.render.axes_grid.enable);
   }
 
-  renderer->SetUseSSAOPass(opt.render.effect.ambient_occlusion);
-  renderer->SetAntiAliasingMode(aaMode);
-  renderer->SetUseToneMappingPass(opt.render.effect.tone_mapping);
-  renderer->SetDisplayDepth(opt.render.effect.display_depth);
-  renderer->SetBlendingMode(blendMode);
-  renderer->SetBackfaceType(opt.render.backface_type);
-  renderer->SetFinalShader(opt.render.effect.final_shader);
-
-  renderer->SetBackground(opt.render.background.color.data());
-  renderer->SetUseBlurBackground(opt.render.background.blur.enable);
-  renderer->SetBlurCircleOfConfusionRadius(opt.render.background.blur.coc);
-  renderer->SetLightIntensity(opt.render.light.intensity);
-
-  renderer->SetHDRIFile(opt.render.hdri.file);
-  renderer->SetUseImageBasedLighting(opt.render.hdri.ambient);
-  renderer->ShowHDRISkybox(opt.render.background.skybox);
-
-  renderer->SetFontFile(opt.ui.font_file);
-  renderer->SetFontScale(opt.ui.scale);
-  renderer->SetFontColor(opt.ui.font_color);
-  renderer->SetAnimationProgressColor(opt.ui.animation_progress_color);
-  vtkF3DUIActor::AnimationProgressBarMode animationProgressMode =
-    vtkF3DUIActor::AnimationProgressBarMode::NONE;
-  if (opt.ui.animation_progress == "default")
+  if (!opt.scene.camera.index.has_value() && changed({ "scene.camera." }))
   {
-    animationProgressMode = vtkF3DUIActor::AnimationProgressBarMode::DEFAULT;
+    renderer->SetUseOrthographicProjection(opt.scene.camera.orthographic);
   }
-  else if (opt.ui.animation_progress == "advanced")
+
+  if (changed({ "model.", "ui.scalar_bar" }))
   {
-    animationProgressMode = vtkF3DUIActor::AnimationProgressBarMode::ADVANCED;
+    renderer->SetSurfaceColor(opt.model.color.rgb);
+    renderer->SetOpacity(opt.model.color.opacity);
+    renderer->SetTextureBaseColor(opt.model.color.texture);
+    renderer->SetTexturesTransform(opt.model.textures_transform);
+    renderer->SetRoughness(opt.model.material.roughness);
+    renderer->SetMetallic(opt.model.material.metallic);
+    renderer->SetBaseIOR(opt.model.material.base_ior);
+    renderer->SetTextureMaterial(opt.model.material.texture);
+    renderer->SetTextureEmissive(opt.model.emissive.texture);
+    renderer->SetEmissiveFactor(opt.model.emissive.factor);
+    renderer->SetTextureNormal(opt.model.normal.texture);
+    renderer->SetNormalScale(opt.model.normal.scale);
+    renderer->SetTextureMatCap(opt.model.matcap.texture);
+    renderer->SetEnableCheckerBoard(opt.model.checkerboard.enable);
+    renderer->SetUnlit(opt.model.unlit);
+
+    renderer->SetEnableColoring(opt.model.scivis.enable);
+    renderer->SetUseCellColoring(opt.model.scivis.cells);
+    renderer->SetArrayNameForColoring(opt.model.scivis.array_name);
+    renderer->SetComponentForColoring(opt.model.scivis.component);
+
+    renderer->SetScalarBarRange(opt.model.scivis.range);
+    renderer->SetColormap(opt.model.scivis.colormap);
+    renderer->SetColormapDiscretization(opt.model.scivis.discretization);
+    renderer->SetOpacityMap(opt.model.scivis.opacity_map);
+    renderer->ShowScalarBar(opt.ui.scalar_bar);
+
+    renderer->SetUseVolume(opt.model.volume.enable);
+    renderer->SetUseInverseOpacityFunction(opt.model.volume.inverse);
   }
-  else if (opt.ui.animation_progress != "none")
+
+  if (!applied.has_value())
   {
-    log::warn(opt.ui.animation_progress,
-      R"( is an invalid animation progress mode. Valid modes are: "none", "default", "advanced". Falling back to "none".)");
+    applied.emplace(opt);
   }
-  renderer->SetAnimationProgressMode(animationProgressMode);
-  renderer->SetDPIAware(opt.ui.dpi_aware);
-
-  renderer->SetGridUnitSquare(opt.render.grid.unit);
-  renderer->SetGridSubdivisions(opt.render.grid.subdivisions);
-  renderer->SetGridAbsolute(opt.render.grid.absolute);
-  renderer->SetGridReflection(opt.render.grid.reflection);
-  renderer->ShowGrid(opt.render.grid.enable);
-  renderer->SetGridColor(opt.render.grid.color);
-
-  renderer->ShowAxesGrid(opt.render.axes_grid.enable);
-
-  if (!opt.scene.camera.index.has_value())
+  else if (!changedNames.empty())
   {
-    renderer->SetUseOrthographicProjection(opt.scene.camera.orthographic);
+    applied.value() = opt;
   }
 
-  renderer->SetSurfaceColor(opt.model.color.rgb);
-  renderer->SetOpacity(opt.model.color.opacity);
-  renderer->SetTextureBaseColor(opt.model.color.texture);
-  renderer->SetTexturesTransform(opt.model.textures_transform);
-  renderer->SetRoughness(opt.model.material.roughness);
-  renderer->SetMetallic(opt.model.material.metallic);
-  renderer->SetBaseIOR(opt.model.material.base_ior);
-  renderer->SetTextureMaterial(opt.model.material.texture);
-  renderer->SetTextureEmissive(opt.model.emissive.texture);
-  renderer->SetEmissiveFactor(opt.model.emissive.factor);
-  renderer->SetTextureNormal(opt.model.normal.texture);
-  renderer->SetNormalScale(opt.model.normal.scale);
-  renderer->SetTextureMatCap(opt.model.matcap.texture);
-  renderer->SetEnableCheckerBoard(opt.model.checkerboard.enable);
-  renderer->SetUnlit(opt.model.unlit);
-
-  renderer->SetEnableColoring(opt.model.scivis.enable);
-  renderer->SetUseCellColoring(opt.model.scivis.cells);
-  renderer->SetArrayNameForColoring(opt.model.scivis.array_name);
-  renderer->SetComponentForColoring(opt.model.scivis.component);
-
-  renderer->SetScalarBarRange(opt.model.scivis.range);
-  renderer->SetColormap(opt.model.scivis.colormap);
-  renderer->SetColormapDiscretization(opt.model.scivis.discretization);
-  renderer->SetOpacityMap(opt.model.scivis.opacity_map);
-  renderer->ShowScalarBar(opt.ui.scalar_bar);
-
-  renderer->SetUseVolume(opt.model.volume.enable);
-  renderer->SetUseInverseOpacityFunction(opt.model.volume.inverse);
-
   renderer->UpdateActors();
 
   // Update the cheatsheet if needed
@@ -711,21 +1064,24 @@ vtkRenderWindow* window_impl::GetRenderWindow()
 //----------------------------------------------------------------------------
 bool window_impl::render()
 {
+  F3D_TRACE_SCOPE("Render");
   this->UpdateDynamicOptions();
-  const options& opt = this->Internals->Options;
-  if ((!opt.scene.camera.index.has_value()) && (!this->Internals->Camera->GetSuccessfullyReset()))
+  this->Internals->ResetCameraIfNeeded();
+  this->Internals->RenWin->Render();
+
+  // only interactive windows build the picking structures of stable actors in the background,
+  // other windows build them on the first pick
+  if (this->Internals->Interactor && !this->Internals->RenWin->GetOffScreenRendering())
   {
-    // Camera wasn't successfully reset last time, it could be a chance that update of dynamic
-    // options will enable successful reset of camera
-    this->Internals->Camera->resetToBounds();
+    this->Internals->Picker.PrepareWhenStable(this->Internals->Renderer);
   }
-  this->Internals->RenWin->Render();
   return true;
 }
 
 //----------------------------------------------------------------------------
 image window_impl::renderToImage(bool noBackground)
 {
+  F3D_TRACE_SCOPE("Render to image");
   this->render();
 
   vtkNew<vtkWindowToImageFilter> rtW2if;
@@ -756,6 +1112,7 @@ image window_impl::renderToImage(bool noBackground)
 void window_impl::SetImporter(vtkF3DMetaImporter* importer)
 {
   this->Internals->Renderer->SetImporter(importer);
+  this->Internals->AppliedOptions.reset();
 }
 
 //----------------------------------------------------------------------------
@@ -783,6 +1140,7 @@ void window_impl::SetCachePath(const fs::path& cachePath)
 void window_impl::SetInteractor(interactor_impl* interactor)
 {
   this->Internals->Interactor = interactor;
+  this->Internals->AppliedOptions.reset();
 }
 
 //----------------------------------------------------------------------------
@@ -256,5 +256,41 @@ int TestSDKImage([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
   f3d::image empty(0, 0, 0);
   test("compare empty images", empty.compare(empty), 0.);
 
+  f3d::image generatedCopy(generated);
+  test("compare identical images", generated.compare(generatedCopy), 0.);
+
+  f3d::image diff;
+  test("compare identical images with diff", generated.compare(generatedCopy, &diff), 0.);
+  test("diff of identical images is black", [&]() {
+    const auto* content = static_cast<const unsigned char*>(diff.getContent());
+    return diff.getWidth() == width && diff.getHeight() == height &&
+      diff.getChannelCount() == 3 &&
+      std::all_of(content, content + width * height * 3, [](unsigned char v) { return v == 0; });
+  });
+
+  // a black square in the middle of a gray image is white in the heatmap, the rest is black
+  std::vector<uint8_t> grayPixels(width * height * channels, 128);
+  f3d::image gray(width, height, channels);
+  gray.setContent(grayPixels.data());
+  std::vector<uint8_t> squarePixels(grayPixels);
+  for (unsigned int y = 24; y < 40; y++)
+  {
+    std::fill_n(squarePixels.begin() + (y * width + 24) * channels, 16 * channels, 0);
+  }
+  f3d::image square(width, height, channels);
+  square.setContent(squarePixels.data());
+  test("compare different images with diff", gray.compare(square, &diff) > 0.);
+  test("diff heatmap size", diff.getWidth() == width && diff.getHeight() == height);
+  test("diff heatmap is white in the middle of the differences", [&]() {
+    const std::vector<double> pixel = diff.getNormalizedPixel({ 32, 32 });
+    return std::ranges::all_of(pixel, [](double v) { return v > 0.98; });
+  });
+  test("diff heatmap is black far from the differences",
+    diff.getNormalizedPixel({ 2, 2 }) == std::vector<double>{ 0., 0., 0. });
+
+  test(
+    "compare images with different size with diff", generated.compare(generatedSize, &diff), 1.);
+  test("diff of images with different size is empty", diff.getWidth() == 0);
+
   return test.result();
 }
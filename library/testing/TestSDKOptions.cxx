@@ -9,6 +9,7 @@
 #include <cmath>
 #include <iostream>
 #include <limits>
+#include <set>
 
 using namespace std::string_literals;
 
@@ -331,6 +332,22 @@ int TestSDKOptions([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
   opt2.copy(opt, "render.background.color");
   test("copy with vectors", opt2.render.background.color == f3d::color_t({ 0.1, 0.2, 0.7 }));
 
+  // Test getChangedNames
+  f3d::options optChanged;
+  f3d::options optChanged2;
+  test("getChangedNames empty", optChanged.getChangedNames(optChanged2).empty());
+
+  optChanged2.render.line_width = 3.12;
+  optChanged2.scene.camera.index = 1;
+  const std::vector<std::string> changedNames = optChanged.getChangedNames(optChanged2);
+  test("getChangedNames",
+    std::set<std::string>(changedNames.begin(), changedNames.end()) ==
+      std::set<std::string>{ "render.line_width", "scene.camera.index" });
+
+  optChanged.copy(optChanged2, "render.line_width");
+  test("getChangedNames after copy",
+    optChanged2.getChangedNames(optChanged) == std::vector<std::string>{ "scene.camera.index" });
+
   // Test isSame/copy error path
   test.expect<f3d::options::inexistent_exception>(
     "inexistent_exception exception on isSame", [&]() { std::ignore = opt.isSame(opt2, "dummy"); });
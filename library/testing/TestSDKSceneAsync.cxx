@@ -0,0 +1,120 @@
+#include "PseudoUnitTest.h"
+
+#include <engine.h>
+#include <image.h>
+#include <log.h>
+#include <scene.h>
+#include <window.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+namespace
+{
+// Write an ascii VTK XML polydata split in many pieces, long enough to read to be canceled
+void WriteLargePolyData(const std::filesystem::path& path)
+{
+  constexpr int nbPieces = 500;
+  constexpr int nbPoints = 2000;
+  std::ofstream file(path);
+  file << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"PolyData\" version=\"1.0\" byte_order=\"LittleEndian\">\n"
+       << "<PolyData>\n";
+  for (int piece = 0; piece < nbPieces; piece++)
+  {
+    file << "<Piece NumberOfPoints=\"" << nbPoints << "\" NumberOfVerts=\"0\" "
+         << "NumberOfLines=\"0\" NumberOfStrips=\"0\" NumberOfPolys=\"0\">\n"
+         << "<Points><DataArray type=\"Float32\" NumberOfComponents=\"3\" format=\"ascii\">\n";
+    for (int i = 0; i < nbPoints; i++)
+    {
+      file << piece << " " << i << " 0.5\n";
+    }
+    file << "</DataArray></Points>\n</Piece>\n";
+  }
+  file << "</PolyData>\n</VTKFile>\n";
+}
+}
+
+int TestSDKSceneAsync([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::log::setVerboseLevel(f3d::log::VerboseLevel::DEBUG);
+  f3d::engine eng = f3d::engine::create(true);
+  f3d::scene& sce = eng.getScene();
+
+  std::string cow = std::string(argv[1]) + "data/cow.vtp";
+  std::string world = std::string(argv[1]) + "data/world.obj";
+  std::string nonExistent = std::string(argv[1]) + "data/nonExistent.vtp";
+  std::string invalidBody = std::string(argv[1]) + "data/invalid_body.vtp";
+
+  // Errors known before reading are reported synchronously
+  test.expect<f3d::scene::load_failure_exception>(
+    "add async with non existent file", [&]() { std::ignore = sce.addAsync(nonExistent); });
+
+  // Successful load
+  f3d::scene::load_handle handle = sce.addAsync(std::vector<std::filesystem::path>{ cow, world });
+  test("add async progress is valid", [&]() {
+    double progress = handle.getProgress();
+    return progress >= 0.0 && progress <= 1.0;
+  });
+  test("add async wait", handle.wait() == f3d::scene::LoadStatus::LOADED);
+  test("add async status after wait", handle.getStatus() == f3d::scene::LoadStatus::LOADED);
+  test("add async progress after wait", handle.getProgress() == 1.0);
+  test("add async no error", handle.getError().empty());
+  handle.cancel();
+  test("cancel after load has no effect", handle.getStatus() == f3d::scene::LoadStatus::LOADED);
+
+  // Failed load
+  sce.clear();
+  f3d::scene::load_handle invalidHandle = sce.addAsync(invalidBody);
+  test("add async with invalid file", invalidHandle.wait() == f3d::scene::LoadStatus::FAILED);
+  test("add async with invalid file error", !invalidHandle.getError().empty());
+
+  // Canceled load of a large file, once it is being read
+  sce.clear();
+  sce.add(cow);
+  f3d::window& win = eng.getWindow();
+  const f3d::image before = win.renderToImage();
+
+  const std::filesystem::path large =
+    std::filesystem::path(argv[2]) / "TestSDKSceneAsyncLarge.vtp";
+  ::WriteLargePolyData(large);
+  f3d::scene::load_handle canceledHandle = sce.addAsync(large);
+  for (int i = 0; i < 10000 && canceledHandle.getProgress() == 0.0; i++)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  canceledHandle.cancel();
+  test("add async canceled", canceledHandle.wait() == f3d::scene::LoadStatus::CANCELED);
+  test("add async canceled stops reading", canceledHandle.getProgress() < 1.0);
+  test("add async canceled leaves the scene unchanged", win.renderToImage() == before);
+
+  // The reader has been released with the worker
+  std::error_code ec;
+  test("add async canceled releases the file", std::filesystem::remove(large, ec) && !ec);
+  test("add after canceled add async", [&]() { sce.add(world); });
+
+  // Loads are committed in order and a synchronous add still works afterwards
+  f3d::scene::load_handle first = sce.addAsync(cow);
+  f3d::scene::load_handle second = sce.addAsync(world);
+  test("add async second wait", second.wait() == f3d::scene::LoadStatus::LOADED);
+  test("add async first committed before second",
+    first.getStatus() == f3d::scene::LoadStatus::LOADED);
+  test("add after add async", [&]() { sce.add(cow); });
+
+  // A synchronous add is committed after the pending loads started before it
+  f3d::scene::load_handle pendingHandle = sce.addAsync(world);
+  sce.add(cow);
+  test("add commits pending add async",
+    pendingHandle.getStatus() == f3d::scene::LoadStatus::LOADED);
+
+  // Pending loads are canceled by clear
+  f3d::scene::load_handle clearedHandle = sce.addAsync(world);
+  sce.clear();
+  test("add async canceled by clear", clearedHandle.wait() == f3d::scene::LoadStatus::CANCELED);
+
+  return test.result();
+}
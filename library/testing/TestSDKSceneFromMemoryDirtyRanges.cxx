@@ -0,0 +1,149 @@
+#include "PseudoUnitTest.h"
+
+#include <engine.h>
+#include <image.h>
+#include <log.h>
+#include <mesh_view.h>
+#include <scene.h>
+#include <window.h>
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+// Flat grid of quads whose heights are modified in place
+struct HeightGrid
+{
+  explicit HeightGrid(unsigned int n)
+    : RowSize(n + 1)
+  {
+    for (unsigned int j = 0; j <= n; ++j)
+    {
+      for (unsigned int i = 0; i <= n; ++i)
+      {
+        this->Points.push_back(2.f * static_cast<float>(i) / n - 1.f);
+        this->Points.push_back(2.f * static_cast<float>(j) / n - 1.f);
+        this->Points.push_back(0.f);
+      }
+    }
+
+    for (unsigned int j = 0; j < n; ++j)
+    {
+      for (unsigned int i = 0; i < n; ++i)
+      {
+        const unsigned int i0 = j * this->RowSize + i;
+        this->Indices.insert(
+          this->Indices.end(), { i0, i0 + 1, i0 + this->RowSize + 1, i0 + this->RowSize });
+        this->Offsets.push_back(static_cast<unsigned int>(this->Offsets.size()) * 4);
+      }
+    }
+    this->Offsets.push_back(static_cast<unsigned int>(this->Offsets.size()) * 4);
+  }
+
+  // Set the height of the points of rows [begin, end) and record them as the only dirty range
+  void SetRowsHeight(size_t begin, size_t end, float height)
+  {
+    for (size_t i = begin * this->RowSize; i < end * this->RowSize; ++i)
+    {
+      this->Points[3 * i + 2] = height;
+    }
+    this->DirtyRanges = { { begin * this->RowSize, end * this->RowSize } };
+    this->Generation++;
+  }
+
+  size_t RowSize;
+  std::vector<float> Points;
+  std::vector<unsigned int> Offsets = { 0 };
+  std::vector<unsigned int> Indices;
+  uint64_t Generation = 1;
+  std::vector<std::array<size_t, 2>> DirtyRanges;
+};
+
+class HeightGridMesh : public f3d::mesh_view
+{
+public:
+  HeightGridMesh(const HeightGrid& grid, bool useDirtyRanges)
+    : Grid(grid)
+    , UseDirtyRanges(useDirtyRanges)
+  {
+  }
+
+  std::array<double, 2> getTimeRange() const override
+  {
+    return { 0.0, 1.0 };
+  }
+
+  f3d::mesh_view::memory_view_t getMemoryView(double) const override
+  {
+    f3d::mesh_view::data_array_t points = { .data = this->Grid.Points.data(),
+      .components = 3,
+      .stride = 3 };
+    if (this->UseDirtyRanges)
+    {
+      points.generation = this->Grid.Generation;
+      points.dirtyRanges = this->Grid.DirtyRanges;
+    }
+
+    return { .pointCount = this->Grid.Points.size() / 3,
+      .points = points,
+      .polygons = { .offsetCount = this->Grid.Offsets.size(),
+        .offsets = { .type = f3d::mesh_view::data_type::U32,
+          .data = this->Grid.Offsets.data(),
+          .timeDependent = false },
+        .indexCount = this->Grid.Indices.size(),
+        .indices = { .type = f3d::mesh_view::data_type::U32,
+          .data = this->Grid.Indices.data(),
+          .timeDependent = false } } };
+  }
+
+private:
+  const HeightGrid& Grid;
+  bool UseDirtyRanges;
+};
+}
+
+int TestSDKSceneFromMemoryDirtyRanges([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::log::setVerboseLevel(f3d::log::VerboseLevel::DEBUG);
+  f3d::engine eng = f3d::engine::create(true);
+  f3d::scene& sce = eng.getScene();
+  f3d::window& win = eng.getWindow().setSize(300, 300);
+
+  // Oblique camera so that heights change the silhouette of the grid
+  const f3d::camera_state_t camera = { .position = { 0., -3., 3. },
+    .focalPoint = { 0., 0., 0. },
+    .viewUp = { 0., 0., 1. } };
+
+  HeightGrid grid(20);
+  test("add mesh with dirty ranges",
+    [&]() { sce.add(std::make_shared<::HeightGridMesh>(grid, true)); });
+
+  win.getCamera().setState(camera);
+  const f3d::image flat = win.renderToImage();
+
+  // Only the points of a band of rows are modified and uploaded
+  grid.SetRowsHeight(5, 10, 0.5f);
+  test("update a sub-range of the points", [&]() { sce.loadAnimationTime(0.5); });
+  win.getCamera().setState(camera);
+  const f3d::image partial = win.renderToImage();
+  test("partial upload is rendered", partial.compare(flat) > 0.05);
+
+  grid.SetRowsHeight(12, 14, -0.3f);
+  test("update another sub-range of the points", [&]() { sce.loadAnimationTime(1.0); });
+  win.getCamera().setState(camera);
+  const f3d::image partialAgain = win.renderToImage();
+  test("second partial upload is rendered", partialAgain.compare(partial) > 0.05);
+
+  // The same heights uploaded entirely by a new mesh must render the same
+  test("clear the scene", [&]() { sce.clear(); });
+  test("add mesh without dirty ranges",
+    [&]() { sce.add(std::make_shared<::HeightGridMesh>(grid, false)); });
+  win.getCamera().setState(camera);
+  const f3d::image full = win.renderToImage();
+  test("partial uploads match a full upload", full.compare(partialAgain) < 0.01);
+
+  return test.result();
+}
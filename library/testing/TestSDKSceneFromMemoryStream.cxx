@@ -0,0 +1,116 @@
+#include "PseudoUnitTest.h"
+
+#include <engine.h>
+#include <interactor.h>
+#include <log.h>
+#include <mesh_stream.h>
+#include <scene.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// Data of a snapshot, owned by the snapshot
+struct Frame
+{
+  explicit Frame(float z)
+    : Points{ 0.f, 0.f, z, 1.f, 0.f, z, 0.f, 1.f, z }
+  {
+  }
+
+  f3d::mesh_view::memory_view_t GetMemoryView() const
+  {
+    return { .pointCount = 3,
+      .points = { .data = this->Points.data(), .components = 3, .stride = 3 },
+      .polygons = { .offsetCount = this->Offsets.size(),
+        .offsets = { .type = f3d::mesh_view::data_type::U32, .data = this->Offsets.data() },
+        .indexCount = this->Indices.size(),
+        .indices = { .type = f3d::mesh_view::data_type::U32, .data = this->Indices.data() } } };
+  }
+
+  std::vector<float> Points;
+  std::vector<unsigned int> Offsets = { 0, 3 };
+  std::vector<unsigned int> Indices = { 0, 1, 2 };
+};
+
+void Publish(f3d::mesh_stream& stream, const std::shared_ptr<Frame>& frame)
+{
+  stream.publish(frame->GetMemoryView(), frame);
+}
+}
+
+int TestSDKSceneFromMemoryStream([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::log::setVerboseLevel(f3d::log::VerboseLevel::DEBUG);
+  f3d::engine eng = f3d::engine::create(true);
+  f3d::scene& sce = eng.getScene();
+  f3d::interactor& inter = eng.getInteractor();
+
+  auto stream = std::make_shared<f3d::mesh_stream>();
+  test("no snapshot before publishing", !stream->hasNewSnapshot());
+  test("acquire without snapshot", !stream->acquireSnapshot());
+
+  auto frame0 = std::make_shared<::Frame>(0.f);
+  std::weak_ptr<::Frame> weakFrame0 = frame0;
+  ::Publish(*stream, frame0);
+  frame0.reset();
+  test("snapshot published", stream->hasNewSnapshot());
+
+  test("add mesh stream", [&]() { sce.add(stream); });
+  test("snapshot acquired when added", !stream->hasNewSnapshot());
+  test("acquired snapshot is rendered",
+    stream->getMemoryView(0.0).points.data == weakFrame0.lock()->Points.data());
+
+  // The event loop picks up the latest snapshot
+  ::Publish(*stream, std::make_shared<::Frame>(1.f));
+  inter.triggerEventLoop(0.04);
+  test("snapshot acquired by the event loop", !stream->hasNewSnapshot());
+  test("first snapshot kept while it can be reused by the producer", !weakFrame0.expired());
+
+  auto frame3 = std::make_shared<::Frame>(3.f);
+  ::Publish(*stream, std::make_shared<::Frame>(2.f));
+  ::Publish(*stream, frame3);
+  test("replaced snapshot released by the producer", weakFrame0.expired());
+
+  inter.triggerEventLoop(0.04);
+  test("latest snapshot is rendered",
+    stream->getMemoryView(0.0).points.data == frame3->Points.data());
+
+  // Snapshots are always complete when published concurrently
+  auto concurrentStream = std::make_shared<f3d::mesh_stream>();
+  std::atomic<bool> done = false;
+  std::thread producer(
+    [&]()
+    {
+      for (int i = 0; i < 10000; i++)
+      {
+        ::Publish(*concurrentStream, std::make_shared<::Frame>(static_cast<float>(i)));
+      }
+      done = true;
+    });
+
+  bool consistent = true;
+  while (!done)
+  {
+    if (concurrentStream->acquireSnapshot())
+    {
+      const auto view = concurrentStream->getMemoryView(0.0);
+      const float* points = static_cast<const float*>(view.points.data);
+      consistent = consistent && view.pointCount == 3 && points[2] == points[5] &&
+        points[5] == points[8];
+    }
+  }
+  producer.join();
+  test("concurrent snapshots are consistent", consistent);
+  concurrentStream->acquireSnapshot();
+  test("last concurrent snapshot",
+    static_cast<const float*>(concurrentStream->getMemoryView(0.0).points.data)[2] == 9999.f);
+
+  test("clear the scene", [&]() { sce.clear(); });
+
+  return test.result();
+}
@@ -0,0 +1,65 @@
+#include "PseudoUnitTest.h"
+
+#include <engine.h>
+#include <image.h>
+#include <scene.h>
+#include <window.h>
+
+#include <vector>
+
+int TestSDKWindowCapture([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::engine eng = f3d::engine::create(true);
+
+  f3d::window& win = eng.getWindow();
+  win.setSize(300, 200);
+
+  f3d::scene& sce = eng.getScene();
+  sce.add(std::string(argv[1]) + "/data/cow.vtp");
+
+  f3d::image frame;
+  test("acquire frame without capture", !win.acquireFrame(frame));
+
+  win.beginCapture(false, 2);
+
+  // the first frames fill the capture
+  test("first frame is in flight", !win.acquireFrame(frame));
+  test("second frame is in flight", !win.acquireFrame(frame));
+  test("third render provides the first frame", win.acquireFrame(frame));
+  test("captured frame has the window size",
+    frame.getWidth() == 300 && frame.getHeight() == 200 && frame.getChannelCount() == 3);
+
+  const f3d::image reference = win.renderToImage();
+  test("captured frame matches a rendered image", frame.compare(reference) < 0.05);
+
+  // the image storage is reused when the size matches
+  const void* content = frame.getContent();
+  test("fourth render provides the second frame", win.acquireFrame(frame));
+  test("image storage is reused", frame.getContent() == content);
+
+  std::vector<unsigned char> buffer(300 * 200 * 3);
+  test("flush frame into a buffer", win.flushFrame(buffer.data()));
+  test("flush last frame", win.flushFrame(frame));
+  test("no frame left", !win.flushFrame(frame));
+
+  win.endCapture();
+  test("acquire frame after capture", !win.acquireFrame(frame));
+
+  // RGBA capture
+  win.beginCapture(true, 1);
+  test("RGBA frame is in flight", !win.acquireFrame(frame));
+  test("RGBA frame is provided", win.acquireFrame(frame) && frame.getChannelCount() == 4);
+  win.endCapture();
+
+  // frames follow the window size
+  win.beginCapture();
+  win.setSize(200, 100);
+  test("resized frame is in flight", !win.acquireFrame(frame));
+  test("flush resized frame", win.flushFrame(frame));
+  test("flushed frame has the new size", frame.getWidth() == 200 && frame.getHeight() == 100);
+  win.endCapture();
+
+  return test.result();
+}
@@ -0,0 +1,72 @@
+#include "PseudoUnitTest.h"
+
+#include <engine.h>
+#include <options.h>
+#include <scene.h>
+#include <window.h>
+
+#include <algorithm>
+#include <tuple>
+
+int TestSDKWindowFrameStats([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::engine eng = f3d::engine::create(true);
+
+  f3d::window& win = eng.getWindow();
+  win.setSize(300, 300);
+
+  test("frame stats before rendering", win.getFrameStats().frame == 0);
+
+  f3d::scene& sce = eng.getScene();
+  sce.add(std::string(argv[1]) + "/data/cow.vtp");
+
+  f3d::options& options = eng.getOptions();
+  options.ui.fps = true;
+  options.ui.frame_stats = true;
+  options.render.effect.antialiasing.mode = "fxaa";
+  options.render.effect.tone_mapping = true;
+
+  // reading back the pixels waits for the GPU, results are available after the next render
+  for (int i = 0; i < 5; i++)
+  {
+    std::ignore = win.renderToImage();
+  }
+
+  const f3d::window::frame_stats_t stats = win.getFrameStats();
+  test("frame stats are resolved", stats.frame > 0);
+  test("frame stats have a CPU time", stats.cpu_time > 0.0);
+
+  const auto hasPass = [&](const std::string& name)
+  {
+    return std::ranges::any_of(
+      stats.passes, [&](const f3d::window::pass_stats_t& pass) { return pass.name == name; });
+  };
+  test("frame stats have a main pass", hasPass("Main"));
+  test("frame stats have a tone mapping pass", hasPass("ToneMapping"));
+  test("frame stats have a FXAA pass", hasPass("FXAA"));
+  test("frame stats have a UI pass", hasPass("UI"));
+
+  test("pass times are exclusive", [&]() {
+    double cpuTime = 0.0;
+    for (const f3d::window::pass_stats_t& pass : stats.passes)
+    {
+      cpuTime += pass.cpu_time;
+    }
+    return cpuTime <= stats.cpu_time;
+  });
+
+  test("GPU times are consistent", [&]() {
+    return stats.gpu_time < 0.0 ||
+      std::ranges::all_of(stats.passes,
+        [](const f3d::window::pass_stats_t& pass) { return pass.gpu_time >= 0.0; });
+  });
+
+  // more recent frames are resolved after more renders
+  win.render();
+  std::ignore = win.renderToImage();
+  test("frame stats are updated", win.getFrameStats().frame > stats.frame);
+
+  return test.result();
+}
@@ -0,0 +1,62 @@
+#include "PseudoUnitTest.h"
+
+#include <engine.h>
+#include <scene.h>
+#include <window.h>
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+namespace
+{
+f3d::window::pick_result_t WaitUntilAccelerated(f3d::window& win, int x, int y)
+{
+  f3d::window::pick_result_t result = win.pick(x, y);
+  for (int i = 0; i < 200 && !result.accelerated; i++)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    result = win.pick(x, y);
+  }
+  return result;
+}
+}
+
+int TestSDKWindowPick([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::engine eng = f3d::engine::create(true);
+
+  f3d::window& win = eng.getWindow();
+  win.setSize(300, 300);
+
+  f3d::scene& sce = eng.getScene();
+  sce.add(std::string(argv[1]) + "/data/cow.vtp");
+  win.render();
+
+  // offscreen windows do not build the acceleration structures after a render,
+  // the first pick falls back to the VTK pickers and starts building them
+  const f3d::window::pick_result_t first = win.pick(150, 150);
+  test("pick the center", first.picked);
+  test("picked actor name", first.name, std::string("actor_0"));
+
+  const f3d::window::pick_result_t empty = win.pick(2, 2);
+  test("pick the background", !empty.picked);
+  test("no actor name when nothing is picked", empty.name.empty());
+
+  const f3d::window::pick_result_t second = ::WaitUntilAccelerated(win, 150, 150);
+  test("pick the center using the acceleration structures", second.accelerated);
+  test("pick the center again", second.picked);
+  test("picked actor name again", second.name, std::string("actor_0"));
+  test("accelerated pick is consistent",
+    std::abs(first.position[0] - second.position[0]) < 1e-3 &&
+      std::abs(first.position[1] - second.position[1]) < 1e-3 &&
+      std::abs(first.position[2] - second.position[2]) < 1e-3);
+
+  const f3d::window::pick_result_t background = win.pick(2, 2);
+  test("pick the background using the acceleration structures", background.accelerated);
+  test("pick the background again", !background.picked);
+
+  return test.result();
+}
@@ -0,0 +1,79 @@
+#include <vtkInformation.h>
+#include <vtkMultiBlockDataSet.h>
+#include <vtkNew.h>
+#include <vtkStreamingDemandDrivenPipeline.h>
+#include <vtkTestUtilities.h>
+
+#include "vtkF3DAlembicReader.h"
+
+#include <iostream>
+#include <vector>
+
+namespace
+{
+//----------------------------------------------------------------------------
+std::vector<vtkDataObject*> GetBlocks(vtkF3DAlembicReader* reader, double time)
+{
+  reader->UpdateTimeStep(time);
+  vtkMultiBlockDataSet* output = reader->GetOutput();
+  std::vector<vtkDataObject*> blocks;
+  for (unsigned int i = 0; i < output->GetNumberOfBlocks(); i++)
+  {
+    blocks.push_back(output->GetBlock(i));
+  }
+  return blocks;
+}
+}
+
+int TestF3DAlembicReaderChangeTracking(int vtkNotUsed(argc), char* argv[])
+{
+  std::string filename = std::string(argv[1]) + "data/xform_anim.abc";
+  vtkNew<vtkF3DAlembicReader> reader;
+  reader->SetFileName(filename);
+  reader->UpdateInformation();
+
+  vtkInformation* info = reader->GetOutputInformation(0);
+  if (!info->Has(vtkStreamingDemandDrivenPipeline::TIME_RANGE()))
+  {
+    std::cerr << "Expected an animated file\n";
+    return EXIT_FAILURE;
+  }
+  const double* timeRange = info->Get(vtkStreamingDemandDrivenPipeline::TIME_RANGE());
+
+  std::vector<vtkDataObject*> first = ::GetBlocks(reader, timeRange[0]);
+  if (first.empty() || reader->GetOutput()->GetNumberOfPoints() == 0)
+  {
+    std::cerr << "Expected at least one non empty block\n";
+    return EXIT_FAILURE;
+  }
+
+  for (vtkDataObject* block : first)
+  {
+    if (!block)
+    {
+      std::cerr << "Unexpected empty block\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Another time value must update the animated objects
+  std::vector<vtkDataObject*> last = ::GetBlocks(reader, timeRange[1]);
+  if (last.size() != first.size() || last == first)
+  {
+    std::cerr << "Animated blocks were not updated\n";
+    return EXIT_FAILURE;
+  }
+
+  // Objects of a static file must not be updated when the time changes
+  filename = std::string(argv[1]) + "data/suzanne.abc";
+  vtkNew<vtkF3DAlembicReader> staticReader;
+  staticReader->SetFileName(filename);
+  first = ::GetBlocks(staticReader, 0.0);
+  if (first.empty() || ::GetBlocks(staticReader, 1.0) != first)
+  {
+    std::cerr << "Static blocks were updated\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
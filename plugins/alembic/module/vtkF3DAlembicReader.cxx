@@ -1,15 +1,17 @@
 #include "vtkF3DAlembicReader.h"
 
+#include "F3DTrace.h"
 #include "vtkF3DFaceVaryingPointDispatcher.h"
 
-#include <vtkAppendPolyData.h>
 #include <vtkFloatArray.h>
 #include <vtkIdTypeArray.h>
 #include <vtkInformation.h>
 #include <vtkInformationVector.h>
+#include <vtkMultiBlockDataSet.h>
 #include <vtkObjectFactory.h>
 #include <vtkPointData.h>
 #include <vtkPoints.h>
+#include <vtkPolyData.h>
 #include <vtkPolyLine.h>
 #include <vtkResourceStream.h>
 #include <vtkSmartPointer.h>
@@ -28,6 +30,7 @@
 #pragma warning(pop)
 #endif
 
+#include <algorithm>
 #include <numeric>
 #include <stack>
 #include <tuple>
@@ -197,9 +200,33 @@ class vtkF3DAlembicReader::vtkInternals
   }
 
 public:
-  std::map<std::string, vtkSmartPointer<vtkPolyData>> OutputCache;
-  vtkSmartPointer<vtkPolyData> ProcessIPolyMesh(
-    const Alembic::AbcGeom::IPolyMesh& pmesh, double time, const Alembic::Abc::M44d& matrix)
+  /**
+   * A geometric object of the archive, with its ancestor transforms and the state of its
+   * last update, so that only what changed between two time values is updated again.
+   * Its geometry is kept in object space, separately from its world space output.
+   */
+  struct ObjectState
+  {
+    std::string Name;
+    bool IsMesh = true;
+    Alembic::AbcGeom::IPolyMesh Mesh;
+    Alembic::AbcGeom::ICurves Curves;
+    std::vector<Alembic::AbcGeom::IXform> Xforms; // from root to the closest ancestor
+    bool TransformConstant = true;
+    bool TopologyConstant = false;
+
+    bool HasMatrix = false;
+    Alembic::Abc::M44d Matrix;
+    Alembic::Abc::index_t GeometrySampleIndex = -1;
+    bool ReverseRotate = false;
+    vtkSmartPointer<vtkPolyData> Local;
+    vtkSmartPointer<vtkPolyData> World;
+  };
+  std::vector<ObjectState> Objects;
+
+  vtkSmartPointer<vtkPolyData> ProcessIPolyMesh(const Alembic::AbcGeom::IPolyMesh& pmesh,
+    const Alembic::AbcGeom::ISampleSelector& selector, bool doReverseRotate,
+    vtkPolyData* previous)
   {
     vtkNew<vtkPolyData> polydata;
     IntermediateGeometry originalData;
@@ -212,18 +239,13 @@ public:
       return polydata;
     }
 
-    Alembic::AbcGeom::ISampleSelector selector(time);
     schema.get(samp, selector);
-    const std::string& meshName = pmesh.getName();
-    auto topologyVariance = schema.getTopologyVariance();
-    bool isTopologyConstant = (topologyVariance == Alembic::AbcGeom::kConstantTopology) ||
-      (topologyVariance == Alembic::AbcGeom::kHomogenousTopology);
     Alembic::AbcGeom::P3fArraySamplePtr positions = samp.getPositions();
 
-    if (isTopologyConstant && this->OutputCache.count(meshName))
+    if (previous && previous->GetNumberOfPoints() > 0)
     {
-      vtkPolyData* cachedPoly = this->OutputCache[meshName];
-      polydata->ShallowCopy(cachedPoly);
+      // Constant topology, only update positions and normals
+      polydata->ShallowCopy(previous);
 
       vtkIdTypeArray* sourceIds =
         vtkIdTypeArray::SafeDownCast(polydata->GetPointData()->GetArray("SourceIds"));
@@ -238,9 +260,8 @@ public:
           vtkIdType rawIndex = sourceIds->GetTypedComponent(i, 0);
           if (rawIndex < static_cast<vtkIdType>(positions->size()))
           {
-            Alembic::Abc::V3f tp;
-            matrix.multVecMatrix(positions->get()[rawIndex], tp);
-            newPoints->SetPoint(i, tp.x, tp.y, tp.z);
+            const Alembic::Abc::V3f& p = positions->get()[rawIndex];
+            newPoints->SetPoint(i, p.x, p.y, p.z);
           }
         }
       }
@@ -248,41 +269,36 @@ public:
       {
         for (size_t i = 0; i < positions->size() && i < static_cast<size_t>(numPoints); i++)
         {
-          const Alembic::Abc::V3f tp = positions->get()[i] * matrix;
-          newPoints->SetPoint(i, tp.x, tp.y, tp.z);
+          const Alembic::Abc::V3f& p = positions->get()[i];
+          newPoints->SetPoint(i, p.x, p.y, p.z);
         }
       }
       polydata->SetPoints(newPoints);
 
-      // Update Normals
+      // Update Normals, in a new array as the previous one may still be in use
       Alembic::AbcGeom::IN3fGeomParam normalsParam = schema.getNormalsParam();
-      if (normalsParam.valid())
+      vtkFloatArray* previousNormals =
+        vtkFloatArray::SafeDownCast(polydata->GetPointData()->GetNormals());
+      if (normalsParam.valid() && previousNormals)
       {
         Alembic::AbcGeom::IN3fGeomParam::Sample normalValue =
           normalsParam.getIndexedValue(selector);
-        if (normalValue.valid())
+        auto vals = normalValue.valid() ? normalValue.getVals() : nullptr;
+        if (vals)
         {
-          vtkFloatArray* normals =
-            vtkFloatArray::SafeDownCast(polydata->GetPointData()->GetNormals());
-          if (normals)
+          vtkNew<vtkFloatArray> normals;
+          normals->DeepCopy(previousNormals);
+          const vtkIdType numNormals = normals->GetNumberOfTuples();
+          for (vtkIdType i = 0; i < numNormals; i++)
           {
-            const vtkIdType numNormals = normals->GetNumberOfTuples();
-
-            auto vals = normalValue.getVals();
-            if (vals)
+            const vtkIdType rawIndex = sourceIds ? sourceIds->GetTypedComponent(i, 0) : i;
+            if (rawIndex < static_cast<vtkIdType>(vals->size()))
             {
-              for (vtkIdType i = 0; i < numNormals; i++)
-              {
-                const vtkIdType rawIndex = sourceIds ? sourceIds->GetTypedComponent(i, 0) : i;
-                if (rawIndex < static_cast<vtkIdType>(vals->size()))
-                {
-                  Alembic::Abc::V3f normal;
-                  matrix.multDirMatrix((*vals)[rawIndex], normal);
-                  normals->SetTuple3(i, normal.x, normal.y, normal.z);
-                }
-              }
+              const Alembic::Abc::V3f& normal = (*vals)[rawIndex];
+              normals->SetTuple3(i, normal.x, normal.y, normal.z);
             }
           }
+          polydata->GetPointData()->SetNormals(normals);
         }
       }
     }
@@ -292,19 +308,9 @@ public:
       Alembic::AbcGeom::Int32ArraySamplePtr faceVertexCounts = samp.getFaceCounts();
       this->SetupIndicesStorage(faceVertexCounts, originalData.Indices);
 
-      // By default, Alembic is CW while VTK is CCW
-      // So we need to reverse the order of indices only if the mesh is not mirrored
-      const bool doReverseRotate = matrix.determinant() > 0;
-
       // Positions
       {
-        V3fContainer pV3F;
-        for (size_t pIndex = 0; pIndex < positions->size(); pIndex++)
-        {
-          Alembic::Abc::V3f tp;
-          matrix.multVecMatrix(positions->get()[pIndex], tp);
-          pV3F.emplace_back(tp.x, tp.y, tp.z);
-        }
+        V3fContainer pV3F(positions->get(), positions->get() + positions->size());
         originalData.Attributes.insert(AttributesContainer::value_type("P", pV3F));
         this->UpdateIndices<Alembic::AbcGeom::Int32ArraySamplePtr>(
           facePositionIndices, pIndicesOffset, originalData.Indices, doReverseRotate);
@@ -345,14 +351,9 @@ public:
           normalsParam.getIndexedValue(selector);
         if (normalValue.valid())
         {
-          V3fContainer normal_v3f;
+          const auto& vals = *normalValue.getVals();
+          V3fContainer normal_v3f(vals.get(), vals.get() + vals.size());
           Alembic::AbcGeom::UInt32ArraySamplePtr normalIndices = normalValue.getIndices();
-          for (size_t index = 0; index < normalValue.getVals()->size(); ++index)
-          {
-            Alembic::AbcGeom::V3f normal;
-            matrix.multDirMatrix((*(normalValue.getVals()))[index], normal);
-            normal_v3f.emplace_back(normal);
-          }
           originalData.Attributes.insert(AttributesContainer::value_type("N", normal_v3f));
           if (normalsParam.getScope() == Alembic::AbcGeom::kFacevaryingScope)
           {
@@ -377,18 +378,12 @@ public:
         faceVaryingFilter->Update();
         polydata->ShallowCopy(faceVaryingFilter->GetOutput());
       }
-
-      // Store data for the next frame
-      if (isTopologyConstant)
-      {
-        this->OutputCache[meshName] = polydata;
-      }
     }
     return polydata;
   }
 
   vtkSmartPointer<vtkPolyData> ProcessICurves(
-    const Alembic::AbcGeom::ICurves& curve, double time, const Alembic::Abc::M44d& matrix)
+    const Alembic::AbcGeom::ICurves& curve, const Alembic::AbcGeom::ISampleSelector& selector)
   {
     vtkNew<vtkPolyData> polydata;
 
@@ -397,7 +392,6 @@ public:
 
     if (schema.getNumSamples() > 0)
     {
-      Alembic::AbcGeom::ISampleSelector selector(time);
       schema.get(samp, selector);
 
       Alembic::AbcGeom::P3fArraySamplePtr positions = samp.getPositions();
@@ -407,9 +401,8 @@ public:
       points->SetNumberOfPoints(positions->size());
       for (size_t pIndex = 0; pIndex < positions->size(); ++pIndex)
       {
-        Alembic::Abc::V3f tp;
-        matrix.multVecMatrix(positions->get()[pIndex], tp);
-        points->SetPoint(pIndex, tp.x, tp.y, tp.z);
+        const Alembic::Abc::V3f& p = positions->get()[pIndex];
+        points->SetPoint(pIndex, p.x, p.y, p.z);
       }
 
       size_t pOffsetIndex = 0;
@@ -435,50 +428,171 @@ public:
     return polydata;
   }
 
-  void ImportRoot(vtkAppendPolyData* append, double time)
+  /**
+   * Create a world space version of an object space geometry.
+   * Topology and other attributes are shared.
+   */
+  static vtkSmartPointer<vtkPolyData> ApplyMatrix(
+    vtkPolyData* local, const Alembic::Abc::M44d& matrix)
   {
-    const Alembic::Abc::IObject top = this->Archive.getTop();
-    const Alembic::AbcGeom::ISampleSelector selector(time);
+    vtkNew<vtkPolyData> world;
+    world->ShallowCopy(local);
+
     Alembic::Abc::M44d identity;
     identity.makeIdentity();
+    vtkPoints* localPoints = local->GetPoints();
+    if (matrix == identity || !localPoints)
+    {
+      return world;
+    }
+
+    const vtkIdType numPoints = localPoints->GetNumberOfPoints();
+    vtkNew<vtkPoints> points;
+    points->SetNumberOfPoints(numPoints);
+    for (vtkIdType i = 0; i < numPoints; i++)
+    {
+      const double* p = localPoints->GetPoint(i);
+      Alembic::Abc::V3f tp;
+      matrix.multVecMatrix(Alembic::Abc::V3f(static_cast<float>(p[0]),
+                             static_cast<float>(p[1]), static_cast<float>(p[2])),
+        tp);
+      points->SetPoint(i, tp.x, tp.y, tp.z);
+    }
+    world->SetPoints(points);
+
+    vtkFloatArray* localNormals = vtkFloatArray::SafeDownCast(local->GetPointData()->GetNormals());
+    if (localNormals)
+    {
+      vtkNew<vtkFloatArray> normals;
+      normals->DeepCopy(localNormals);
+      for (vtkIdType i = 0; i < normals->GetNumberOfTuples(); i++)
+      {
+        const float* n = localNormals->GetPointer(3 * i);
+        Alembic::Abc::V3f normal;
+        matrix.multDirMatrix(Alembic::Abc::V3f(n[0], n[1], n[2]), normal);
+        normals->SetTuple3(i, normal.x, normal.y, normal.z);
+      }
+      world->GetPointData()->SetNormals(normals);
+    }
+    return world;
+  }
+
+  /**
+   * Update an object for the provided time.
+   * Transforms and geometries are sampled again only if they are not constant,
+   * and the world space output is recreated only if one of them changed.
+   */
+  void UpdateObject(ObjectState& state, double time)
+  {
+    const Alembic::AbcGeom::ISampleSelector selector(time);
+
+    bool matrixChanged = false;
+    if (!state.HasMatrix || !state.TransformConstant)
+    {
+      Alembic::Abc::M44d matrix;
+      matrix.makeIdentity();
+      for (const Alembic::AbcGeom::IXform& xForm : state.Xforms)
+      {
+        Alembic::AbcGeom::XformSample xFormSamp;
+        xForm.getSchema().get(xFormSamp, selector);
+        matrix = xFormSamp.getMatrix() * matrix;
+      }
+      matrixChanged = !state.HasMatrix || matrix != state.Matrix;
+      state.Matrix = matrix;
+      state.HasMatrix = true;
+    }
+
+    // By default, Alembic is CW while VTK is CCW
+    // So we need to reverse the order of indices only if the mesh is not mirrored
+    const bool doReverseRotate = state.Matrix.determinant() > 0;
+
+    Alembic::Abc::TimeSamplingPtr ts = state.IsMesh
+      ? state.Mesh.getSchema().getTimeSampling()
+      : state.Curves.getSchema().getTimeSampling();
+    const size_t numSamples = state.IsMesh ? state.Mesh.getSchema().getNumSamples()
+                                           : state.Curves.getSchema().getNumSamples();
+    const Alembic::Abc::index_t sampleIndex =
+      numSamples > 0 ? ts->getNearIndex(time, numSamples).first : 0;
+
+    const bool windingChanged = state.IsMesh && doReverseRotate != state.ReverseRotate;
+    const bool geometryChanged =
+      !state.Local || sampleIndex != state.GeometrySampleIndex || windingChanged;
+    if (geometryChanged)
+    {
+      if (state.IsMesh)
+      {
+        vtkPolyData* previous = state.TopologyConstant && !windingChanged ? state.Local : nullptr;
+        state.Local = this->ProcessIPolyMesh(state.Mesh, selector, doReverseRotate, previous);
+      }
+      else
+      {
+        state.Local = this->ProcessICurves(state.Curves, selector);
+      }
+      state.GeometrySampleIndex = sampleIndex;
+      state.ReverseRotate = doReverseRotate;
+    }
+
+    if (geometryChanged || matrixChanged)
+    {
+      state.World = vtkInternals::ApplyMatrix(state.Local, state.Matrix);
+    }
+  }
+
+  /**
+   * Walk the hierarchy once to collect geometric objects and their ancestor transforms.
+   */
+  void CollectObjects()
+  {
+    this->Objects.clear();
+
+    const Alembic::Abc::IObject top = this->Archive.getTop();
 
     std::stack<std::tuple<const Alembic::Abc::IObject, const Alembic::Abc::ObjectHeader,
-      const Alembic::Abc::M44d>>
+      const std::vector<Alembic::AbcGeom::IXform>>>
       objects;
 
     for (size_t i = 0; i < top.getNumChildren(); ++i)
     {
-      objects.emplace(std::make_tuple(top, top.getChildHeader(i), identity));
+      objects.emplace(
+        std::make_tuple(top, top.getChildHeader(i), std::vector<Alembic::AbcGeom::IXform>()));
     }
 
     while (!objects.empty())
     {
-      const auto& [parent, ohead, matrix] = objects.top();
+      const auto [parent, ohead, xForms] = objects.top();
+      objects.pop();
+
       const Alembic::AbcGeom::IObject obj(parent, ohead.getName());
-      Alembic::Abc::M44d objMatrix = matrix;
-      if (Alembic::AbcGeom::IPolyMesh::matches(ohead))
+      std::vector<Alembic::AbcGeom::IXform> objXforms = xForms;
+      if (Alembic::AbcGeom::IPolyMesh::matches(ohead) || Alembic::AbcGeom::ICurves::matches(ohead))
       {
-        const Alembic::AbcGeom::IPolyMesh polymesh(parent, ohead.getName());
-        append->AddInputData(this->ProcessIPolyMesh(polymesh, time, objMatrix));
-      }
-      else if (Alembic::AbcGeom::ICurves::matches(ohead))
-      {
-        const Alembic::AbcGeom::ICurves curve(parent, ohead.getName());
-        append->AddInputData(this->ProcessICurves(curve, time, objMatrix));
+        ObjectState state;
+        state.Name = ohead.getName();
+        state.Xforms = xForms;
+        state.TransformConstant = std::ranges::all_of(
+          xForms, [](const auto& xForm) { return xForm.getSchema().isConstant(); });
+        state.IsMesh = Alembic::AbcGeom::IPolyMesh::matches(ohead);
+        if (state.IsMesh)
+        {
+          state.Mesh = Alembic::AbcGeom::IPolyMesh(parent, ohead.getName());
+          auto topologyVariance = state.Mesh.getSchema().getTopologyVariance();
+          state.TopologyConstant = (topologyVariance == Alembic::AbcGeom::kConstantTopology) ||
+            (topologyVariance == Alembic::AbcGeom::kHomogenousTopology);
+        }
+        else
+        {
+          state.Curves = Alembic::AbcGeom::ICurves(parent, ohead.getName());
+        }
+        this->Objects.emplace_back(std::move(state));
       }
       else if (Alembic::AbcGeom::IXform::matches(ohead))
       {
-        const Alembic::AbcGeom::IXform xForm(parent, ohead.getName());
-        const Alembic::AbcGeom::IXformSchema& xFormSchema = xForm.getSchema();
-        Alembic::AbcGeom::XformSample xFormSamp;
-        xFormSchema.get(xFormSamp, selector);
-        objMatrix = xFormSamp.getMatrix() * matrix;
+        objXforms.emplace_back(parent, ohead.getName());
       }
 
-      objects.pop();
       for (size_t i = 0; i < obj.getNumChildren(); ++i)
       {
-        objects.emplace(std::make_tuple(obj, obj.getChildHeader(i), objMatrix));
+        objects.emplace(std::make_tuple(obj, obj.getChildHeader(i), objXforms));
       }
     }
   }
@@ -614,6 +728,7 @@ int vtkF3DAlembicReader::RequestInformation(vtkInformation* vtkNotUsed(request),
     vtkErrorMacro("Unable to read this alembic file or stream");
     return 0;
   }
+  this->Internals->CollectObjects();
 
   double timeRange[2] = { std::numeric_limits<double>::infinity(),
     -std::numeric_limits<double>::infinity() };
@@ -632,7 +747,9 @@ int vtkF3DAlembicReader::RequestInformation(vtkInformation* vtkNotUsed(request),
 int vtkF3DAlembicReader::RequestData(
   vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector)
 {
-  vtkPolyData* output = vtkPolyData::GetData(outputVector);
+  F3D_TRACE_SCOPE_DETAIL("Read Alembic archive", this->FileName);
+
+  vtkMultiBlockDataSet* output = vtkMultiBlockDataSet::GetData(outputVector);
   vtkInformation* outInfo = outputVector->GetInformationObject(0);
 
   double requestedTimeValue = 0.0;
@@ -642,11 +759,16 @@ int vtkF3DAlembicReader::RequestData(
     requestedTimeValue = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
   }
 
-  vtkNew<vtkAppendPolyData> append;
-  this->Internals->ImportRoot(append, requestedTimeValue);
-  append->Update();
-
-  output->ShallowCopy(append->GetOutput());
+  // One block per object, unchanged objects keep the same output
+  auto& objects = this->Internals->Objects;
+  output->SetNumberOfBlocks(static_cast<unsigned int>(objects.size()));
+  for (size_t i = 0; i < objects.size(); i++)
+  {
+    this->Internals->UpdateObject(objects[i], requestedTimeValue);
+    const unsigned int blockIndex = static_cast<unsigned int>(i);
+    output->SetBlock(blockIndex, objects[i].World);
+    output->GetMetaData(blockIndex)->Set(vtkCompositeDataSet::NAME(), objects[i].Name.c_str());
+  }
 
   return 1;
 }
@@ -3,9 +3,10 @@
  * @brief   Reader using Alembic library
  *
  * This reader is based on Alembic 1.7
- * Currently, only polygonal points positions are retrieved
- * to build polygonal geometries. Vertex normals and texture
- * coordinates are not supported yet.
+ * Polygonal meshes and curves are read, with their normals and texture coordinates.
+ * The output is a multiblock with one block per object. When the time changes,
+ * only objects with animated transforms or geometries are updated, other blocks are
+ * kept as is.
  *
  * This reader supports reading streams.
  *
@@ -17,17 +18,17 @@
 #define vtkF3DAlembicReader_h
 
 #include <vtkNew.h>
-#include <vtkPolyDataAlgorithm.h>
+#include <vtkMultiBlockDataSetAlgorithm.h>
 #include <vtkVersion.h>
 
 #include <memory>
 
 class vtkResourceStream;
-class vtkF3DAlembicReader : public vtkPolyDataAlgorithm
+class vtkF3DAlembicReader : public vtkMultiBlockDataSetAlgorithm
 {
 public:
   static vtkF3DAlembicReader* New();
-  vtkTypeMacro(vtkF3DAlembicReader, vtkPolyDataAlgorithm);
+  vtkTypeMacro(vtkF3DAlembicReader, vtkMultiBlockDataSetAlgorithm);
 
   /**
    * Set the file name.
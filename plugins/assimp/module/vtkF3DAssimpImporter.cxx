@@ -1,5 +1,7 @@
 #include "vtkF3DAssimpImporter.h"
 
+#include "F3DTrace.h"
+
 #include <vtkActor.h>
 #include <vtkActorCollection.h>
 #include <vtkCamera.h>
@@ -1082,6 +1084,7 @@ vtkF3DAssimpImporter::~vtkF3DAssimpImporter() = default;
 //----------------------------------------------------------------------------
 int vtkF3DAssimpImporter::ImportBegin()
 {
+  F3D_TRACE_SCOPE_DETAIL("Read Assimp scene", this->GetFileName() ? this->GetFileName() : "stream");
   return this->Internals->ReadScene(
     this->GetStream(), this->GetFileName(), this->MemoryHint.c_str());
 }
@@ -1089,6 +1092,7 @@ int vtkF3DAssimpImporter::ImportBegin()
 //----------------------------------------------------------------------------
 void vtkF3DAssimpImporter::ImportActors(vtkRenderer* renderer)
 {
+  F3D_TRACE_SCOPE_DETAIL("Import Assimp actors", this->GetFileName() ? this->GetFileName() : "stream");
   this->Internals->ImportRoot(renderer);
 
   // Record all actors imported from internals to importer itself
@@ -0,0 +1,174 @@
+#include "vtkF3DGLTFDracoImporter.h"
+
+#include <vtkActor.h>
+#include <vtkActorCollection.h>
+#include <vtkNew.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+#include <vtkSMPTools.h>
+#include <vtksys/FStream.hxx>
+
+#include "draco/compression/encode.h"
+#include "draco/mesh/triangle_soup_mesh_builder.h"
+
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+namespace
+{
+constexpr int NumberOfPrimitives = 64;
+constexpr int GridSize = 8;
+
+//----------------------------------------------------------------------------
+// Encode a small triangulated grid, shifted by its index, with Draco
+std::vector<char> EncodePrimitive(int index, int& numberOfFaces)
+{
+  numberOfFaces = GridSize * GridSize * 2;
+  draco::TriangleSoupMeshBuilder builder;
+  builder.Start(numberOfFaces);
+  const int posId =
+    builder.AddAttribute(draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32);
+
+  int face = 0;
+  for (int i = 0; i < GridSize; i++)
+  {
+    for (int j = 0; j < GridSize; j++)
+    {
+      const float x = static_cast<float>(index * (GridSize + 1) + i);
+      const float y = static_cast<float>(j);
+      const float p0[3] = { x, y, 0.f };
+      const float p1[3] = { x + 1.f, y, 0.f };
+      const float p2[3] = { x + 1.f, y + 1.f, 0.f };
+      const float p3[3] = { x, y + 1.f, 0.f };
+      builder.SetAttributeValuesForFace(posId, draco::FaceIndex(face++), p0, p1, p2);
+      builder.SetAttributeValuesForFace(posId, draco::FaceIndex(face++), p0, p2, p3);
+    }
+  }
+
+  std::unique_ptr<draco::Mesh> mesh = builder.Finalize();
+  draco::Encoder encoder;
+  draco::EncoderBuffer buffer;
+  if (!encoder.EncodeMeshToBuffer(*mesh, &buffer).ok())
+  {
+    return {};
+  }
+  return { buffer.data(), buffer.data() + buffer.size() };
+}
+
+//----------------------------------------------------------------------------
+// Write a .glb with a single mesh containing many Draco compressed primitives
+bool WriteManyPrimitivesGLB(const std::string& path)
+{
+  std::vector<char> bin;
+  std::ostringstream bufferViews, accessors, primitives;
+  for (int i = 0; i < NumberOfPrimitives; i++)
+  {
+    int numberOfFaces;
+    std::vector<char> encoded = ::EncodePrimitive(i, numberOfFaces);
+    if (encoded.empty())
+    {
+      return false;
+    }
+
+    const char* sep = i == 0 ? "" : ",";
+    bufferViews << sep << R"({"buffer":0,"byteOffset":)" << bin.size() << R"(,"byteLength":)"
+                << encoded.size() << "}";
+    accessors << sep << R"({"componentType":5125,"count":)" << numberOfFaces * 3
+              << R"(,"type":"SCALAR"},)"
+              << R"({"componentType":5126,"count":)" << (GridSize + 1) * (GridSize + 1)
+              << R"(,"type":"VEC3","min":[)" << i * (GridSize + 1) << R"(,0,0],"max":[)"
+              << i * (GridSize + 1) + GridSize << "," << GridSize << ",0]}";
+    primitives << sep << R"({"attributes":{"POSITION":)" << 2 * i + 1 << R"(},"indices":)"
+               << 2 * i << R"(,"extensions":{"KHR_draco_mesh_compression":{"bufferView":)" << i
+               << R"(,"attributes":{"POSITION":0}}}})";
+
+    bin.insert(bin.end(), encoded.begin(), encoded.end());
+    bin.resize((bin.size() + 3) & ~static_cast<size_t>(3), '\0');
+  }
+
+  std::ostringstream json;
+  json << R"({"asset":{"version":"2.0"},)"
+       << R"("extensionsUsed":["KHR_draco_mesh_compression"],)"
+       << R"("extensionsRequired":["KHR_draco_mesh_compression"],)"
+       << R"("scene":0,"scenes":[{"nodes":[0]}],"nodes":[{"mesh":0}],)"
+       << R"("meshes":[{"primitives":[)" << primitives.str() << "]}],"
+       << R"("accessors":[)" << accessors.str() << "],"
+       << R"("bufferViews":[)" << bufferViews.str() << "],"
+       << R"("buffers":[{"byteLength":)" << bin.size() << "}]}";
+  std::string jsonStr = json.str();
+  jsonStr.resize((jsonStr.size() + 3) & ~static_cast<size_t>(3), ' ');
+
+  vtksys::ofstream file(path.c_str(), std::ios_base::binary);
+  auto writeUInt32 = [&](uint32_t value) { file.write(reinterpret_cast<char*>(&value), 4); };
+  file.write("glTF", 4);
+  writeUInt32(2);
+  writeUInt32(static_cast<uint32_t>(12 + 8 + jsonStr.size() + 8 + bin.size()));
+  writeUInt32(static_cast<uint32_t>(jsonStr.size()));
+  file.write("JSON", 4);
+  file.write(jsonStr.data(), static_cast<std::streamsize>(jsonStr.size()));
+  writeUInt32(static_cast<uint32_t>(bin.size()));
+  file.write("BIN\0", 4);
+  file.write(bin.data(), static_cast<std::streamsize>(bin.size()));
+  return file.good();
+}
+
+//----------------------------------------------------------------------------
+// Import the file and return the bounds of all actors, in order
+std::vector<double> Import(const std::string& path)
+{
+  vtkNew<vtkF3DGLTFDracoImporter> importer;
+  importer->SetFileName(path.c_str());
+  vtkNew<vtkRenderWindow> window;
+  vtkNew<vtkRenderer> renderer;
+  window->AddRenderer(renderer);
+  importer->SetRenderWindow(window);
+
+  if (!importer->Update())
+  {
+    return {};
+  }
+
+  std::vector<double> bounds;
+  vtkActorCollection* actors = importer->GetImportedActors();
+  actors->InitTraversal();
+  while (vtkActor* actor = actors->GetNextActor())
+  {
+    const double* actorBounds = actor->GetBounds();
+    bounds.insert(bounds.end(), actorBounds, actorBounds + 6);
+  }
+  return bounds;
+}
+}
+
+int TestF3DGLTFDracoImporterManyPrimitives(int vtkNotUsed(argc), char* argv[])
+{
+  const std::string path = std::string(argv[2]) + "TestF3DGLTFDracoImporterManyPrimitives.glb";
+  if (!::WriteManyPrimitivesGLB(path))
+  {
+    std::cerr << "Failed to write the test file\n";
+    return EXIT_FAILURE;
+  }
+
+  // Parallel decoding, with the default SMP backend
+  std::vector<double> parallelBounds = ::Import(path);
+  if (parallelBounds.size() != 6 * NumberOfPrimitives)
+  {
+    std::cerr << "Unexpected number of imported actors: " << parallelBounds.size() / 6 << "\n";
+    return EXIT_FAILURE;
+  }
+
+  // Serial decoding must give the exact same output
+  const std::string backend = vtkSMPTools::GetBackend();
+  vtkSMPTools::SetBackend("Sequential");
+  std::vector<double> serialBounds = ::Import(path);
+  vtkSMPTools::SetBackend(backend.c_str());
+
+  if (parallelBounds != serialBounds)
+  {
+    std::cerr << "Parallel decoding output differs from serial decoding output\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
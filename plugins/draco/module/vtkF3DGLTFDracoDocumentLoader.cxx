@@ -1,8 +1,10 @@
 #include "vtkF3DGLTFDracoDocumentLoader.h"
 
 #include <vtkObjectFactory.h>
+#include <vtkSMPTools.h>
 
 #include <algorithm>
+#include <vector>
 
 #include "draco/compression/decode.h"
 
@@ -98,6 +100,59 @@ std::vector<char> DecodeVertexBuffer(vtkGLTFDocumentLoader::ComponentType compTy
   return ComponentDispatcher<VertexBufferDecoder>(
     compType, mesh, mesh->GetAttributeByUniqueId(attIndex));
 }
+
+//----------------------------------------------------------------------------
+struct DecodedPrimitive
+{
+  bool Success = false;
+  size_t NumberOfFaces = 0;
+  size_t NumberOfPoints = 0;
+  std::vector<char> IndexBuffer;
+  std::vector<std::vector<char>> VertexBuffers;
+};
+
+//----------------------------------------------------------------------------
+// Decode a Draco compressed primitive without modifying the model, so that it can run concurrently
+DecodedPrimitive DecodePrimitive(
+  const vtkGLTFDocumentLoader::Model& model, const vtkGLTFDocumentLoader::Primitive& primitive)
+{
+  DecodedPrimitive decoded;
+
+  const auto& dracoMetaData = primitive.ExtensionMetaData.KHRDracoMetaData;
+  const auto& view = model.BufferViews[dracoMetaData.BufferView];
+  const auto& buffer = model.Buffers[view.Buffer];
+
+  draco::DecoderBuffer decoderBuffer;
+  decoderBuffer.Init(buffer.data() + view.ByteOffset, view.ByteLength);
+  auto decodeResult = draco::Decoder().DecodeMeshFromBuffer(&decoderBuffer);
+  if (!decodeResult.ok())
+  {
+    return decoded;
+  }
+
+  const std::unique_ptr<draco::Mesh>& mesh = decodeResult.value();
+  decoded.NumberOfFaces = mesh->num_faces();
+  decoded.NumberOfPoints = mesh->num_points();
+
+  if (primitive.IndicesId >= 0)
+  {
+    decoded.IndexBuffer =
+      ::DecodeIndexBuffer(mesh, model.Accessors[primitive.IndicesId].ComponentTypeValue);
+  }
+
+  for (const auto& attrib : dracoMetaData.AttributeIndices)
+  {
+    // Mimic the accessor lookup done when appending buffers
+    auto accessorIt = primitive.AttributeIndices.find(attrib.first);
+    int accessorIndex = accessorIt != primitive.AttributeIndices.end() ? accessorIt->second : 0;
+    const auto& attrAccessor = model.Accessors[accessorIndex];
+    decoded.VertexBuffers.emplace_back(
+      ::DecodeVertexBuffer(attrAccessor.ComponentTypeValue, mesh, attrib.second));
+  }
+
+  decoded.Success = true;
+  return decoded;
+}
 }
 
 //----------------------------------------------------------------------------
@@ -116,67 +171,80 @@ void vtkF3DGLTFDracoDocumentLoader::PrepareData()
 {
   std::shared_ptr<Model> model = this->GetInternalModel();
 
-  for (size_t i = 0; i < model->Meshes.size(); i++)
+  // Collect all Draco compressed primitives, in a fixed order
+  std::vector<Primitive*> primitives;
+  for (Mesh& mesh : model->Meshes)
   {
-    for (Primitive& primitive : model->Meshes[i].Primitives)
+    for (Primitive& primitive : mesh.Primitives)
     {
       // check if Draco metadata is present
-      auto& dracoMetaData = primitive.ExtensionMetaData.KHRDracoMetaData;
-      if (dracoMetaData.BufferView >= 0)
+      if (primitive.ExtensionMetaData.KHRDracoMetaData.BufferView >= 0)
+      {
+        primitives.emplace_back(&primitive);
+      }
+    }
+  }
+
+  // Decode all primitives concurrently, the model is only read during this step
+  std::vector<DecodedPrimitive> decoded(primitives.size());
+  vtkSMPTools::For(0, static_cast<vtkIdType>(primitives.size()),
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType i = begin; i < end; i++)
       {
-        auto& view = model->BufferViews[primitive.ExtensionMetaData.KHRDracoMetaData.BufferView];
-        auto& buffer = model->Buffers[view.Buffer];
-
-        draco::DecoderBuffer decoderBuffer;
-        decoderBuffer.Init(buffer.data() + view.ByteOffset, view.ByteLength);
-        auto decodeResult = draco::Decoder().DecodeMeshFromBuffer(&decoderBuffer);
-        if (decodeResult.ok())
-        {
-          const std::unique_ptr<draco::Mesh>& mesh = decodeResult.value();
-
-          // handle index buffer
-          if (primitive.IndicesId >= 0)
-          {
-            auto& accessor = model->Accessors[primitive.IndicesId];
-
-            model->Buffers.emplace_back(::DecodeIndexBuffer(mesh, accessor.ComponentTypeValue));
-
-            vtkGLTFDocumentLoader::BufferView decodedIndexBufferView;
-            decodedIndexBufferView.Buffer = static_cast<int>(model->Buffers.size() - 1);
-            decodedIndexBufferView.ByteLength = model->Buffers.back().size();
-            decodedIndexBufferView.ByteOffset = 0;
-            decodedIndexBufferView.ByteStride = 0;
-            decodedIndexBufferView.Target =
-              static_cast<int>(vtkGLTFDocumentLoader::Target::ARRAY_BUFFER);
-            model->BufferViews.emplace_back(std::move(decodedIndexBufferView));
-
-            accessor.BufferView = static_cast<int>(model->BufferViews.size() - 1);
-            accessor.Count = static_cast<int>(mesh->num_faces() * 3);
-          }
-
-          // handle vertex attributes
-          for (const auto& attrib : dracoMetaData.AttributeIndices)
-          {
-            auto& attrAccessor = model->Accessors[primitive.AttributeIndices[attrib.first]];
-
-            model->Buffers.emplace_back(
-              ::DecodeVertexBuffer(attrAccessor.ComponentTypeValue, mesh, attrib.second));
-
-            vtkGLTFDocumentLoader::BufferView decodedBufferView;
-            decodedBufferView.Buffer = static_cast<int>(model->Buffers.size() - 1);
-            decodedBufferView.ByteLength = model->Buffers.back().size();
-            decodedBufferView.ByteOffset = 0;
-            decodedBufferView.ByteStride = 0;
-            decodedBufferView.Target =
-              static_cast<int>(vtkGLTFDocumentLoader::Target::ELEMENT_ARRAY_BUFFER);
-            model->BufferViews.emplace_back(std::move(decodedBufferView));
-
-            attrAccessor.BufferView = static_cast<int>(model->BufferViews.size() - 1);
-            attrAccessor.Count = static_cast<int>(mesh->num_points());
-            attrAccessor.ByteOffset = 0;
-          }
-        }
+        decoded[i] = ::DecodePrimitive(*model, *primitives[i]);
       }
+    });
+
+  // Append decoded buffers serially, in the same order as a serial decoding would
+  for (size_t i = 0; i < primitives.size(); i++)
+  {
+    Primitive& primitive = *primitives[i];
+    DecodedPrimitive& decodedPrimitive = decoded[i];
+    if (!decodedPrimitive.Success)
+    {
+      continue;
+    }
+
+    // handle index buffer
+    if (primitive.IndicesId >= 0)
+    {
+      auto& accessor = model->Accessors[primitive.IndicesId];
+
+      model->Buffers.emplace_back(std::move(decodedPrimitive.IndexBuffer));
+
+      vtkGLTFDocumentLoader::BufferView decodedIndexBufferView;
+      decodedIndexBufferView.Buffer = static_cast<int>(model->Buffers.size() - 1);
+      decodedIndexBufferView.ByteLength = model->Buffers.back().size();
+      decodedIndexBufferView.ByteOffset = 0;
+      decodedIndexBufferView.ByteStride = 0;
+      decodedIndexBufferView.Target = static_cast<int>(vtkGLTFDocumentLoader::Target::ARRAY_BUFFER);
+      model->BufferViews.emplace_back(std::move(decodedIndexBufferView));
+
+      accessor.BufferView = static_cast<int>(model->BufferViews.size() - 1);
+      accessor.Count = static_cast<int>(decodedPrimitive.NumberOfFaces * 3);
+    }
+
+    // handle vertex attributes
+    size_t attributeIndex = 0;
+    for (const auto& attrib : primitive.ExtensionMetaData.KHRDracoMetaData.AttributeIndices)
+    {
+      auto& attrAccessor = model->Accessors[primitive.AttributeIndices[attrib.first]];
+
+      model->Buffers.emplace_back(std::move(decodedPrimitive.VertexBuffers[attributeIndex++]));
+
+      vtkGLTFDocumentLoader::BufferView decodedBufferView;
+      decodedBufferView.Buffer = static_cast<int>(model->Buffers.size() - 1);
+      decodedBufferView.ByteLength = model->Buffers.back().size();
+      decodedBufferView.ByteOffset = 0;
+      decodedBufferView.ByteStride = 0;
+      decodedBufferView.Target =
+        static_cast<int>(vtkGLTFDocumentLoader::Target::ELEMENT_ARRAY_BUFFER);
+      model->BufferViews.emplace_back(std::move(decodedBufferView));
+
+      attrAccessor.BufferView = static_cast<int>(model->BufferViews.size() - 1);
+      attrAccessor.Count = static_cast<int>(decodedPrimitive.NumberOfPoints);
+      attrAccessor.ByteOffset = 0;
     }
   }
 }
@@ -1,5 +1,8 @@
 #include <vtkFileResourceStream.h>
+#include <vtkDataArray.h>
 #include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkSMPTools.h>
 #include <vtkTestUtilities.h>
 
 #include "vtkF3DSPZReader.h"
@@ -42,6 +45,44 @@ int TestF3DSPZReader(int vtkNotUsed(argc), char* argv[])
     return EXIT_FAILURE;
   }
 
+  // Chunked parallel decoding must give the same output as sequential decoding
+  path = std::string(argv[1]) + "data/hornedlizard_small_d3.spz";
+  vtkNew<vtkF3DSPZReader> parallelReader;
+  parallelReader->SetFileName(path.c_str());
+  parallelReader->Update();
+  vtkPointData* parallelData = parallelReader->GetOutput()->GetPointData();
+
+  const std::string backend = vtkSMPTools::GetBackend();
+  vtkSMPTools::SetBackend("Sequential");
+  vtkNew<vtkF3DSPZReader> sequentialReader;
+  sequentialReader->SetFileName(path.c_str());
+  sequentialReader->Update();
+  vtkSMPTools::SetBackend(backend.c_str());
+  vtkPointData* sequentialData = sequentialReader->GetOutput()->GetPointData();
+
+  // color, scale, rotation and 15 spherical harmonics coefficients
+  if (parallelData->GetNumberOfArrays() != 18 ||
+    sequentialData->GetNumberOfArrays() != parallelData->GetNumberOfArrays())
+  {
+    std::cerr << "Unexpected number of arrays: " << parallelData->GetNumberOfArrays() << "\n";
+    return EXIT_FAILURE;
+  }
+
+  for (int i = 0; i < parallelData->GetNumberOfArrays(); i++)
+  {
+    vtkDataArray* parallelArray = parallelData->GetArray(i);
+    vtkDataArray* sequentialArray = sequentialData->GetArray(i);
+    for (vtkIdType j = 0; j < parallelArray->GetNumberOfValues(); j++)
+    {
+      if (parallelArray->GetVariantValue(j) != sequentialArray->GetVariantValue(j))
+      {
+        std::cerr << "Parallel and sequential decoding differ for " << parallelArray->GetName()
+                  << "\n";
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
   path = std::string(argv[1]) + "data/f3d.vtp";
   if (!stream->Open(path.c_str()))
   {
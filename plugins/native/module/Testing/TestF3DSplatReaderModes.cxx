@@ -0,0 +1,149 @@
+#include <vtkFileResourceStream.h>
+#include <vtkFloatArray.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPolyData.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtksys/FStream.hxx>
+
+#include "vtkF3DSplatReader.h"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t NumberOfSplats = 10000;
+
+struct splat_t
+{
+  float position[3];
+  float scale[3];
+  unsigned char color[4];
+  unsigned char rotation[4];
+};
+
+//----------------------------------------------------------------------------
+// Reference implementation, reading and storing splats one by one
+vtkSmartPointer<vtkPolyData> ReadPerRecord(const std::string& path)
+{
+  vtkNew<vtkFileResourceStream> stream;
+  stream->Open(path.c_str());
+  stream->Seek(0, vtkResourceStream::SeekDirection::End);
+  std::size_t nbSplats = stream->Tell() / sizeof(splat_t);
+  stream->Seek(0, vtkResourceStream::SeekDirection::Begin);
+
+  vtkNew<vtkFloatArray> positionArray;
+  positionArray->SetNumberOfComponents(3);
+  positionArray->SetNumberOfTuples(nbSplats);
+  vtkNew<vtkFloatArray> scaleArray;
+  scaleArray->SetNumberOfComponents(3);
+  scaleArray->SetNumberOfTuples(nbSplats);
+  scaleArray->SetName("scale");
+  vtkNew<vtkUnsignedCharArray> colorArray;
+  colorArray->SetNumberOfComponents(4);
+  colorArray->SetNumberOfTuples(nbSplats);
+  vtkNew<vtkFloatArray> rotationArray;
+  rotationArray->SetNumberOfComponents(4);
+  rotationArray->SetNumberOfTuples(nbSplats);
+  rotationArray->SetName("rotation");
+
+  splat_t splat;
+  for (size_t i = 0; i < nbSplats; i++)
+  {
+    stream->Read(&splat, sizeof(splat_t));
+    positionArray->SetTypedTuple(i, splat.position);
+    scaleArray->SetTypedTuple(i, splat.scale);
+    colorArray->SetTypedTuple(i, splat.color);
+    for (int c = 0; c < 4; c++)
+    {
+      rotationArray->SetTypedComponent(
+        i, c, (static_cast<float>(splat.rotation[c]) - 128.f) / 128.f);
+    }
+  }
+
+  vtkNew<vtkPoints> points;
+  points->SetData(positionArray);
+  vtkNew<vtkPolyData> output;
+  output->SetPoints(points);
+  output->GetPointData()->SetScalars(colorArray);
+  output->GetPointData()->AddArray(scaleArray);
+  output->GetPointData()->AddArray(rotationArray);
+  return output;
+}
+
+//----------------------------------------------------------------------------
+template<typename ArrayT>
+bool CompareArrays(vtkDataArray* a, vtkDataArray* b)
+{
+  auto* typedA = ArrayT::SafeDownCast(a);
+  auto* typedB = ArrayT::SafeDownCast(b);
+  if (!typedA || !typedB || typedA->GetNumberOfValues() != typedB->GetNumberOfValues())
+  {
+    return false;
+  }
+  return std::equal(typedA->GetPointer(0), typedA->GetPointer(0) + typedA->GetNumberOfValues(),
+    typedB->GetPointer(0));
+}
+
+//----------------------------------------------------------------------------
+bool Compare(vtkPolyData* a, vtkPolyData* b)
+{
+  return ::CompareArrays<vtkFloatArray>(a->GetPoints()->GetData(), b->GetPoints()->GetData()) &&
+    ::CompareArrays<vtkFloatArray>(
+      a->GetPointData()->GetArray("scale"), b->GetPointData()->GetArray("scale")) &&
+    ::CompareArrays<vtkFloatArray>(
+      a->GetPointData()->GetArray("rotation"), b->GetPointData()->GetArray("rotation")) &&
+    ::CompareArrays<vtkUnsignedCharArray>(
+      a->GetPointData()->GetScalars(), b->GetPointData()->GetScalars());
+}
+}
+
+int TestF3DSplatReaderModes(int vtkNotUsed(argc), char* argv[])
+{
+  // Generate a deterministic .splat file
+  const std::string path = std::string(argv[2]) + "TestF3DSplatReaderModes.splat";
+  {
+    std::vector<splat_t> splats(NumberOfSplats);
+    for (std::size_t i = 0; i < NumberOfSplats; i++)
+    {
+      const float f = static_cast<float>(i);
+      splats[i] = { { f, -f, 0.5f * f }, { 1.f, 2.f, 3.f },
+        { static_cast<unsigned char>(i), static_cast<unsigned char>(i >> 8), 12, 255 },
+        { static_cast<unsigned char>(i * 3), static_cast<unsigned char>(i * 5),
+          static_cast<unsigned char>(i * 7), static_cast<unsigned char>(i * 11) } };
+    }
+    vtksys::ofstream file(path.c_str(), std::ios_base::binary);
+    file.write(reinterpret_cast<const char*>(splats.data()),
+      static_cast<std::streamsize>(splats.size() * sizeof(splat_t)));
+  }
+
+  vtkSmartPointer<vtkPolyData> reference = ::ReadPerRecord(path);
+
+  // Memory mapped file
+  vtkNew<vtkF3DSplatReader> fileReader;
+  fileReader->SetFileName(path.c_str());
+  fileReader->Update();
+
+  // Bulk read from a stream
+  vtkNew<vtkFileResourceStream> stream;
+  stream->Open(path.c_str());
+  vtkNew<vtkF3DSplatReader> streamReader;
+  streamReader->SetStream(stream);
+  streamReader->Update();
+
+  if (!::Compare(reference, fileReader->GetOutput()))
+  {
+    std::cerr << "Memory mapped output differs from the per record output\n";
+    return EXIT_FAILURE;
+  }
+
+  if (!::Compare(reference, streamReader->GetOutput()))
+  {
+    std::cerr << "Stream output differs from the per record output\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -7,43 +7,162 @@
 #include <vtkObjectFactory.h>
 #include <vtkPointData.h>
 #include <vtkPoints.h>
+#include <vtkSMPTools.h>
 #include <vtkStreamingDemandDrivenPipeline.h>
 #include <vtkVersion.h>
 #include <vtk_zlib.h>
 
 #include <algorithm>
+#include <array>
+#include <limits>
+#include <vector>
 
 namespace
 {
 //----------------------------------------------------------------------------
-bool UncompressGzip(
-  const std::vector<unsigned char>& compressed, std::vector<unsigned char>& uncompressed)
+// Inflate a gzip stream on demand, so that the whole uncompressed data never needs to be
+// stored in memory at once
+class GzipStreamReader
 {
-  std::vector<uint8_t> buffer(8192);
+public:
+  explicit GzipStreamReader(vtkResourceStream* stream)
+    : Stream(stream)
+    , Input(1 << 16)
+  {
+    this->Initialized = inflateInit2(&this->ZStream, 16 | MAX_WBITS) == Z_OK;
+  }
+
+  ~GzipStreamReader()
+  {
+    if (this->Initialized)
+    {
+      inflateEnd(&this->ZStream);
+    }
+  }
 
-  z_stream stream = {};
-  stream.next_in = const_cast<Bytef*>(compressed.data());
-  stream.avail_in = static_cast<unsigned int>(compressed.size());
+  GzipStreamReader(const GzipStreamReader&) = delete;
+  GzipStreamReader& operator=(const GzipStreamReader&) = delete;
 
-  inflateInit2(&stream, 16 | MAX_WBITS);
+  /**
+   * Inflate exactly size bytes into data.
+   * Return false if the gzip stream is invalid or ends prematurely.
+   */
+  bool Read(void* data, size_t size)
+  {
+    if (!this->Initialized)
+    {
+      return false;
+    }
+
+    unsigned char* out = static_cast<unsigned char*>(data);
+    while (size > 0)
+    {
+      const size_t outSize = std::min<size_t>(size, std::numeric_limits<unsigned int>::max());
+      this->ZStream.next_out = out;
+      this->ZStream.avail_out = static_cast<unsigned int>(outSize);
+
+      while (this->ZStream.avail_out > 0)
+      {
+        if (this->Ended || !this->FillInput())
+        {
+          return false;
+        }
+
+        int res = inflate(&this->ZStream, Z_NO_FLUSH);
+        if (res == Z_STREAM_END)
+        {
+          this->Ended = true;
+        }
+        else if (res != Z_OK)
+        {
+          return false;
+        }
+      }
 
-  int32_t res = Z_OK;
+      out += outSize;
+      size -= outSize;
+    }
+    return true;
+  }
 
-  while (res != Z_STREAM_END)
+  /**
+   * Inflate and discard the remaining data, checking the gzip trailer.
+   */
+  bool Finish()
   {
-    stream.next_out = buffer.data();
-    stream.avail_out = static_cast<unsigned int>(buffer.size());
+    unsigned char buffer[8192];
+    while (!this->Ended)
+    {
+      if (!this->Initialized || !this->FillInput())
+      {
+        return false;
+      }
 
-    res = inflate(&stream, Z_NO_FLUSH);
-    if (!(res == Z_OK || res == Z_STREAM_END))
+      this->ZStream.next_out = buffer;
+      this->ZStream.avail_out = sizeof(buffer);
+      int res = inflate(&this->ZStream, Z_NO_FLUSH);
+      if (res == Z_STREAM_END)
+      {
+        this->Ended = true;
+      }
+      else if (res != Z_OK)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  bool FillInput()
+  {
+    if (this->ZStream.avail_in == 0)
+    {
+      size_t read = this->Stream->Read(this->Input.data(), this->Input.size());
+      if (read == 0)
+      {
+        return false;
+      }
+      this->ZStream.next_in = this->Input.data();
+      this->ZStream.avail_in = static_cast<unsigned int>(read);
+    }
+    return true;
+  }
+
+  vtkResourceStream* Stream;
+  std::vector<unsigned char> Input;
+  z_stream ZStream = {};
+  bool Initialized = false;
+  bool Ended = false;
+};
+
+//----------------------------------------------------------------------------
+// Inflate a section of nbSplats records of recordSize bytes chunk by chunk,
+// and call decode(splatIndex, record) on each record of a chunk in parallel
+template<typename F>
+bool DecodeSection(GzipStreamReader& reader, std::vector<unsigned char>& chunk,
+  vtkIdType nbSplats, size_t recordSize, F&& decode)
+{
+  constexpr vtkIdType chunkSize = 1 << 16;
+  for (vtkIdType first = 0; first < nbSplats; first += chunkSize)
+  {
+    const vtkIdType count = std::min(chunkSize, nbSplats - first);
+    chunk.resize(count * recordSize);
+    if (!reader.Read(chunk.data(), chunk.size()))
     {
       return false;
     }
 
-    uncompressed.insert(
-      uncompressed.end(), buffer.data(), buffer.data() + buffer.size() - stream.avail_out);
+    const unsigned char* records = chunk.data();
+    vtkSMPTools::For(0, count,
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType i = begin; i < end; i++)
+        {
+          decode(first + i, records + i * recordSize);
+        }
+      });
   }
-  inflateEnd(&stream);
   return true;
 }
 
@@ -155,35 +274,9 @@ struct PackedRotationV3
 };
 
 //----------------------------------------------------------------------------
-template<int Degree>
-struct SphericalHarmonics
+bool AddSphericalHarmonics(int degree, GzipStreamReader& reader,
+  std::vector<unsigned char>& chunk, vtkIdType nbSplats, vtkPointData* pointData)
 {
-  uint8_t packed[3 * Degree * (Degree + 2)];
-
-  template<int M, int L>
-  std::array<uint8_t, 3> decode() const
-  {
-    static_assert(L > 0 && L <= Degree);
-    static_assert(M <= L && M >= -L);
-
-    constexpr int offset = 3 * ((M + L) + L * L - 1);
-
-    std::array<uint8_t, 3> sh;
-    for (int i = 0; i < 3; i++)
-    {
-      sh[i] = packed[offset + i];
-    }
-    return sh;
-  }
-};
-
-//----------------------------------------------------------------------------
-template<int Degree>
-void AddSphericalHarmonics(int nbSplats, unsigned char* buffer, vtkPointData* pointData)
-{
-  SphericalHarmonics<Degree>* begin =
-    reinterpret_cast<SphericalHarmonics<Degree>*>(buffer + 16 + (9 + 4 + 3 + 3) * nbSplats);
-
   auto getSuffix = [](int m) -> std::string
   {
     if (m == 0)
@@ -197,74 +290,30 @@ void AddSphericalHarmonics(int nbSplats, unsigned char* buffer, vtkPointData* po
     return std::string("m") + std::to_string(-m);
   };
 
-  vtkNew<vtkUnsignedCharArray> sh1Array[3];
-
-  for (int i = 0; i < 3; i++)
+  // coefficients of a splat are stored by increasing degree L, then order M from -L to L,
+  // each with 3 channels
+  std::vector<unsigned char*> coefficients;
+  for (int l = 1; l <= degree; l++)
   {
-    sh1Array[i]->SetNumberOfComponents(3);
-    sh1Array[i]->SetNumberOfTuples(nbSplats);
-    sh1Array[i]->SetName((std::string("sh1") + getSuffix(i - 1)).data());
-    pointData->AddArray(sh1Array[i]);
-  }
-
-  SphericalHarmonics<Degree>* sh = begin;
-
-  for (int splatIndex = 0; splatIndex < nbSplats; splatIndex++, sh++)
-  {
-    sh1Array[0]->SetTypedTuple(splatIndex, sh->template decode<-1, 1>().data());
-    sh1Array[1]->SetTypedTuple(splatIndex, sh->template decode<0, 1>().data());
-    sh1Array[2]->SetTypedTuple(splatIndex, sh->template decode<1, 1>().data());
-  }
-
-  if constexpr (Degree >= 2)
-  {
-    vtkNew<vtkUnsignedCharArray> sh2Array[5];
-
-    for (int i = 0; i < 5; i++)
+    for (int m = -l; m <= l; m++)
     {
-      sh2Array[i]->SetNumberOfComponents(3);
-      sh2Array[i]->SetNumberOfTuples(nbSplats);
-      sh2Array[i]->SetName((std::string("sh2") + getSuffix(i - 2)).data());
-      pointData->AddArray(sh2Array[i]);
-    }
-
-    sh = begin;
-
-    for (int splatIndex = 0; splatIndex < nbSplats; splatIndex++, sh++)
-    {
-      sh2Array[0]->SetTypedTuple(splatIndex, sh->template decode<-2, 2>().data());
-      sh2Array[1]->SetTypedTuple(splatIndex, sh->template decode<-1, 2>().data());
-      sh2Array[2]->SetTypedTuple(splatIndex, sh->template decode<0, 2>().data());
-      sh2Array[3]->SetTypedTuple(splatIndex, sh->template decode<1, 2>().data());
-      sh2Array[4]->SetTypedTuple(splatIndex, sh->template decode<2, 2>().data());
+      vtkNew<vtkUnsignedCharArray> shArray;
+      shArray->SetNumberOfComponents(3);
+      shArray->SetNumberOfTuples(nbSplats);
+      shArray->SetName((std::string("sh") + std::to_string(l) + getSuffix(m)).data());
+      pointData->AddArray(shArray);
+      coefficients.push_back(shArray->GetPointer(0));
     }
   }
 
-  if constexpr (Degree >= 3)
-  {
-    vtkNew<vtkUnsignedCharArray> sh3Array[7];
-
-    for (int i = 0; i < 7; i++)
+  return ::DecodeSection(reader, chunk, nbSplats, 3 * coefficients.size(),
+    [&](vtkIdType splatIndex, const unsigned char* record)
     {
-      sh3Array[i]->SetNumberOfComponents(3);
-      sh3Array[i]->SetNumberOfTuples(nbSplats);
-      sh3Array[i]->SetName((std::string("sh3") + getSuffix(i - 3)).data());
-      pointData->AddArray(sh3Array[i]);
-    }
-
-    sh = begin;
-
-    for (int splatIndex = 0; splatIndex < nbSplats; splatIndex++, sh++)
-    {
-      sh3Array[0]->SetTypedTuple(splatIndex, sh->template decode<-3, 3>().data());
-      sh3Array[1]->SetTypedTuple(splatIndex, sh->template decode<-2, 3>().data());
-      sh3Array[2]->SetTypedTuple(splatIndex, sh->template decode<-1, 3>().data());
-      sh3Array[3]->SetTypedTuple(splatIndex, sh->template decode<0, 3>().data());
-      sh3Array[4]->SetTypedTuple(splatIndex, sh->template decode<1, 3>().data());
-      sh3Array[5]->SetTypedTuple(splatIndex, sh->template decode<2, 3>().data());
-      sh3Array[6]->SetTypedTuple(splatIndex, sh->template decode<3, 3>().data());
-    }
-  }
+      for (size_t k = 0; k < coefficients.size(); k++)
+      {
+        std::copy_n(record + 3 * k, 3, coefficients[k] + 3 * splatIndex);
+      }
+    });
 }
 }
 
@@ -297,150 +346,139 @@ int vtkF3DSPZReader::RequestData(
     stream = fileStream;
   }
 
-  stream->Seek(0, vtkResourceStream::SeekDirection::End);
-  size_t compressedLength = stream->Tell();
-
   stream->Seek(0, vtkResourceStream::SeekDirection::Begin);
 
-  std::vector<unsigned char> compressed(compressedLength);
-
-  stream->Read(compressed.data(), compressedLength);
+  // Each section is inflated and decoded chunk by chunk, so the uncompressed data is never
+  // stored entirely in memory
+  ::GzipStreamReader reader(stream);
+  std::vector<unsigned char> chunk;
 
-  // get the buffer size in order to pre-allocate
-  uint32_t uncompressedLength = static_cast<uint32_t>(compressed[compressedLength - 4]) |
-    (static_cast<uint32_t>(compressed[compressedLength - 3]) << 8) |
-    (static_cast<uint32_t>(compressed[compressedLength - 2]) << 16) |
-    (static_cast<uint32_t>(compressed[compressedLength - 1]) << 24);
-
-  std::vector<unsigned char> uncompressed;
-  uncompressed.reserve(uncompressedLength);
-
-  if (!::UncompressGzip(compressed, uncompressed))
+  Header header;
+  if (!reader.Read(&header, sizeof(Header)))
   {
     vtkErrorMacro("Invalid GZIP file");
     return 0;
   }
 
-  const Header* header = reinterpret_cast<Header*>(uncompressed.data());
-
-  if (header->magic != 0x5053474e)
+  if (header.magic != 0x5053474e)
   {
     vtkErrorMacro("Incompatible SPZ header");
     return 0;
   }
 
-  if (header->version < 2 || header->version > 3)
+  if (header.version < 2 || header.version > 3)
   {
     vtkErrorMacro("Incompatible SPZ version. Only 2 and 3 are supported");
     return 0;
   }
 
-  uint32_t nbSplats = header->numPoints;
+  const vtkIdType nbSplats = static_cast<vtkIdType>(header.numPoints);
 
   vtkNew<vtkFloatArray> positionArray;
   positionArray->SetNumberOfComponents(3);
   positionArray->SetNumberOfTuples(nbSplats);
   positionArray->SetName("position");
 
-  // position is stored just after the 16-bytes header
-  PackedCoordinate* position = reinterpret_cast<PackedCoordinate*>(uncompressed.data() + 16);
-
-  float positionScale = 1.0 / (1 << header->fractionalBits);
-
-  for (vtkIdType splatIndex = 0; splatIndex < static_cast<vtkIdType>(nbSplats); splatIndex++)
-  {
-    for (int c = 0; c < 3; c++)
-    {
-      positionArray->SetTypedComponent(splatIndex, c, (position++)->decode(positionScale));
-    }
-  }
-
-  points->SetData(positionArray);
-
   vtkNew<vtkUnsignedCharArray> colorArray;
   colorArray->SetNumberOfComponents(4);
   colorArray->SetNumberOfTuples(nbSplats);
   colorArray->SetName("color");
 
-  // alpha is stored just after the 16-bytes header and the positions
-  unsigned char* alpha = uncompressed.data() + 16 + 9 * nbSplats;
-
-  // color is stored just after the 16-bytes header and alphas
-  ColorChannel* color =
-    reinterpret_cast<ColorChannel*>(uncompressed.data() + 16 + (9 + 1) * nbSplats);
-
-  for (vtkIdType splatIndex = 0; splatIndex < static_cast<vtkIdType>(nbSplats); splatIndex++)
-  {
-    for (int c = 0; c < 3; c++)
-    {
-      colorArray->SetTypedComponent(splatIndex, c, (color++)->decode());
-    }
-
-    colorArray->SetTypedComponent(splatIndex, 3, *alpha++);
-  }
-
-  output->GetPointData()->SetScalars(colorArray);
-
   vtkNew<vtkFloatArray> scaleArray;
   scaleArray->SetNumberOfComponents(3);
   scaleArray->SetNumberOfTuples(nbSplats);
   scaleArray->SetName("scale");
 
-  // scale is stored just after the 16-bytes header, positions, colors and alphas
-  LogScale* scale = reinterpret_cast<LogScale*>(uncompressed.data() + 16 + (9 + 4) * nbSplats);
-
-  for (vtkIdType splatIndex = 0; splatIndex < static_cast<vtkIdType>(nbSplats); splatIndex++)
-  {
-    for (int c = 0; c < 3; c++)
-    {
-      scaleArray->SetTypedComponent(splatIndex, c, (scale++)->decode());
-    }
-  }
-
-  output->GetPointData()->AddArray(scaleArray);
-
   vtkNew<vtkFloatArray> rotationArray;
   rotationArray->SetNumberOfComponents(4);
   rotationArray->SetNumberOfTuples(nbSplats);
   rotationArray->SetName("rotation");
 
-  // rotation is stored just after the 16-bytes header, positions, colors, alphas and scales
-  int rotationShift = 16 + (9 + 4 + 3) * nbSplats;
+  float* positions = positionArray->GetPointer(0);
+  unsigned char* colors = colorArray->GetPointer(0);
+  float* scales = scaleArray->GetPointer(0);
+  float* rotations = rotationArray->GetPointer(0);
 
-  if (header->version == 2)
-  {
-    PackedRotationV2* rotation =
-      reinterpret_cast<PackedRotationV2*>(uncompressed.data() + rotationShift);
-    for (vtkIdType splatIndex = 0; splatIndex < static_cast<vtkIdType>(nbSplats); splatIndex++)
+  const float positionScale = 1.0 / (1 << header.fractionalBits);
+
+  // sections are stored one after the other after the header:
+  // positions, alphas, colors, scales, rotations and spherical harmonics
+  bool valid = ::DecodeSection(reader, chunk, nbSplats, 9,
+    [&](vtkIdType splatIndex, const unsigned char* record)
     {
-      rotationArray->SetTypedTuple(splatIndex, (rotation++)->decode().data());
-    }
+      const PackedCoordinate* position = reinterpret_cast<const PackedCoordinate*>(record);
+      for (int c = 0; c < 3; c++)
+      {
+        positions[3 * splatIndex + c] = position[c].decode(positionScale);
+      }
+    });
+
+  valid = valid &&
+    ::DecodeSection(reader, chunk, nbSplats, 1,
+      [&](vtkIdType splatIndex, const unsigned char* record)
+      { colors[4 * splatIndex + 3] = *record; });
+
+  valid = valid &&
+    ::DecodeSection(reader, chunk, nbSplats, 3,
+      [&](vtkIdType splatIndex, const unsigned char* record)
+      {
+        const ColorChannel* color = reinterpret_cast<const ColorChannel*>(record);
+        for (int c = 0; c < 3; c++)
+        {
+          colors[4 * splatIndex + c] = color[c].decode();
+        }
+      });
+
+  valid = valid &&
+    ::DecodeSection(reader, chunk, nbSplats, 3,
+      [&](vtkIdType splatIndex, const unsigned char* record)
+      {
+        const LogScale* scale = reinterpret_cast<const LogScale*>(record);
+        for (int c = 0; c < 3; c++)
+        {
+          scales[3 * splatIndex + c] = scale[c].decode();
+        }
+      });
+
+  if (header.version == 2)
+  {
+    valid = valid &&
+      ::DecodeSection(reader, chunk, nbSplats, sizeof(PackedRotationV2),
+        [&](vtkIdType splatIndex, const unsigned char* record)
+        {
+          const std::array<float, 4> rotation =
+            reinterpret_cast<const PackedRotationV2*>(record)->decode();
+          std::copy(rotation.begin(), rotation.end(), rotations + 4 * splatIndex);
+        });
   }
-  else if (header->version == 3)
+  else
   {
-    PackedRotationV3* rotation =
-      reinterpret_cast<PackedRotationV3*>(uncompressed.data() + rotationShift);
-    for (vtkIdType splatIndex = 0; splatIndex < static_cast<vtkIdType>(nbSplats); splatIndex++)
-    {
-      rotationArray->SetTypedTuple(splatIndex, (rotation++)->decode().data());
-    }
+    valid = valid &&
+      ::DecodeSection(reader, chunk, nbSplats, sizeof(PackedRotationV3),
+        [&](vtkIdType splatIndex, const unsigned char* record)
+        {
+          const std::array<float, 4> rotation =
+            reinterpret_cast<const PackedRotationV3*>(record)->decode();
+          std::copy(rotation.begin(), rotation.end(), rotations + 4 * splatIndex);
+        });
   }
 
+  points->SetData(positionArray);
+  output->GetPointData()->SetScalars(colorArray);
+  output->GetPointData()->AddArray(scaleArray);
   output->GetPointData()->AddArray(rotationArray);
 
-  switch (header->shDegree)
+  if (header.shDegree >= 1 && header.shDegree <= 3)
   {
-    case 1:
-      AddSphericalHarmonics<1>(nbSplats, uncompressed.data(), output->GetPointData());
-      break;
-    case 2:
-      AddSphericalHarmonics<2>(nbSplats, uncompressed.data(), output->GetPointData());
-      break;
-    case 3:
-      AddSphericalHarmonics<3>(nbSplats, uncompressed.data(), output->GetPointData());
-      break;
-    default: // nothing to add
-      break;
+    valid = valid &&
+      ::AddSphericalHarmonics(header.shDegree, reader, chunk, nbSplats, output->GetPointData());
+  }
+
+  // inflate the remaining data to check the gzip trailer
+  if (!valid || !reader.Finish())
+  {
+    vtkErrorMacro("Invalid GZIP file");
+    return 0;
   }
 
   return 1;
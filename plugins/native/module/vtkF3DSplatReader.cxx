@@ -1,5 +1,7 @@
 #include "vtkF3DSplatReader.h"
 
+#include "F3DMemoryMappedFile.h"
+
 #include <vtkCellArray.h>
 #include <vtkCellData.h>
 #include <vtkCommand.h>
@@ -15,12 +17,17 @@
 #include <vtkPoints.h>
 #include <vtkPolyData.h>
 #include <vtkResourceStream.h>
+#include <vtkSMPTools.h>
 #include <vtkStreamingDemandDrivenPipeline.h>
 #include <vtkUnsignedCharArray.h>
 #include <vtkVersion.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace
 {
+// Layout of a record in a .splat file, 32 bytes without padding
 struct splat_t
 {
   float position[3];
@@ -28,6 +35,7 @@ struct splat_t
   unsigned char color[4];
   unsigned char rotation[4];
 };
+static_assert(sizeof(splat_t) == 32);
 }
 
 //----------------------------------------------------------------------------
@@ -46,6 +54,7 @@ int vtkF3DSplatReader::RequestData(
   vtkPolyData* output = vtkPolyData::GetData(outputVector);
 
   vtkSmartPointer<vtkResourceStream> stream;
+  bool isFile = false;
 
 #if VTK_VERSION_NUMBER > VTK_VERSION_CHECK(9, 4, 20250501)
   if (this->Stream)
@@ -59,12 +68,35 @@ int vtkF3DSplatReader::RequestData(
     vtkNew<vtkFileResourceStream> fileStream;
     fileStream->Open(this->FileName);
     stream = fileStream;
+    isFile = this->FileName != nullptr;
   }
 
   stream->Seek(0, vtkResourceStream::SeekDirection::End);
   std::size_t nbSplats = stream->Tell() / sizeof(::splat_t);
   stream->Seek(0, vtkResourceStream::SeekDirection::Begin);
 
+  // Access all records at once, either through a memory mapping of the file
+  // or with a single bulk read of the stream
+  F3DMemoryMappedFile mappedFile;
+  std::vector<::splat_t> readSplats;
+  const ::splat_t* splats = nullptr;
+  if (isFile && mappedFile.Open(this->FileName) &&
+    mappedFile.GetSize() >= nbSplats * sizeof(::splat_t))
+  {
+    splats = reinterpret_cast<const ::splat_t*>(mappedFile.GetData());
+  }
+  else
+  {
+    readSplats.resize(nbSplats);
+    const std::size_t size = nbSplats * sizeof(::splat_t);
+    if (stream->Read(readSplats.data(), size) != size)
+    {
+      vtkErrorMacro("Could not read splats");
+      return 0;
+    }
+    splats = readSplats.data();
+  }
+
   vtkNew<vtkFloatArray> positionArray;
   positionArray->SetNumberOfComponents(3);
   positionArray->SetNumberOfTuples(nbSplats);
@@ -85,21 +117,33 @@ int vtkF3DSplatReader::RequestData(
   rotationArray->SetNumberOfTuples(nbSplats);
   rotationArray->SetName("rotation");
 
-  ::splat_t splat;
-  for (size_t i = 0; i < nbSplats; i++)
-  {
-    // This cannot read less bytes than expected because of nbSplats being computed above
-    stream->Read(&splat, sizeof(::splat_t));
-
-    positionArray->SetTypedTuple(i, splat.position);
-    scaleArray->SetTypedTuple(i, splat.scale);
-    colorArray->SetTypedTuple(i, splat.color);
-    for (int c = 0; c < 4; c++)
+  // De-interleave records into the output arrays, in parallel
+  float* positions = positionArray->GetPointer(0);
+  float* scales = scaleArray->GetPointer(0);
+  unsigned char* colors = colorArray->GetPointer(0);
+  float* rotations = rotationArray->GetPointer(0);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(nbSplats),
+    [&](vtkIdType begin, vtkIdType end)
     {
-      rotationArray->SetTypedComponent(
-        i, c, (static_cast<float>(splat.rotation[c]) - 128.f) / 128.f);
-    }
-  }
+      for (vtkIdType i = begin; i < end; i++)
+      {
+        const ::splat_t& splat = splats[i];
+        std::copy_n(splat.position, 3, positions + 3 * i);
+        std::copy_n(splat.scale, 3, scales + 3 * i);
+        std::copy_n(splat.color, 4, colors + 4 * i);
+      }
+
+      // Separate branchless loop so that compilers can vectorize the rotation decoding
+      for (vtkIdType i = begin; i < end; i++)
+      {
+        const unsigned char* packed = splats[i].rotation;
+        float* rotation = rotations + 4 * i;
+        for (int c = 0; c < 4; c++)
+        {
+          rotation[c] = (static_cast<float>(packed[c]) - 128.f) / 128.f;
+        }
+      }
+    });
 
   vtkNew<vtkPoints> points;
   points->SetDataTypeToFloat();
@@ -0,0 +1,168 @@
+#include <vtkCompositeDataSet.h>
+#include <vtkDataObjectTreeIterator.h>
+#include <vtkInformation.h>
+#include <vtkMultiBlockDataSet.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPolyData.h>
+#include <vtkTestUtilities.h>
+#include <vtksys/Directory.hxx>
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include "vtkF3DOCCTReader.h"
+
+#include <iostream>
+
+namespace
+{
+vtkSmartPointer<vtkMultiBlockDataSet> Read(
+  const std::string& filename, const std::string& cachePath, bool invalidate = false)
+{
+  vtkNew<vtkF3DOCCTReader> reader;
+  reader->ReadWireOn();
+  reader->SetFileName(filename);
+  reader->SetFileFormat(vtkF3DOCCTReader::FILE_FORMAT::STEP);
+  reader->SetCachePath(cachePath);
+  reader->UseCacheOn();
+  reader->SetInvalidateCache(invalidate);
+  reader->Update();
+  return reader->GetOutput();
+}
+
+bool Compare(vtkMultiBlockDataSet* a, vtkMultiBlockDataSet* b)
+{
+  if (a->GetNumberOfPoints() != b->GetNumberOfPoints() ||
+    a->GetNumberOfCells() != b->GetNumberOfCells())
+  {
+    return false;
+  }
+
+  vtkNew<vtkDataObjectTreeIterator> iterA;
+  iterA->SetDataSet(a);
+  vtkNew<vtkDataObjectTreeIterator> iterB;
+  iterB->SetDataSet(b);
+  for (iterA->InitTraversal(), iterB->InitTraversal(); !iterA->IsDoneWithTraversal();
+       iterA->GoToNextItem(), iterB->GoToNextItem())
+  {
+    if (iterB->IsDoneWithTraversal())
+    {
+      return false;
+    }
+    vtkPolyData* pdA = vtkPolyData::SafeDownCast(iterA->GetCurrentDataObject());
+    vtkPolyData* pdB = vtkPolyData::SafeDownCast(iterB->GetCurrentDataObject());
+    if (!pdA || !pdB || pdA->GetNumberOfPolys() != pdB->GetNumberOfPolys() ||
+      pdA->GetNumberOfLines() != pdB->GetNumberOfLines() ||
+      (pdA->GetPointData()->GetNormals() == nullptr) !=
+        (pdB->GetPointData()->GetNormals() == nullptr) ||
+      (pdA->GetPointData()->GetTCoords() == nullptr) !=
+        (pdB->GetPointData()->GetTCoords() == nullptr))
+    {
+      return false;
+    }
+
+    double boundsA[6], boundsB[6];
+    pdA->GetBounds(boundsA);
+    pdB->GetBounds(boundsB);
+    for (int i = 0; i < 6; i++)
+    {
+      if (boundsA[i] != boundsB[i])
+      {
+        return false;
+      }
+    }
+
+    const char* nameA = iterA->GetCurrentMetaData()->Get(vtkCompositeDataSet::NAME());
+    const char* nameB = iterB->GetCurrentMetaData()->Get(vtkCompositeDataSet::NAME());
+    if (std::string(nameA ? nameA : "") != std::string(nameB ? nameB : ""))
+    {
+      return false;
+    }
+  }
+  return iterB->IsDoneWithTraversal();
+}
+
+std::string GetSingleEntry(const std::string& cacheDir)
+{
+  vtksys::Directory dir;
+  std::string entry;
+  if (dir.Load(cacheDir + "/occt"))
+  {
+    for (unsigned long i = 0; i < dir.GetNumberOfFiles(); i++)
+    {
+      std::string file = dir.GetFile(i);
+      if (file.ends_with(".bin"))
+      {
+        if (!entry.empty())
+        {
+          return {};
+        }
+        entry = cacheDir + "/occt/" + file;
+      }
+    }
+  }
+  return entry;
+}
+}
+
+int TestF3DOCCTReaderCache(int vtkNotUsed(argc), char* argv[])
+{
+  const std::string filename = std::string(argv[1]) + "data/f3d.stp";
+  const std::string cacheDir = std::string(argv[2]) + "TestF3DOCCTReaderCache";
+  vtksys::SystemTools::RemoveADirectory(cacheDir);
+
+  // First read fills the cache
+  vtkSmartPointer<vtkMultiBlockDataSet> reference = ::Read(filename, cacheDir);
+  if (reference->GetNumberOfPoints() == 0)
+  {
+    std::cerr << "Failed to read the STEP file\n";
+    return EXIT_FAILURE;
+  }
+
+  const std::string entry = ::GetSingleEntry(cacheDir);
+  if (entry.empty())
+  {
+    std::cerr << "Expected a single cache entry in " << cacheDir << "\n";
+    return EXIT_FAILURE;
+  }
+
+  // Second read comes from the cache and must be identical
+  if (!::Compare(reference, ::Read(filename, cacheDir)))
+  {
+    std::cerr << "Output read from the cache differs from the tessellated output\n";
+    return EXIT_FAILURE;
+  }
+
+  // A corrupted entry must be ignored and replaced when invalidating
+  {
+    vtksys::ofstream file(entry.c_str(), std::ios_base::binary | std::ios_base::trunc);
+    file << "corrupted";
+  }
+  if (!::Compare(reference, ::Read(filename, cacheDir)))
+  {
+    std::cerr << "Corrupted cache entry was not ignored\n";
+    return EXIT_FAILURE;
+  }
+  if (!::Compare(reference, ::Read(filename, cacheDir, true)) ||
+    vtksys::SystemTools::FileLength(entry) <= 9)
+  {
+    std::cerr << "Invalidated cache entry was not rewritten\n";
+    return EXIT_FAILURE;
+  }
+
+  // Different tessellation parameters must use a different entry
+  vtkNew<vtkF3DOCCTReader> reader;
+  reader->SetLinearDeflection(0.5);
+  reader->SetFileName(filename);
+  reader->SetFileFormat(vtkF3DOCCTReader::FILE_FORMAT::STEP);
+  reader->SetCachePath(cacheDir);
+  reader->UseCacheOn();
+  reader->Update();
+  if (!::GetSingleEntry(cacheDir).empty())
+  {
+    std::cerr << "Tessellation parameters are not part of the cache key\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
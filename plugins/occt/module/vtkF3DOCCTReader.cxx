@@ -1,5 +1,7 @@
 #include "vtkF3DOCCTReader.h"
 
+#include "F3DCacheKey.h"
+
 #if defined(__GNUC__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Woverloaded-virtual"
@@ -51,6 +53,8 @@
 #include <vtkCellArray.h>
 #include <vtkCellData.h>
 #include <vtkCommand.h>
+#include <vtkCompositeDataSet.h>
+#include <vtkDataArray.h>
 #include <vtkDemandDrivenPipeline.h>
 #include <vtkFloatArray.h>
 #include <vtkInformation.h>
@@ -67,10 +71,15 @@
 #include <vtkTransformFilter.h>
 #include <vtkUnsignedCharArray.h>
 #include <vtkUnsignedIntArray.h>
+#include <vtksys/FStream.hxx>
 #include <vtksys/SystemTools.hxx>
 
+#include <algorithm>
 #include <array>
+#include <cstring>
+#include <iomanip>
 #include <numeric>
+#include <sstream>
 #include <unordered_map>
 #include <vector>
 
@@ -572,6 +581,14 @@ public:
     this->Reader = reader;
   }
 
+  /**
+   * Stop reading and transferring when the reader is aborted, usually from a progress observer
+   */
+  Standard_Boolean UserBreak() override
+  {
+    return this->Reader->GetAbortExecute();
+  }
+
 protected:
   void Show(const Message_ProgressScope&, bool) override
   {
@@ -633,12 +650,501 @@ bool TransferToDocument(vtkF3DOCCTReader* that, T& reader, Handle(TDocStd_Docume
 }
 #endif
 
+namespace
+{
+//----------------------------------------------------------------------------
+// Tessellation cache entries are stored in a binary layout where every data block is aligned
+// on 8 bytes, so that arrays can be read back in a single bulk read each.
+// Bump the version whenever the layout or the tessellation code changes.
+constexpr char CacheMagic[8] = { 'F', '3', 'D', 'O', 'C', 'C', 'T', '\0' };
+constexpr uint32_t CacheVersion = 1;
+constexpr std::size_t CacheAlignment = 8;
+
+enum class CacheNode : uint32_t
+{
+  EMPTY,
+  MULTIBLOCK,
+  POLYDATA,
+};
+
+//----------------------------------------------------------------------------
+class CacheWriter
+{
+public:
+  explicit CacheWriter(const std::string& path)
+    : File(path.c_str(), std::ios_base::binary | std::ios_base::trunc)
+  {
+  }
+
+  bool IsValid() const
+  {
+    return this->File.good();
+  }
+
+  void Write(const void* data, std::size_t size)
+  {
+    this->File.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    this->Position += size;
+  }
+
+  template<typename T>
+  void Write(const T& value)
+  {
+    this->Write(&value, sizeof(T));
+  }
+
+  void Align()
+  {
+    constexpr char padding[CacheAlignment] = {};
+    this->Write(padding, (CacheAlignment - this->Position % CacheAlignment) % CacheAlignment);
+  }
+
+  void WriteString(const std::string& str)
+  {
+    this->Write(static_cast<uint32_t>(str.size()));
+    this->Write(str.data(), str.size());
+    this->Align();
+  }
+
+  bool WriteArray(vtkDataArray* array, int attribute)
+  {
+    vtkSmartPointer<vtkDataArray> contiguous = array;
+    if (!array->HasStandardMemoryLayout())
+    {
+      contiguous = vtk::TakeSmartPointer(vtkDataArray::CreateDataArray(array->GetDataType()));
+      contiguous->DeepCopy(array);
+    }
+
+    const int dataType = contiguous->GetDataType();
+    if (dataType == VTK_BIT || vtkDataArray::GetDataTypeSize(dataType) == 0)
+    {
+      return false;
+    }
+
+    this->Write(static_cast<int32_t>(dataType));
+    this->Write(static_cast<int32_t>(contiguous->GetNumberOfComponents()));
+    this->Write(static_cast<int64_t>(contiguous->GetNumberOfTuples()));
+    this->Write(static_cast<int32_t>(attribute));
+    this->WriteString(contiguous->GetName() ? contiguous->GetName() : "");
+    this->Write(contiguous->GetVoidPointer(0),
+      static_cast<std::size_t>(contiguous->GetNumberOfValues()) *
+        vtkDataArray::GetDataTypeSize(dataType));
+    this->Align();
+    return true;
+  }
+
+  bool WriteAttributes(vtkDataSetAttributes* attributes)
+  {
+    std::vector<std::pair<vtkDataArray*, int>> arrays;
+    for (int i = 0; i < attributes->GetNumberOfArrays(); i++)
+    {
+      vtkDataArray* array = attributes->GetArray(i);
+      if (array)
+      {
+        arrays.emplace_back(array, attributes->IsArrayAnAttribute(i));
+      }
+    }
+
+    this->Write(static_cast<uint32_t>(arrays.size()));
+    this->Align();
+    return std::ranges::all_of(
+      arrays, [&](const auto& pair) { return this->WriteArray(pair.first, pair.second); });
+  }
+
+  bool WriteCells(vtkCellArray* cells)
+  {
+    return this->WriteArray(cells->GetOffsetsArray(), -1) &&
+      this->WriteArray(cells->GetConnectivityArray(), -1);
+  }
+
+  bool WriteNode(vtkDataObject* object, const std::string& name)
+  {
+    if (auto mb = vtkMultiBlockDataSet::SafeDownCast(object))
+    {
+      this->Write(CacheNode::MULTIBLOCK);
+      this->WriteString(name);
+      this->Write(static_cast<uint32_t>(mb->GetNumberOfBlocks()));
+      this->Align();
+      for (unsigned int i = 0; i < mb->GetNumberOfBlocks(); i++)
+      {
+        std::string childName;
+        if (mb->HasMetaData(i) && mb->GetMetaData(i)->Has(vtkCompositeDataSet::NAME()))
+        {
+          childName = mb->GetMetaData(i)->Get(vtkCompositeDataSet::NAME());
+        }
+        if (!this->WriteNode(mb->GetBlock(i), childName))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    if (auto pd = vtkPolyData::SafeDownCast(object))
+    {
+      if (!pd->GetPoints() || pd->GetNumberOfVerts() > 0 || pd->GetNumberOfStrips() > 0)
+      {
+        return false;
+      }
+      this->Write(CacheNode::POLYDATA);
+      this->WriteString(name);
+      return this->WriteArray(pd->GetPoints()->GetData(), -1) &&
+        this->WriteAttributes(pd->GetPointData()) && this->WriteAttributes(pd->GetCellData()) &&
+        this->WriteCells(pd->GetPolys()) && this->WriteCells(pd->GetLines());
+    }
+
+    if (!object)
+    {
+      this->Write(CacheNode::EMPTY);
+      this->WriteString(name);
+      return true;
+    }
+
+    return false;
+  }
+
+private:
+  vtksys::ofstream File;
+  std::size_t Position = 0;
+};
+
+//----------------------------------------------------------------------------
+class CacheReader
+{
+public:
+  explicit CacheReader(const std::string& path)
+    : File(path.c_str(), std::ios_base::binary)
+    , Remaining(vtksys::SystemTools::FileLength(path))
+  {
+  }
+
+  bool Read(void* data, std::size_t size)
+  {
+    if (size > this->Remaining)
+    {
+      return false;
+    }
+    this->File.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+    this->Remaining -= size;
+    this->Position += size;
+    return this->File.good();
+  }
+
+  template<typename T>
+  bool Read(T& value)
+  {
+    return this->Read(&value, sizeof(T));
+  }
+
+  bool Align()
+  {
+    char padding[CacheAlignment];
+    return this->Read(padding, (CacheAlignment - this->Position % CacheAlignment) % CacheAlignment);
+  }
+
+  bool ReadString(std::string& str)
+  {
+    uint32_t size;
+    if (!this->Read(size) || size > this->Remaining)
+    {
+      return false;
+    }
+    str.resize(size);
+    return this->Read(str.data(), size) && this->Align();
+  }
+
+  vtkSmartPointer<vtkDataArray> ReadArray(int& attribute)
+  {
+    int32_t dataType, nbComponents, attr;
+    int64_t nbTuples;
+    std::string name;
+    if (!this->Read(dataType) || !this->Read(nbComponents) || !this->Read(nbTuples) ||
+      !this->Read(attr) || !this->ReadString(name))
+    {
+      return nullptr;
+    }
+
+    if (dataType == VTK_BIT || vtkDataArray::GetDataTypeSize(dataType) == 0 || nbComponents <= 0 ||
+      nbTuples < 0)
+    {
+      return nullptr;
+    }
+
+    const std::size_t size = static_cast<std::size_t>(nbTuples) *
+      static_cast<std::size_t>(nbComponents) * vtkDataArray::GetDataTypeSize(dataType);
+    if (size > this->Remaining)
+    {
+      return nullptr;
+    }
+
+    vtkSmartPointer<vtkDataArray> array =
+      vtk::TakeSmartPointer(vtkDataArray::CreateDataArray(dataType));
+    if (!array)
+    {
+      return nullptr;
+    }
+    array->SetNumberOfComponents(nbComponents);
+    array->SetNumberOfTuples(nbTuples);
+    if (!name.empty())
+    {
+      array->SetName(name.c_str());
+    }
+    if (!this->Read(array->GetVoidPointer(0), size) || !this->Align())
+    {
+      return nullptr;
+    }
+
+    attribute = attr;
+    return array;
+  }
+
+  bool ReadAttributes(vtkDataSetAttributes* attributes)
+  {
+    uint32_t nbArrays;
+    if (!this->Read(nbArrays) || !this->Align())
+    {
+      return false;
+    }
+    for (uint32_t i = 0; i < nbArrays; i++)
+    {
+      int attribute = -1;
+      vtkSmartPointer<vtkDataArray> array = this->ReadArray(attribute);
+      if (!array)
+      {
+        return false;
+      }
+      if (attribute >= 0 && attribute < vtkDataSetAttributes::NUM_ATTRIBUTES)
+      {
+        attributes->SetAttribute(array, attribute);
+      }
+      else
+      {
+        attributes->AddArray(array);
+      }
+    }
+    return true;
+  }
+
+  vtkSmartPointer<vtkCellArray> ReadCells()
+  {
+    int attribute;
+    vtkSmartPointer<vtkDataArray> offsets = this->ReadArray(attribute);
+    vtkSmartPointer<vtkDataArray> connectivity = this->ReadArray(attribute);
+    vtkNew<vtkCellArray> cells;
+    if (!offsets || !connectivity || !cells->SetData(offsets.Get(), connectivity.Get()))
+    {
+      return nullptr;
+    }
+    return cells;
+  }
+
+  bool ReadNode(vtkSmartPointer<vtkDataObject>& object, std::string& name)
+  {
+    CacheNode type;
+    if (!this->Read(type) || !this->ReadString(name))
+    {
+      return false;
+    }
+
+    switch (type)
+    {
+      case CacheNode::EMPTY:
+        object = nullptr;
+        return true;
+      case CacheNode::MULTIBLOCK:
+      {
+        uint32_t nbBlocks;
+        if (!this->Read(nbBlocks) || !this->Align())
+        {
+          return false;
+        }
+        vtkNew<vtkMultiBlockDataSet> mb;
+        if (!this->ReadBlocks(mb, nbBlocks))
+        {
+          return false;
+        }
+        object = mb;
+        return true;
+      }
+      case CacheNode::POLYDATA:
+      {
+        int attribute;
+        vtkSmartPointer<vtkDataArray> pointsArray = this->ReadArray(attribute);
+        if (!pointsArray || pointsArray->GetNumberOfComponents() != 3)
+        {
+          return false;
+        }
+        vtkNew<vtkPolyData> pd;
+        vtkNew<vtkPoints> points;
+        points->SetData(pointsArray);
+        pd->SetPoints(points);
+        if (!this->ReadAttributes(pd->GetPointData()) || !this->ReadAttributes(pd->GetCellData()))
+        {
+          return false;
+        }
+        vtkSmartPointer<vtkCellArray> polys = this->ReadCells();
+        vtkSmartPointer<vtkCellArray> lines = this->ReadCells();
+        if (!polys || !lines)
+        {
+          return false;
+        }
+        pd->SetPolys(polys);
+        pd->SetLines(lines);
+        object = pd;
+        return true;
+      }
+      default:
+        return false;
+    }
+  }
+
+  bool ReadBlocks(vtkMultiBlockDataSet* mb, uint32_t nbBlocks)
+  {
+    mb->SetNumberOfBlocks(nbBlocks);
+    for (uint32_t i = 0; i < nbBlocks; i++)
+    {
+      vtkSmartPointer<vtkDataObject> child;
+      std::string childName;
+      if (!this->ReadNode(child, childName))
+      {
+        return false;
+      }
+      mb->SetBlock(i, child);
+      if (!childName.empty())
+      {
+        mb->GetMetaData(i)->Set(vtkCompositeDataSet::NAME(), childName);
+      }
+    }
+    return true;
+  }
+
+private:
+  vtksys::ifstream File;
+  std::size_t Remaining;
+  std::size_t Position = 0;
+};
+
+//----------------------------------------------------------------------------
+bool ReadCacheEntry(const std::string& path, vtkMultiBlockDataSet* output)
+{
+  if (!vtksys::SystemTools::FileExists(path, true))
+  {
+    return false;
+  }
+
+  CacheReader reader(path);
+  char magic[8];
+  uint32_t version, padding;
+  if (!reader.Read(magic) || std::memcmp(magic, CacheMagic, sizeof(magic)) != 0 ||
+    !reader.Read(version) || version != CacheVersion || !reader.Read(padding))
+  {
+    return false;
+  }
+
+  // The root multiblock is the reader output itself
+  CacheNode type;
+  std::string name;
+  uint32_t nbBlocks;
+  if (!reader.Read(type) || type != CacheNode::MULTIBLOCK || !reader.ReadString(name) ||
+    !reader.Read(nbBlocks) || !reader.Align() || !reader.ReadBlocks(output, nbBlocks))
+  {
+    output->Initialize();
+    return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool WriteCacheEntry(const std::string& path, vtkMultiBlockDataSet* output)
+{
+  // Write to a temporary file first so that an interrupted write never leaves a partial entry
+  const std::string tmpPath = path + ".tmp";
+  bool success = false;
+  {
+    CacheWriter writer(tmpPath);
+    if (writer.IsValid())
+    {
+      writer.Write(CacheMagic);
+      writer.Write(CacheVersion);
+      writer.Write(static_cast<uint32_t>(0));
+      success = writer.WriteNode(output, "") && writer.IsValid();
+    }
+  }
+
+  if (success)
+  {
+    success = vtksys::SystemTools::RenameFile(tmpPath, path).IsSuccess();
+  }
+  if (!success)
+  {
+    vtksys::SystemTools::RemoveFile(tmpPath);
+  }
+  return success;
+}
+}
+
+//----------------------------------------------------------------------------
+std::string vtkF3DOCCTReader::GetCacheEntryPath()
+{
+  if (!this->UseCache || this->CachePath.empty() || this->Stream || this->FileName.empty())
+  {
+    return {};
+  }
+
+  const std::string contentHash = F3DCacheKey::ComputeFileHash(this->FileName, this->CachePath);
+  if (contentHash.empty())
+  {
+    return {};
+  }
+
+  // Any parameter impacting the output must be part of the key
+  std::ostringstream key;
+  key << std::setprecision(17) << contentHash << ';' << static_cast<int>(this->FileFormat) << ';'
+      << this->LinearDeflection << ';' << this->AngularDeflection << ';'
+      << this->RelativeDeflection << ';' << this->ReadWire << ';'
+#if F3D_PLUGIN_OCCT_XCAF
+      << "xcaf;"
+#endif
+      << CacheVersion;
+
+  const std::string cacheDir = this->CachePath + "/occt";
+  if (!vtksys::SystemTools::MakeDirectory(cacheDir))
+  {
+    return {};
+  }
+  return cacheDir + "/" + F3DCacheKey::ComputeStringHash(key.str()) + ".bin";
+}
+
 //----------------------------------------------------------------------------
 int vtkF3DOCCTReader::RequestData(
   vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector)
 {
   vtkMultiBlockDataSet* output = vtkMultiBlockDataSet::GetData(outputVector);
 
+  const std::string cacheEntry = this->GetCacheEntryPath();
+  if (!cacheEntry.empty() && !this->InvalidateCache && ::ReadCacheEntry(cacheEntry, output))
+  {
+    double progress = 1.0;
+    this->InvokeEvent(vtkCommand::ProgressEvent, &progress);
+    return 1;
+  }
+
+  if (!this->ReadAndTessellate(output))
+  {
+    return 0;
+  }
+
+  // An aborted read is incomplete and must not be cached
+  if (!cacheEntry.empty() && !this->GetAbortExecute() && !::WriteCacheEntry(cacheEntry, output))
+  {
+    vtkWarningMacro("Could not write tessellation cache entry: " << cacheEntry);
+  }
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkF3DOCCTReader::ReadAndTessellate(vtkMultiBlockDataSet* output)
+{
   Message::DefaultMessenger()->RemovePrinters(STANDARD_TYPE(Message_PrinterOStream));
 
   if (this->FileFormat == FILE_FORMAT::BREP)
@@ -781,6 +1287,10 @@ int vtkF3DOCCTReader::RequestData(
 
     double progress = 0.5 + (static_cast<double>(iLabel) / topLevelShapes.Length()) / 2;
     this->InvokeEvent(vtkCommand::ProgressEvent, &progress);
+    if (this->GetAbortExecute())
+    {
+      break;
+    }
   }
 
   // create multiblock
@@ -864,6 +1374,9 @@ void vtkF3DOCCTReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "AngularDeflection: " << this->AngularDeflection << "\n";
   os << indent << "RelativeDeflection: " << (this->RelativeDeflection ? "true" : "false") << "\n";
   os << indent << "ReadWire: " << (this->ReadWire ? "true" : "false") << "\n";
+  os << indent << "CachePath: " << (this->CachePath.empty() ? "(none)" : this->CachePath) << "\n";
+  os << indent << "UseCache: " << (this->UseCache ? "true" : "false") << "\n";
+  os << indent << "InvalidateCache: " << (this->InvalidateCache ? "true" : "false") << "\n";
   // clang-format off
   switch (this->FileFormat)
   {
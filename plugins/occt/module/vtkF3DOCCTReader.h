@@ -12,6 +12,10 @@
  * This reader support reading streams for all supported formats but IGES.
  * https://dev.opencascade.org/content/reading-iges-stream-seems-broken-770
  *
+ * When UseCache is enabled and a CachePath is set, the tessellated output of a file is stored
+ * in a binary cache entry, keyed on the file content and the tessellation parameters,
+ * so that reading the same file again skips the OpenCASCADE reading and meshing entirely.
+ * Streams are never cached.
  */
 
 #ifndef vtkF3DOCCTReader_h
@@ -24,6 +28,7 @@
 #include <memory>
 
 class vtkInformationDoubleVectorKey;
+class vtkMultiBlockDataSet;
 class vtkResourceStream;
 class vtkF3DOCCTReader : public vtkMultiBlockDataSetAlgorithm
 {
@@ -90,6 +95,38 @@ public:
   vtkBooleanMacro(ReadWire, bool);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get the directory where the tessellation cache entries are stored.
+   * Entries are stored in an `occt` subdirectory.
+   * Default is empty, which disables the cache.
+   */
+  vtkSetMacro(CachePath, std::string);
+  vtkGetMacro(CachePath, std::string);
+  ///@}
+
+  ///@{
+  /**
+   * Enable/Disable the use of the tessellation cache.
+   * Default is false
+   */
+  vtkGetMacro(UseCache, bool);
+  vtkSetMacro(UseCache, bool);
+  vtkBooleanMacro(UseCache, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Enable/Disable the invalidation of the cache entry of the file.
+   * If enabled, an existing cache entry is ignored and overwritten by a new tessellation.
+   * Only has an effect when UseCache is enabled.
+   * Default is false
+   */
+  vtkGetMacro(InvalidateCache, bool);
+  vtkSetMacro(InvalidateCache, bool);
+  vtkBooleanMacro(InvalidateCache, bool);
+  ///@}
+
   ///@{
   /**
    * Specify stream to read from
@@ -136,13 +173,27 @@ private:
   class vtkInternals;
   std::unique_ptr<vtkInternals> Internals;
 
+  /**
+   * Read the OpenCASCADE file or stream and tessellate it into the output
+   */
+  int ReadAndTessellate(vtkMultiBlockDataSet* output);
+
+  /**
+   * Compute the path of the cache entry for the current file and parameters
+   * Return an empty string if the cache cannot be used
+   */
+  std::string GetCacheEntryPath();
+
   std::string FileName;
+  std::string CachePath;
   vtkSmartPointer<vtkResourceStream> Stream;
 
   double LinearDeflection = 0.1;
   double AngularDeflection = 0.5;
   bool RelativeDeflection = false;
   bool ReadWire = false;
+  bool UseCache = false;
+  bool InvalidateCache = false;
   FILE_FORMAT FileFormat = FILE_FORMAT::STEP;
 
   std::unique_ptr<std::streambuf> Streambuf;
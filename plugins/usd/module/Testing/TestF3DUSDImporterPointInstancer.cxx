@@ -0,0 +1,127 @@
+#include "vtkF3DUSDImporter.h"
+
+#include <vtkActor.h>
+#include <vtkActorCollection.h>
+#include <vtkDataArray.h>
+#include <vtkGlyph3DMapper.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPolyData.h>
+#include <vtksys/FStream.hxx>
+
+#include <iostream>
+
+namespace
+{
+constexpr int NumberOfInstances = 1000;
+
+//----------------------------------------------------------------------------
+// Write a point instancer of two prototypes with animated instance positions
+void WriteInstancer(const std::string& path)
+{
+  vtksys::ofstream file(path.c_str());
+  file << "#usda 1.0\n"
+          "(\n"
+          "    startTimeCode = 0\n"
+          "    endTimeCode = 10\n"
+          "    timeCodesPerSecond = 10\n"
+          "    upAxis = \"Y\"\n"
+          ")\n\n"
+          "def PointInstancer \"forest\"\n"
+          "{\n"
+          "    rel prototypes = [</forest/Prototypes/tree>, </forest/Prototypes/rock>]\n";
+
+  file << "    int[] protoIndices = [";
+  for (int i = 0; i < NumberOfInstances; i++)
+  {
+    file << (i > 0 ? ", " : "") << i % 2;
+  }
+  file << "]\n";
+
+  file << "    float3[] scales = [";
+  for (int i = 0; i < NumberOfInstances; i++)
+  {
+    file << (i > 0 ? ", " : "") << "(2, 2, 2)";
+  }
+  file << "]\n";
+
+  file << "    point3f[] positions.timeSamples = {\n";
+  for (int t : { 0, 10 })
+  {
+    file << "        " << t << ": [";
+    for (int i = 0; i < NumberOfInstances; i++)
+    {
+      file << (i > 0 ? ", " : "") << "(" << i << ", " << t / 10 << ", 0)";
+    }
+    file << "],\n";
+  }
+  file << "    }\n\n";
+
+  file << "    def Scope \"Prototypes\"\n"
+          "    {\n"
+          "        def Mesh \"tree\"\n"
+          "        {\n"
+          "            int[] faceVertexCounts = [3]\n"
+          "            int[] faceVertexIndices = [0, 1, 2]\n"
+          "            point3f[] points = [(0, 0, 0), (1, 0, 0), (0, 1, 0)]\n"
+          "        }\n\n"
+          "        def Xform \"rock\"\n"
+          "        {\n"
+          "            def Sphere \"ball\"\n"
+          "            {\n"
+          "                double radius = 0.5\n"
+          "            }\n"
+          "        }\n"
+          "    }\n"
+          "}\n";
+}
+}
+
+int TestF3DUSDImporterPointInstancer(int vtkNotUsed(argc), char* argv[])
+{
+  const std::string path = std::string(argv[2]) + "TestF3DUSDImporterPointInstancer.usda";
+  ::WriteInstancer(path);
+
+  vtkNew<vtkF3DUSDImporter> importer;
+  importer->SetFileName(path.c_str());
+  importer->Update();
+
+  // one actor per prototype geometry, not per instance
+  vtkActorCollection* actors = importer->GetImportedActors();
+  if (actors->GetNumberOfItems() != 2)
+  {
+    std::cerr << "Unexpected number of actors: " << actors->GetNumberOfItems() << "\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkActor* tree = vtkActor::SafeDownCast(actors->GetItemAsObject(0));
+  vtkGlyph3DMapper* mapper = vtkGlyph3DMapper::SafeDownCast(tree->GetMapper());
+  if (!mapper)
+  {
+    std::cerr << "Point instancer prototype is not glyph mapped\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkDataSet* instances = mapper->GetInput();
+  vtkDataArray* scales = instances->GetPointData()->GetArray("Scale");
+  if (instances->GetNumberOfPoints() != NumberOfInstances / 2 || !scales ||
+    scales->GetComponent(0, 1) != 2.0 || instances->GetPoint(1)[0] != 2.0)
+  {
+    std::cerr << "Unexpected instances of the tree prototype\n";
+    return EXIT_FAILURE;
+  }
+
+  // only the instances are updated when the prototype geometry is static
+  vtkPolyData* source = mapper->GetSource();
+  importer->UpdateAtTimeValue(0.5);
+
+  if (tree->GetMapper() != mapper || mapper->GetSource() != source ||
+    mapper->GetInput()->GetNumberOfPoints() != NumberOfInstances / 2 ||
+    mapper->GetInput()->GetPoint(0)[1] != 0.5)
+  {
+    std::cerr << "Unexpected instances of the tree prototype after a time update\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
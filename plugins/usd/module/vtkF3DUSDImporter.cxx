@@ -1,5 +1,6 @@
 #include "vtkF3DUSDImporter.h"
 
+#include "F3DTrace.h"
 #include "vtkF3DFaceVaryingPointDispatcher.h"
 
 #include <vtkActor.h>
@@ -11,6 +12,7 @@
 #include <vtkDataAssembly.h>
 #include <vtkDoubleArray.h>
 #include <vtkFloatArray.h>
+#include <vtkGlyph3DMapper.h>
 #include <vtkIdTypeArray.h>
 #include <vtkImageAppendComponents.h>
 #include <vtkImageData.h>
@@ -36,6 +38,7 @@
 #include <vtkTexture.h>
 #include <vtkTransform.h>
 #include <vtkTransformFilter.h>
+#include <vtkTransformPolyDataFilter.h>
 #include <vtkTriangleFilter.h>
 #include <vtkUniforms.h>
 #include <vtkUnsignedShortArray.h>
@@ -65,6 +68,9 @@
 #pragma warning(push, 0)
 #endif
 #include <pxr/base/arch/symbols.h>
+#include <pxr/base/gf/matrix3d.h>
+#include <pxr/base/gf/quatd.h>
+#include <pxr/base/gf/rotation.h>
 #include <pxr/base/plug/registry.h>
 #include <pxr/usd/ar/asset.h>
 #include <pxr/usd/ar/resolver.h>
@@ -106,6 +112,14 @@
 class vtkF3DUSDImporter::vtkInternals
 {
 public:
+  // Instances of a point instancer prototype, imported with one glyph mapped actor per geometry
+  struct PrototypeInstances
+  {
+    pxr::UsdPrim Instancer;
+    vtkSmartPointer<vtkMatrix4x4> InstancerMatrix;
+    std::vector<pxr::GfMatrix4d> Transforms;
+  };
+
   explicit vtkInternals(vtkF3DUSDImporter* parent)
     : Delegate(parent)
   {
@@ -246,7 +260,8 @@ public:
   void AddActor(vtkRenderer* renderer, vtkDataAssembly* hierarchy,
     vtkActorCollection* actorCollection, const pxr::SdfPath& path,
     const pxr::UsdGeomGprim& geomPrim, const pxr::UsdPrim& prim, vtkMatrix4x4* mat,
-    vtkPolyData* polydata, bool useDirectScalars = false)
+    vtkPolyData* polydata, bool useDirectScalars = false,
+    const PrototypeInstances* instances = nullptr)
   {
     pxr::SdfPath actorPath = path.AppendChild(pxr::TfToken(prim.GetName()));
 
@@ -339,6 +354,12 @@ public:
       renderer->AddActor(actor);
     }
 
+    if (instances)
+    {
+      this->SetInstancedMapper(actor, actorPath.GetAsString(), polydata, mat, *instances);
+      return;
+    }
+
     // set mapper
     vtkNew<vtkPolyDataMapper> mapper;
 
@@ -379,639 +400,852 @@ public:
     actor->SetUserMatrix(mat);
   }
 
-  void ImportNode(vtkRenderer* renderer, vtkDataAssembly* hierarchy,
-    vtkActorCollection* actorCollection, const pxr::UsdPrim& node, const pxr::SdfPath& path,
-    vtkMatrix4x4* currentMatrix)
+  void SetInstancedMapper(vtkActor* actor, const std::string& actorPath, vtkPolyData* polydata,
+    vtkMatrix4x4* mat, const PrototypeInstances& instances)
   {
-    pxr::UsdTimeCode timeCode = this->CurrentTime * this->Stage->GetTimeCodesPerSecond();
+    InstancedMapper& instanced = this->InstancedMapperMap[actorPath];
 
-    // simple range-for iteration
-    for (pxr::UsdPrim prim : pxr::UsdPrimSiblingRange(node.GetAllChildren()))
+    if (!instanced.Mapper)
     {
-      if (prim.IsA<pxr::UsdGeomImageable>())
+      vtkNew<vtkPoints> positions;
+      instanced.Instances = vtkSmartPointer<vtkPolyData>::New();
+      instanced.Instances->SetPoints(positions);
+
+      vtkNew<vtkFloatArray> orientations;
+      orientations->SetName("Orientation");
+      orientations->SetNumberOfComponents(4);
+      instanced.Instances->GetPointData()->AddArray(orientations);
+
+      vtkNew<vtkFloatArray> scales;
+      scales->SetName("Scale");
+      scales->SetNumberOfComponents(3);
+      instanced.Instances->GetPointData()->AddArray(scales);
+
+      instanced.Mapper = vtkSmartPointer<vtkGlyph3DMapper>::New();
+      instanced.Mapper->SetInputData(instanced.Instances);
+      instanced.Mapper->SetOrientationModeToQuaternion();
+      instanced.Mapper->SetOrientationArray("Orientation");
+      instanced.Mapper->SetScaleModeToScaleByVectorComponents();
+      instanced.Mapper->SetScaleArray("Scale");
+      instanced.Mapper->ScalarVisibilityOff();
+
+      if (!this->HasTimeCode())
       {
-        pxr::UsdGeomImageable imageable = pxr::UsdGeomImageable(prim);
+        instanced.Mapper->StaticOn();
+      }
 
-        pxr::TfToken visibility;
-        pxr::UsdAttribute visAttr = imageable.GetVisibilityAttr();
-        if (visAttr && visAttr.HasAuthoredValue() && visAttr.Get(&visibility, timeCode) &&
-          visibility == pxr::UsdGeomTokens->invisible)
-        {
-          // not visible, skip
-          continue;
-        }
+      actor->SetMapper(instanced.Mapper);
+    }
 
-        pxr::TfToken purpose;
-        pxr::UsdAttribute purpAttr = imageable.GetPurposeAttr();
-        if (purpAttr && purpAttr.HasAuthoredValue() && purpAttr.Get(&purpose, timeCode) &&
-          (purpose == pxr::UsdGeomTokens->proxy || purpose == pxr::UsdGeomTokens->guide))
-        {
-          // proxy, skip
-          continue;
-        }
-      }
+    actor->SetUserMatrix(instances.InstancerMatrix);
+
+    // the prototype geometry is only rebuilt if it changed, usually only instances are animated
+    if (instanced.Source != polydata || instanced.SourceTime < polydata->GetMTime() ||
+      !std::equal(mat->GetData(), mat->GetData() + 16, instanced.SourceMatrix->GetData()))
+    {
+      instanced.Source = polydata;
+      instanced.SourceTime = polydata->GetMTime();
+      instanced.SourceMatrix->DeepCopy(mat);
+
+      vtkNew<vtkTransform> transform;
+      transform->SetMatrix(mat);
+
+      vtkNew<vtkTransformPolyDataFilter> transformFilter;
+      transformFilter->SetTransform(transform);
+      transformFilter->SetInputData(polydata);
 
-      if (prim.IsInstance())
+      if (actor->GetProperty()->GetTexture("normalTex"))
       {
-        pxr::UsdGeomXform xform = pxr::UsdGeomXform(prim);
+        vtkNew<vtkTriangleFilter> triangulate;
+        triangulate->SetInputConnection(transformFilter->GetOutputPort());
 
-        auto mat = this->GetLocalTransform(xform, timeCode);
-        vtkMatrix4x4::Multiply4x4(currentMatrix, mat, mat);
+        vtkNew<vtkPolyDataNormals> normals;
+        normals->SetInputConnection(triangulate->GetOutputPort());
 
-        this->ImportNode(renderer, hierarchy, actorCollection, prim.GetPrototype(),
-          path.AppendChild(prim.GetName()), mat);
+        vtkNew<vtkPolyDataTangents> tangents;
+        tangents->SetInputConnection(normals->GetOutputPort());
+        tangents->Update();
+        instanced.Mapper->SetSourceData(tangents->GetOutput());
       }
-      else if (prim.IsA<pxr::UsdGeomPointInstancer>())
+      else
       {
-        pxr::UsdGeomPointInstancer glyphs = pxr::UsdGeomPointInstancer(prim);
+        transformFilter->Update();
+        instanced.Mapper->SetSourceData(transformFilter->GetOutput());
+      }
+    }
 
-        // TODO: Ideally, we should use the 3D glyph mapper, but it's left for future work
-        // See https://github.com/f3d-app/f3d/issues/1075
-        pxr::VtMatrix4dArray xforms;
+    // rewrite the instance buffers in place
+    const vtkIdType nbInstances = static_cast<vtkIdType>(instances.Transforms.size());
 
-        if (glyphs.ComputeInstanceTransformsAtTime(&xforms, timeCode, timeCode))
-        {
-          int i = 0;
-          for (const pxr::GfMatrix4d& currInstMatrix : xforms)
-          {
-            auto mat = this->ConvertMatrix(currInstMatrix);
-            vtkMatrix4x4::Multiply4x4(currentMatrix, mat, mat);
+    vtkPoints* positions = instanced.Instances->GetPoints();
+    vtkFloatArray* orientations =
+      vtkFloatArray::SafeDownCast(instanced.Instances->GetPointData()->GetArray("Orientation"));
+    vtkFloatArray* scales =
+      vtkFloatArray::SafeDownCast(instanced.Instances->GetPointData()->GetArray("Scale"));
 
-            pxr::TfToken tok(std::string("instance_") + std::to_string(i++));
+    positions->SetNumberOfPoints(nbInstances);
+    orientations->SetNumberOfTuples(nbInstances);
+    scales->SetNumberOfTuples(nbInstances);
 
-            this->ImportNode(renderer, hierarchy, actorCollection, prim,
-              path.AppendChild(prim.GetName()).AppendChild(tok), mat);
-          }
+    for (vtkIdType i = 0; i < nbInstances; i++)
+    {
+      const pxr::GfMatrix4d& m = instances.Transforms[i];
+
+      // USD matrices transform row vectors, so each row is a scaled rotation axis
+      pxr::GfVec3d axes[3] = { m.GetRow3(0), m.GetRow3(1), m.GetRow3(2) };
+      float scale[3];
+      for (int c = 0; c < 3; c++)
+      {
+        const double length = axes[c].GetLength();
+        scale[c] = static_cast<float>(length);
+        if (length > 0.0)
+        {
+          axes[c] /= length;
         }
       }
-      else if (prim.IsA<pxr::UsdGeomGprim>())
+
+      if (m.GetDeterminant3() < 0.0)
       {
-        pxr::UsdGeomGprim geomPrim = pxr::UsdGeomGprim(prim);
+        scale[0] = -scale[0];
+        axes[0] = -axes[0];
+      }
 
-        vtkSmartPointer<vtkPolyData> polydata;
-        bool useDirectScalars = false;
+      const pxr::GfQuatd quat = pxr::GfMatrix3d(axes[0][0], axes[0][1], axes[0][2], axes[1][0],
+        axes[1][1], axes[1][2], axes[2][0], axes[2][1], axes[2][2])
+                                  .ExtractRotation()
+                                  .GetQuat();
+      const pxr::GfVec3d& imaginary = quat.GetImaginary();
+      const float orientation[4] = { static_cast<float>(quat.GetReal()),
+        static_cast<float>(imaginary[0]), static_cast<float>(imaginary[1]),
+        static_cast<float>(imaginary[2]) };
+
+      const pxr::GfVec3d translation = m.ExtractTranslation();
+      positions->SetPoint(i, translation[0], translation[1], translation[2]);
+      orientations->SetTypedTuple(i, orientation);
+      scales->SetTypedTuple(i, scale);
+    }
 
-        if (prim.IsA<pxr::UsdGeomMesh>())
-        {
-          pxr::UsdGeomMesh meshPrim = pxr::UsdGeomMesh(prim);
+    positions->Modified();
+    orientations->Modified();
+    scales->Modified();
+    instanced.Instances->Modified();
+  }
 
-          vtkSmartPointer<vtkPolyData>& mappedPolydata =
-            this->MeshMap[meshPrim.GetPath().GetAsString()];
-          bool meshAlreadyExists = (mappedPolydata != nullptr);
+  void ImportNode(vtkRenderer* renderer, vtkDataAssembly* hierarchy,
+    vtkActorCollection* actorCollection, const pxr::UsdPrim& node, const pxr::SdfPath& path,
+    vtkMatrix4x4* currentMatrix, const PrototypeInstances* instances = nullptr)
+  {
+    // simple range-for iteration
+    for (const pxr::UsdPrim& prim : pxr::UsdPrimSiblingRange(node.GetAllChildren()))
+    {
+      this->ImportPrim(renderer, hierarchy, actorCollection, prim, path, currentMatrix, instances);
+    }
+  }
 
-          // attributes
-          pxr::UsdAttribute normalsAttr = meshPrim.GetNormalsAttr();
-          pxr::UsdAttribute pointsAttr = meshPrim.GetPointsAttr();
-          pxr::UsdAttribute facesCountAttr = meshPrim.GetFaceVertexCountsAttr();
-          pxr::UsdAttribute facesIndicesAttr = meshPrim.GetFaceVertexIndicesAttr();
+  void ImportPrim(vtkRenderer* renderer, vtkDataAssembly* hierarchy,
+    vtkActorCollection* actorCollection, const pxr::UsdPrim& prim, const pxr::SdfPath& path,
+    vtkMatrix4x4* currentMatrix, const PrototypeInstances* instances = nullptr)
+  {
+    pxr::UsdTimeCode timeCode = this->CurrentTime * this->Stage->GetTimeCodesPerSecond();
 
-          std::vector<pxr::UsdGeomPrimvar> primVars =
-            pxr::UsdGeomPrimvarsAPI(meshPrim).GetPrimvars();
+    if (prim.IsA<pxr::UsdGeomImageable>())
+    {
+      pxr::UsdGeomImageable imageable = pxr::UsdGeomImageable(prim);
 
-          auto TimeVarying = [](const auto& a) { return a.ValueMightBeTimeVarying(); };
+      pxr::TfToken visibility;
+      pxr::UsdAttribute visAttr = imageable.GetVisibilityAttr();
+      if (visAttr && visAttr.HasAuthoredValue() && visAttr.Get(&visibility, timeCode) &&
+        visibility == pxr::UsdGeomTokens->invisible)
+      {
+        // not visible, skip
+        return;
+      }
 
-          bool animatedAttribute = std::ranges::any_of(primVars, TimeVarying);
-          animatedAttribute = animatedAttribute || TimeVarying(pointsAttr);
-          animatedAttribute = animatedAttribute || TimeVarying(normalsAttr);
-          animatedAttribute = animatedAttribute || TimeVarying(facesCountAttr);
-          animatedAttribute = animatedAttribute || TimeVarying(facesIndicesAttr);
+      pxr::TfToken purpose;
+      pxr::UsdAttribute purpAttr = imageable.GetPurposeAttr();
+      if (purpAttr && purpAttr.HasAuthoredValue() && purpAttr.Get(&purpose, timeCode) &&
+        (purpose == pxr::UsdGeomTokens->proxy || purpose == pxr::UsdGeomTokens->guide))
+      {
+        // proxy, skip
+        return;
+      }
+    }
 
-          // Check if the mesh has to be rebuilt
-          if (!meshAlreadyExists || animatedAttribute)
-          {
-            vtkNew<vtkPolyData> newPolyData;
+    if (prim.IsInstance())
+    {
+      pxr::UsdGeomXform xform = pxr::UsdGeomXform(prim);
 
-            // normals
-            pxr::VtArray<pxr::GfVec3f> normals;
-            normalsAttr.Get(&normals, timeCode);
+      auto mat = this->GetLocalTransform(xform, timeCode);
+      vtkMatrix4x4::Multiply4x4(currentMatrix, mat, mat);
 
-            if (normals.size() > 0)
-            {
-              vtkNew<vtkFloatArray> vNormals;
-              vNormals->SetName("Normals");
-              vNormals->SetNumberOfComponents(3);
+      this->ImportNode(renderer, hierarchy, actorCollection, prim.GetPrototype(),
+        path.AppendChild(prim.GetName()), mat);
+    }
+    else if (prim.IsA<pxr::UsdGeomPointInstancer>())
+    {
+      this->ImportPointInstancer(renderer, hierarchy, actorCollection,
+        pxr::UsdGeomPointInstancer(prim), path, currentMatrix);
+    }
+    else if (prim.IsA<pxr::UsdGeomGprim>())
+    {
+      pxr::UsdGeomGprim geomPrim = pxr::UsdGeomGprim(prim);
+
+      vtkSmartPointer<vtkPolyData> polydata;
+      bool useDirectScalars = false;
+
+      if (prim.IsA<pxr::UsdGeomMesh>())
+      {
+        pxr::UsdGeomMesh meshPrim = pxr::UsdGeomMesh(prim);
+
+        vtkSmartPointer<vtkPolyData>& mappedPolydata =
+          this->MeshMap[meshPrim.GetPath().GetAsString()];
+        bool meshAlreadyExists = (mappedPolydata != nullptr);
+
+        // attributes
+        pxr::UsdAttribute normalsAttr = meshPrim.GetNormalsAttr();
+        pxr::UsdAttribute pointsAttr = meshPrim.GetPointsAttr();
+        pxr::UsdAttribute facesCountAttr = meshPrim.GetFaceVertexCountsAttr();
+        pxr::UsdAttribute facesIndicesAttr = meshPrim.GetFaceVertexIndicesAttr();
+
+        std::vector<pxr::UsdGeomPrimvar> primVars =
+          pxr::UsdGeomPrimvarsAPI(meshPrim).GetPrimvars();
+
+        auto TimeVarying = [](const auto& a) { return a.ValueMightBeTimeVarying(); };
+
+        bool animatedAttribute = std::ranges::any_of(primVars, TimeVarying);
+        animatedAttribute = animatedAttribute || TimeVarying(pointsAttr);
+        animatedAttribute = animatedAttribute || TimeVarying(normalsAttr);
+        animatedAttribute = animatedAttribute || TimeVarying(facesCountAttr);
+        animatedAttribute = animatedAttribute || TimeVarying(facesIndicesAttr);
+
+        // Check if the mesh has to be rebuilt
+        if (!meshAlreadyExists || animatedAttribute)
+        {
+          vtkNew<vtkPolyData> newPolyData;
+
+          // normals
+          pxr::VtArray<pxr::GfVec3f> normals;
+          normalsAttr.Get(&normals, timeCode);
+
+          if (normals.size() > 0)
+          {
+            vtkNew<vtkFloatArray> vNormals;
+            vNormals->SetName("Normals");
+            vNormals->SetNumberOfComponents(3);
 #if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 6, 20260320)
-              vNormals->ReserveValues(normals.size());
+            vNormals->ReserveValues(normals.size());
 #else
-              vNormals->Allocate(normals.size());
+            vNormals->Allocate(normals.size());
 #endif
 
-              for (const pxr::GfVec3f& n : normals)
-              {
-                vNormals->InsertNextTuple3(n[0], n[1], n[2]);
-              }
+            for (const pxr::GfVec3f& n : normals)
+            {
+              vNormals->InsertNextTuple3(n[0], n[1], n[2]);
+            }
 
-              vtkInformation* info = vNormals->GetInformation();
-              info->Set(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE(),
-                meshPrim.GetNormalsInterpolation() == pxr::UsdGeomTokens->faceVarying ? 1 : 0);
+            vtkInformation* info = vNormals->GetInformation();
+            info->Set(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE(),
+              meshPrim.GetNormalsInterpolation() == pxr::UsdGeomTokens->faceVarying ? 1 : 0);
 
-              newPolyData->GetPointData()->SetNormals(vNormals);
-            }
+            newPolyData->GetPointData()->SetNormals(vNormals);
+          }
 
-            // texture coordinates
-            bool firstArray = true;
-            for (const pxr::UsdGeomPrimvar& primVar : primVars)
+          // texture coordinates
+          bool firstArray = true;
+          for (const pxr::UsdGeomPrimvar& primVar : primVars)
+          {
+            if (primVar.GetTypeName() == "texCoord2f[]" || primVar.GetTypeName() == "float2[]")
             {
-              if (primVar.GetTypeName() == "texCoord2f[]" || primVar.GetTypeName() == "float2[]")
+              pxr::VtArray<pxr::GfVec2f> uvs;
+              primVar.Get(&uvs, timeCode);
+
+              if (uvs.size() > 0)
               {
-                pxr::VtArray<pxr::GfVec2f> uvs;
-                primVar.Get(&uvs, timeCode);
+                std::string name = primVar.GetPrimvarName();
 
-                if (uvs.size() > 0)
-                {
-                  std::string name = primVar.GetPrimvarName();
+                vtkNew<vtkFloatArray> texCoords;
+                texCoords->SetName(name.c_str());
+                texCoords->SetNumberOfComponents(2);
 
-                  vtkNew<vtkFloatArray> texCoords;
-                  texCoords->SetName(name.c_str());
-                  texCoords->SetNumberOfComponents(2);
+                if (primVar.IsIndexed())
+                {
+                  pxr::UsdAttribute indicesAttr = primVar.GetIndicesAttr();
 
-                  if (primVar.IsIndexed())
+                  pxr::VtArray<int> indices;
+                  if (indicesAttr.Get(&indices) && indices.size() > 0)
                   {
-                    pxr::UsdAttribute indicesAttr = primVar.GetIndicesAttr();
-
-                    pxr::VtArray<int> indices;
-                    if (indicesAttr.Get(&indices) && indices.size() > 0)
-                    {
 #if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 6, 20260320)
-                      texCoords->ReserveValues(indices.size());
+                    texCoords->ReserveValues(indices.size());
 #else
-                      texCoords->Allocate(indices.size());
+                    texCoords->Allocate(indices.size());
 #endif
 
-                      for (int index : indices)
-                      {
-                        const pxr::GfVec2f& uv = uvs[index];
-                        texCoords->InsertNextTuple2(uv[0], uv[1]);
-                      }
+                    for (int index : indices)
+                    {
+                      const pxr::GfVec2f& uv = uvs[index];
+                      texCoords->InsertNextTuple2(uv[0], uv[1]);
                     }
                   }
-                  else
-                  {
+                }
+                else
+                {
 #if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 6, 20260320)
-                    texCoords->ReserveValues(uvs.size());
+                  texCoords->ReserveValues(uvs.size());
 #else
-                    texCoords->Allocate(uvs.size());
+                  texCoords->Allocate(uvs.size());
 #endif
 
-                    for (const pxr::GfVec2f& uv : uvs)
-                    {
-                      texCoords->InsertNextTuple2(uv[0], uv[1]);
-                    }
+                  for (const pxr::GfVec2f& uv : uvs)
+                  {
+                    texCoords->InsertNextTuple2(uv[0], uv[1]);
                   }
+                }
 
-                  vtkInformation* info = texCoords->GetInformation();
-                  info->Set(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE(),
-                    primVar.GetInterpolation() == pxr::UsdGeomTokens->faceVarying ? 1 : 0);
+                vtkInformation* info = texCoords->GetInformation();
+                info->Set(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE(),
+                  primVar.GetInterpolation() == pxr::UsdGeomTokens->faceVarying ? 1 : 0);
 
-                  // the size of the array can be larger than the number of points if the attribute
-                  // interpolation is face-varying.
-                  // It will be normalized by the vtkF3DFaceVaryingPointDispatcher later
-                  newPolyData->GetPointData()->AddArray(texCoords);
+                // the size of the array can be larger than the number of points if the attribute
+                // interpolation is face-varying.
+                // It will be normalized by the vtkF3DFaceVaryingPointDispatcher later
+                newPolyData->GetPointData()->AddArray(texCoords);
 
-                  if (firstArray)
-                  {
-                    // sometimes we are enable to fetch the array name to use for texture mapping
-                    // so we fallback to the first UV set added
-                    // see https://github.com/f3d-app/f3d/issues/1184
-                    firstArray = false;
-                    newPolyData->GetPointData()->SetTCoords(texCoords);
-                  }
+                if (firstArray)
+                {
+                  // sometimes we are enable to fetch the array name to use for texture mapping
+                  // so we fallback to the first UV set added
+                  // see https://github.com/f3d-app/f3d/issues/1184
+                  firstArray = false;
+                  newPolyData->GetPointData()->SetTCoords(texCoords);
                 }
               }
             }
+          }
 
-            // points
-            pxr::VtArray<pxr::GfVec3f> positions;
-            pointsAttr.Get(&positions, timeCode);
+          // points
+          pxr::VtArray<pxr::GfVec3f> positions;
+          pointsAttr.Get(&positions, timeCode);
 
-            vtkNew<vtkPoints> points;
+          vtkNew<vtkPoints> points;
 #if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 6, 20260320)
-            points->Reserve(positions.size());
+          points->Reserve(positions.size());
 #else
-            points->Allocate(positions.size());
+          points->Allocate(positions.size());
 #endif
-            for (const pxr::GfVec3f& p : positions)
-            {
-              points->InsertNextPoint(p[0], p[1], p[2]);
-            }
+          for (const pxr::GfVec3f& p : positions)
+          {
+            points->InsertNextPoint(p[0], p[1], p[2]);
+          }
 
-            newPolyData->SetPoints(points);
+          newPolyData->SetPoints(points);
 
-            // faces
-            pxr::VtArray<int> counts;
-            facesCountAttr.Get(&counts, timeCode);
+          // faces
+          pxr::VtArray<int> counts;
+          facesCountAttr.Get(&counts, timeCode);
 
-            pxr::VtArray<int> indices;
-            facesIndicesAttr.Get(&indices, timeCode);
+          pxr::VtArray<int> indices;
+          facesIndicesAttr.Get(&indices, timeCode);
 
-            // add polygons
-            vtkNew<vtkCellArray> cells;
-            auto currentCellIt = indices.cbegin();
-            std::vector<vtkIdType> indexArr;
-            for (int c : counts)
-            {
-              indexArr.clear();
-              indexArr.insert(indexArr.begin(), currentCellIt, std::next(currentCellIt, c));
-              cells->InsertNextCell(c, indexArr.data());
-              std::advance(currentCellIt, c);
-            }
+          // add polygons
+          vtkNew<vtkCellArray> cells;
+          auto currentCellIt = indices.cbegin();
+          std::vector<vtkIdType> indexArr;
+          for (int c : counts)
+          {
+            indexArr.clear();
+            indexArr.insert(indexArr.begin(), currentCellIt, std::next(currentCellIt, c));
+            cells->InsertNextCell(c, indexArr.data());
+            std::advance(currentCellIt, c);
+          }
 
-            newPolyData->SetPolys(cells);
+          newPolyData->SetPolys(cells);
 
-            if (pxr::UsdSkelSkinningQuery skinningQuery = this->SkelCache.GetSkinningQuery(prim))
+          if (pxr::UsdSkelSkinningQuery skinningQuery = this->SkelCache.GetSkinningQuery(prim))
+          {
+            // save skinning buffers to the polydata
+            if (skinningQuery.HasJointInfluences() && !meshAlreadyExists)
             {
-              // save skinning buffers to the polydata
-              if (skinningQuery.HasJointInfluences() && !meshAlreadyExists)
+              pxr::VtIntArray jointIndices;
+              pxr::VtFloatArray jointWeights;
+              int numInfluences = skinningQuery.GetNumInfluencesPerComponent();
+
+              if (skinningQuery.ComputeVaryingJointInfluences(
+                    positions.size(), &jointIndices, &jointWeights))
               {
-                pxr::VtIntArray jointIndices;
-                pxr::VtFloatArray jointWeights;
-                int numInfluences = skinningQuery.GetNumInfluencesPerComponent();
+                vtkNew<vtkUnsignedShortArray> jointsArr;
+                jointsArr->SetName("JOINTS_0");
+                jointsArr->SetNumberOfComponents(4);
+                jointsArr->SetNumberOfTuples(static_cast<vtkIdType>(positions.size()));
+                jointsArr->Fill(0);
 
-                if (skinningQuery.ComputeVaryingJointInfluences(
-                      positions.size(), &jointIndices, &jointWeights))
-                {
-                  vtkNew<vtkUnsignedShortArray> jointsArr;
-                  jointsArr->SetName("JOINTS_0");
-                  jointsArr->SetNumberOfComponents(4);
-                  jointsArr->SetNumberOfTuples(static_cast<vtkIdType>(positions.size()));
-                  jointsArr->Fill(0);
+                vtkNew<vtkFloatArray> weightsArr;
+                weightsArr->SetName("WEIGHTS_0");
+                weightsArr->SetNumberOfComponents(4);
+                weightsArr->SetNumberOfTuples(static_cast<vtkIdType>(positions.size()));
+                weightsArr->Fill(0);
 
-                  vtkNew<vtkFloatArray> weightsArr;
-                  weightsArr->SetName("WEIGHTS_0");
-                  weightsArr->SetNumberOfComponents(4);
-                  weightsArr->SetNumberOfTuples(static_cast<vtkIdType>(positions.size()));
-                  weightsArr->Fill(0);
+                // F3D mapper is limited to 4 influences
+                int components = std::min(numInfluences, 4);
 
-                  // F3D mapper is limited to 4 influences
-                  int components = std::min(numInfluences, 4);
+                std::vector<std::pair<float, int>> influences;
+                influences.reserve(numInfluences);
 
-                  std::vector<std::pair<float, int>> influences;
-                  influences.reserve(numInfluences);
+                for (std::size_t i = 0; i < positions.size(); i++)
+                {
+                  // point influences
+                  influences.resize(numInfluences);
 
-                  for (std::size_t i = 0; i < positions.size(); i++)
+                  for (int j = 0; j < numInfluences; j++)
                   {
-                    // point influences
-                    influences.resize(numInfluences);
+                    int idx = static_cast<int>(i) * numInfluences + j;
+                    influences[j] = std::make_pair(jointWeights[idx], jointIndices[idx]);
+                  }
 
-                    for (int j = 0; j < numInfluences; j++)
-                    {
-                      int idx = static_cast<int>(i) * numInfluences + j;
-                      influences[j] = std::make_pair(jointWeights[idx], jointIndices[idx]);
-                    }
+                  // Sort descending by weight to get the top 4
+                  std::ranges::partial_sort(influences, influences.begin() + components,
+                    [](const auto& a, const auto& b) { return a.first > b.first; });
 
-                    // Sort descending by weight to get the top 4
-                    std::ranges::partial_sort(influences, influences.begin() + components,
-                      [](const auto& a, const auto& b) { return a.first > b.first; });
+                  float totalWeight = 0.0f;
+                  for (int j = 0; j < components; j++)
+                  {
+                    jointsArr->SetTypedComponent(static_cast<vtkIdType>(i), j,
+                      static_cast<unsigned short>(influences[j].second));
+                    weightsArr->SetTypedComponent(
+                      static_cast<vtkIdType>(i), j, influences[j].first);
+                    totalWeight += influences[j].first;
+                  }
 
-                    float totalWeight = 0.0f;
+                  // Re-normalize after potential truncation
+                  if (totalWeight > 0.0f)
+                  {
                     for (int j = 0; j < components; j++)
                     {
-                      jointsArr->SetTypedComponent(static_cast<vtkIdType>(i), j,
-                        static_cast<unsigned short>(influences[j].second));
+                      float w = weightsArr->GetTypedComponent(static_cast<vtkIdType>(i), j);
                       weightsArr->SetTypedComponent(
-                        static_cast<vtkIdType>(i), j, influences[j].first);
-                      totalWeight += influences[j].first;
-                    }
-
-                    // Re-normalize after potential truncation
-                    if (totalWeight > 0.0f)
-                    {
-                      for (int j = 0; j < components; j++)
-                      {
-                        float w = weightsArr->GetTypedComponent(static_cast<vtkIdType>(i), j);
-                        weightsArr->SetTypedComponent(
-                          static_cast<vtkIdType>(i), j, w / totalWeight);
-                      }
+                        static_cast<vtkIdType>(i), j, w / totalWeight);
                     }
                   }
-                  newPolyData->GetPointData()->AddArray(jointsArr);
-                  newPolyData->GetPointData()->AddArray(weightsArr);
                 }
+                newPolyData->GetPointData()->AddArray(jointsArr);
+                newPolyData->GetPointData()->AddArray(weightsArr);
               }
+            }
 
-              // save morphing info (aka blend shapes)
-              if (skinningQuery.HasBlendShapes() && !meshAlreadyExists)
-              {
-                MorphingInfo& info = this->MorphingMap[meshPrim.GetPath().GetAsString()];
+            // save morphing info (aka blend shapes)
+            if (skinningQuery.HasBlendShapes() && !meshAlreadyExists)
+            {
+              MorphingInfo& info = this->MorphingMap[meshPrim.GetPath().GetAsString()];
 
-                // Cache blend shape data for per-frame CPU deformation
-                info.BindPositions = positions;
-                pxr::UsdSkelBindingAPI binding(prim);
-                pxr::UsdSkelBlendShapeQuery blendShapeQuery(binding);
-                if (blendShapeQuery)
-                {
-                  info.BlendShapePointIndices = blendShapeQuery.ComputeBlendShapePointIndices();
-                  info.SubShapePointOffsets = blendShapeQuery.ComputeSubShapePointOffsets();
-                }
+              // Cache blend shape data for per-frame CPU deformation
+              info.BindPositions = positions;
+              pxr::UsdSkelBindingAPI binding(prim);
+              pxr::UsdSkelBlendShapeQuery blendShapeQuery(binding);
+              if (blendShapeQuery)
+              {
+                info.BlendShapePointIndices = blendShapeQuery.ComputeBlendShapePointIndices();
+                info.SubShapePointOffsets = blendShapeQuery.ComputeSubShapePointOffsets();
               }
             }
-
-            vtkNew<vtkF3DFaceVaryingPointDispatcher> faceVaryingFilter;
-            faceVaryingFilter->SetInputData(newPolyData);
-            faceVaryingFilter->Update();
-
-            mappedPolydata = faceVaryingFilter->GetOutput();
           }
 
-          polydata = mappedPolydata;
+          // Only points are animated afterwards, so identical corners can be merged
+          vtkNew<vtkF3DFaceVaryingPointDispatcher> faceVaryingFilter;
+          faceVaryingFilter->SetInputData(newPolyData);
+          faceVaryingFilter->MergeCornersOn();
+          faceVaryingFilter->Update();
+
+          mappedPolydata = faceVaryingFilter->GetOutput();
         }
-        else if (prim.IsA<pxr::UsdGeomSphere>())
-        {
-          pxr::UsdGeomSphere spherePrim = pxr::UsdGeomSphere(prim);
 
-          vtkNew<vtkSphereSource> sphere;
-          sphere->SetThetaResolution(20);
-          sphere->SetPhiResolution(20);
+        polydata = mappedPolydata;
+      }
+      else if (prim.IsA<pxr::UsdGeomSphere>())
+      {
+        pxr::UsdGeomSphere spherePrim = pxr::UsdGeomSphere(prim);
 
-          double radius;
-          if (spherePrim.GetRadiusAttr().Get(&radius))
-          {
-            sphere->SetRadius(radius);
-          }
+        vtkNew<vtkSphereSource> sphere;
+        sphere->SetThetaResolution(20);
+        sphere->SetPhiResolution(20);
 
-          sphere->Update();
-          polydata = sphere->GetOutput();
-        }
-        else if (prim.IsA<pxr::UsdGeomCube>())
+        double radius;
+        if (spherePrim.GetRadiusAttr().Get(&radius))
         {
-          pxr::UsdGeomCube cubePrim = pxr::UsdGeomCube(prim);
+          sphere->SetRadius(radius);
+        }
 
-          vtkNew<vtkCubeSource> cube;
+        sphere->Update();
+        polydata = sphere->GetOutput();
+      }
+      else if (prim.IsA<pxr::UsdGeomCube>())
+      {
+        pxr::UsdGeomCube cubePrim = pxr::UsdGeomCube(prim);
 
-          double length;
-          if (cubePrim.GetSizeAttr().Get(&length))
-          {
-            cube->SetXLength(length);
-            cube->SetYLength(length);
-            cube->SetZLength(length);
-          }
+        vtkNew<vtkCubeSource> cube;
 
-          cube->Update();
-          polydata = cube->GetOutput();
-        }
-        else if (prim.IsA<pxr::UsdGeomCapsule>())
+        double length;
+        if (cubePrim.GetSizeAttr().Get(&length))
         {
-          pxr::UsdGeomCapsule capsulePrim = pxr::UsdGeomCapsule(prim);
+          cube->SetXLength(length);
+          cube->SetYLength(length);
+          cube->SetZLength(length);
+        }
 
-          vtkNew<vtkCylinderSource> capsule;
-          capsule->CapsuleCapOn();
+        cube->Update();
+        polydata = cube->GetOutput();
+      }
+      else if (prim.IsA<pxr::UsdGeomCapsule>())
+      {
+        pxr::UsdGeomCapsule capsulePrim = pxr::UsdGeomCapsule(prim);
 
-          double height;
-          if (capsulePrim.GetHeightAttr().Get(&height))
-          {
-            capsule->SetHeight(height);
-          }
+        vtkNew<vtkCylinderSource> capsule;
+        capsule->CapsuleCapOn();
 
-          double radius;
-          if (capsulePrim.GetRadiusAttr().Get(&radius))
-          {
-            capsule->SetRadius(radius);
-          }
+        double height;
+        if (capsulePrim.GetHeightAttr().Get(&height))
+        {
+          capsule->SetHeight(height);
+        }
 
-          // In VTK, the capsule is aligned with the Y axis
-          // In USD, the default is aligned with Z, but can be modified
-          // Let's rotate it if needed
-          vtkNew<vtkTransformFilter> transform;
-          vtkNew<vtkTransform> t;
-          transform->SetTransform(t);
+        double radius;
+        if (capsulePrim.GetRadiusAttr().Get(&radius))
+        {
+          capsule->SetRadius(radius);
+        }
 
-          pxr::TfToken axisToken(pxr::UsdGeomTokens->z);
-          capsulePrim.GetAxisAttr().Get(&axisToken);
+        // In VTK, the capsule is aligned with the Y axis
+        // In USD, the default is aligned with Z, but can be modified
+        // Let's rotate it if needed
+        vtkNew<vtkTransformFilter> transform;
+        vtkNew<vtkTransform> t;
+        transform->SetTransform(t);
 
-          if (axisToken == pxr::UsdGeomTokens->x)
-          {
-            t->RotateZ(90.0);
-          }
-          else if (axisToken == pxr::UsdGeomTokens->z)
-          {
-            t->RotateX(90.0);
-          }
+        pxr::TfToken axisToken(pxr::UsdGeomTokens->z);
+        capsulePrim.GetAxisAttr().Get(&axisToken);
 
-          transform->SetInputConnection(capsule->GetOutputPort());
-          transform->Update();
-          polydata = vtkPolyData::SafeDownCast(transform->GetOutput());
+        if (axisToken == pxr::UsdGeomTokens->x)
+        {
+          t->RotateZ(90.0);
         }
-        else if (prim.IsA<pxr::UsdGeomCylinder>())
+        else if (axisToken == pxr::UsdGeomTokens->z)
         {
-          pxr::UsdGeomCylinder cylinderPrim = pxr::UsdGeomCylinder(prim);
-          vtkNew<vtkCylinderSource> cylinder;
-          cylinder->SetResolution(20);
+          t->RotateX(90.0);
+        }
 
-          double height;
-          if (cylinderPrim.GetHeightAttr().Get(&height))
-          {
-            cylinder->SetHeight(height);
-          }
+        transform->SetInputConnection(capsule->GetOutputPort());
+        transform->Update();
+        polydata = vtkPolyData::SafeDownCast(transform->GetOutput());
+      }
+      else if (prim.IsA<pxr::UsdGeomCylinder>())
+      {
+        pxr::UsdGeomCylinder cylinderPrim = pxr::UsdGeomCylinder(prim);
+        vtkNew<vtkCylinderSource> cylinder;
+        cylinder->SetResolution(20);
 
-          double radius;
-          if (cylinderPrim.GetRadiusAttr().Get(&radius))
-          {
-            cylinder->SetRadius(radius);
-          }
+        double height;
+        if (cylinderPrim.GetHeightAttr().Get(&height))
+        {
+          cylinder->SetHeight(height);
+        }
 
-          // In VTK, the cylinder is aligned with the Y axis
-          // In USD, the default is aligned with Z, but can be modified
-          // Let's rotate it if needed
-          vtkNew<vtkTransformFilter> transform;
-          vtkNew<vtkTransform> t;
-          transform->SetTransform(t);
+        double radius;
+        if (cylinderPrim.GetRadiusAttr().Get(&radius))
+        {
+          cylinder->SetRadius(radius);
+        }
 
-          pxr::TfToken axisToken(pxr::UsdGeomTokens->z);
-          cylinderPrim.GetAxisAttr().Get(&axisToken);
+        // In VTK, the cylinder is aligned with the Y axis
+        // In USD, the default is aligned with Z, but can be modified
+        // Let's rotate it if needed
+        vtkNew<vtkTransformFilter> transform;
+        vtkNew<vtkTransform> t;
+        transform->SetTransform(t);
 
-          if (axisToken == pxr::TfToken(pxr::UsdGeomTokens->x))
-          {
-            t->RotateZ(90.0);
-          }
-          else if (axisToken == pxr::TfToken(pxr::UsdGeomTokens->z))
-          {
-            t->RotateX(90.0);
-          }
+        pxr::TfToken axisToken(pxr::UsdGeomTokens->z);
+        cylinderPrim.GetAxisAttr().Get(&axisToken);
 
-          transform->SetInputConnection(cylinder->GetOutputPort());
-          transform->Update();
-          polydata = vtkPolyData::SafeDownCast(transform->GetOutput());
+        if (axisToken == pxr::TfToken(pxr::UsdGeomTokens->x))
+        {
+          t->RotateZ(90.0);
         }
-        else if (prim.IsA<pxr::UsdGeomCone>())
+        else if (axisToken == pxr::TfToken(pxr::UsdGeomTokens->z))
         {
-          pxr::UsdGeomCone conePrim = pxr::UsdGeomCone(prim);
-          vtkNew<vtkConeSource> cone;
-          cone->SetResolution(20);
+          t->RotateX(90.0);
+        }
 
-          double height;
-          if (conePrim.GetHeightAttr().Get(&height))
-          {
-            cone->SetHeight(height);
-          }
+        transform->SetInputConnection(cylinder->GetOutputPort());
+        transform->Update();
+        polydata = vtkPolyData::SafeDownCast(transform->GetOutput());
+      }
+      else if (prim.IsA<pxr::UsdGeomCone>())
+      {
+        pxr::UsdGeomCone conePrim = pxr::UsdGeomCone(prim);
+        vtkNew<vtkConeSource> cone;
+        cone->SetResolution(20);
 
-          double radius;
-          if (conePrim.GetRadiusAttr().Get(&radius))
-          {
-            cone->SetRadius(radius);
-          }
+        double height;
+        if (conePrim.GetHeightAttr().Get(&height))
+        {
+          cone->SetHeight(height);
+        }
 
-          // In VTK, the cylinder is aligned with the X axis
-          // In USD, the default is aligned with Z, but can be modified
-          // Let's rotate it if needed
-          vtkNew<vtkTransformFilter> transform;
-          vtkNew<vtkTransform> t;
-          transform->SetTransform(t);
+        double radius;
+        if (conePrim.GetRadiusAttr().Get(&radius))
+        {
+          cone->SetRadius(radius);
+        }
 
-          pxr::TfToken axisToken(pxr::UsdGeomTokens->z);
-          conePrim.GetAxisAttr().Get(&axisToken);
+        // In VTK, the cylinder is aligned with the X axis
+        // In USD, the default is aligned with Z, but can be modified
+        // Let's rotate it if needed
+        vtkNew<vtkTransformFilter> transform;
+        vtkNew<vtkTransform> t;
+        transform->SetTransform(t);
 
-          if (axisToken == pxr::TfToken(pxr::UsdGeomTokens->y))
-          {
-            t->RotateZ(90.0);
-          }
-          else if (axisToken == pxr::TfToken(pxr::UsdGeomTokens->z))
-          {
-            t->RotateY(90.0);
-          }
+        pxr::TfToken axisToken(pxr::UsdGeomTokens->z);
+        conePrim.GetAxisAttr().Get(&axisToken);
 
-          transform->SetInputConnection(cone->GetOutputPort());
-          transform->Update();
-          polydata = vtkPolyData::SafeDownCast(transform->GetOutput());
+        if (axisToken == pxr::TfToken(pxr::UsdGeomTokens->y))
+        {
+          t->RotateZ(90.0);
         }
-        else if (prim.IsA<pxr::UsdGeomPoints>())
+        else if (axisToken == pxr::TfToken(pxr::UsdGeomTokens->z))
         {
-          pxr::UsdGeomPoints pointsPrim = pxr::UsdGeomPoints(prim);
+          t->RotateY(90.0);
+        }
 
-          pxr::VtArray<pxr::GfVec3f> positions;
-          pointsPrim.GetPointsAttr().Get(&positions, timeCode);
+        transform->SetInputConnection(cone->GetOutputPort());
+        transform->Update();
+        polydata = vtkPolyData::SafeDownCast(transform->GetOutput());
+      }
+      else if (prim.IsA<pxr::UsdGeomPoints>())
+      {
+        pxr::UsdGeomPoints pointsPrim = pxr::UsdGeomPoints(prim);
 
-          vtkNew<vtkPolyData> newPolyData;
+        pxr::VtArray<pxr::GfVec3f> positions;
+        pointsPrim.GetPointsAttr().Get(&positions, timeCode);
 
-          vtkNew<vtkPoints> points;
-          points->SetNumberOfPoints(static_cast<vtkIdType>(positions.size()));
+        vtkNew<vtkPolyData> newPolyData;
+
+        vtkNew<vtkPoints> points;
+        points->SetNumberOfPoints(static_cast<vtkIdType>(positions.size()));
+        for (std::size_t i = 0; i < positions.size(); i++)
+        {
+          const pxr::GfVec3f& p = positions[i];
+          points->SetPoint(static_cast<vtkIdType>(i), p[0], p[1], p[2]);
+        }
+        newPolyData->SetPoints(points);
+
+        if (positions.size() > 0)
+        {
+          vtkNew<vtkIdTypeArray> vertIds;
+          vertIds->SetNumberOfValues(static_cast<vtkIdType>(positions.size()));
           for (std::size_t i = 0; i < positions.size(); i++)
           {
-            const pxr::GfVec3f& p = positions[i];
-            points->SetPoint(static_cast<vtkIdType>(i), p[0], p[1], p[2]);
+            vertIds->SetValue(static_cast<vtkIdType>(i), static_cast<vtkIdType>(i));
           }
-          newPolyData->SetPoints(points);
 
-          if (positions.size() > 0)
-          {
-            vtkNew<vtkIdTypeArray> vertIds;
-            vertIds->SetNumberOfValues(static_cast<vtkIdType>(positions.size()));
-            for (std::size_t i = 0; i < positions.size(); i++)
-            {
-              vertIds->SetValue(static_cast<vtkIdType>(i), static_cast<vtkIdType>(i));
-            }
+          vtkNew<vtkCellArray> verts;
+          verts->SetData(static_cast<vtkIdType>(positions.size()), vertIds);
+          newPolyData->SetVerts(verts);
+        }
 
-            vtkNew<vtkCellArray> verts;
-            verts->SetData(static_cast<vtkIdType>(positions.size()), vertIds);
-            newPolyData->SetVerts(verts);
-          }
+        pxr::UsdGeomPrimvar colorPrimvar = pointsPrim.GetDisplayColorPrimvar();
+        pxr::UsdGeomPrimvar opacityPrimvar = pointsPrim.GetDisplayOpacityPrimvar();
 
-          pxr::UsdGeomPrimvar colorPrimvar = pointsPrim.GetDisplayColorPrimvar();
-          pxr::UsdGeomPrimvar opacityPrimvar = pointsPrim.GetDisplayOpacityPrimvar();
+        pxr::VtArray<pxr::GfVec3f> colors;
+        const bool hasColors =
+          colorPrimvar && colorPrimvar.Get(&colors, timeCode) && colors.size() > 0;
 
-          pxr::VtArray<pxr::GfVec3f> colors;
-          const bool hasColors =
-            colorPrimvar && colorPrimvar.Get(&colors, timeCode) && colors.size() > 0;
+        pxr::VtArray<float> opacities;
+        const bool hasOpacity =
+          opacityPrimvar && opacityPrimvar.Get(&opacities, timeCode) && opacities.size() > 0;
 
-          pxr::VtArray<float> opacities;
-          const bool hasOpacity =
-            opacityPrimvar && opacityPrimvar.Get(&opacities, timeCode) && opacities.size() > 0;
+        if (hasColors || hasOpacity)
+        {
+          const int numComps = hasOpacity ? 4 : 3;
+          vtkNew<vtkFloatArray> pointColors;
+          pointColors->SetName(hasOpacity ? "RGBA" : "RGB");
+          pointColors->SetNumberOfComponents(numComps);
+          pointColors->SetNumberOfTuples(static_cast<vtkIdType>(positions.size()));
 
-          if (hasColors || hasOpacity)
+          for (std::size_t i = 0; i < positions.size(); i++)
           {
-            const int numComps = hasOpacity ? 4 : 3;
-            vtkNew<vtkFloatArray> pointColors;
-            pointColors->SetName(hasOpacity ? "RGBA" : "RGB");
-            pointColors->SetNumberOfComponents(numComps);
-            pointColors->SetNumberOfTuples(static_cast<vtkIdType>(positions.size()));
+            const std::size_t colorIndex = hasColors && colors.size() == positions.size() ? i : 0;
+            const std::size_t opacityIndex =
+              hasOpacity && opacities.size() == positions.size() ? i : 0;
+            const pxr::GfVec3f c = hasColors ? colors[colorIndex] : pxr::GfVec3f(1.f);
 
-            for (std::size_t i = 0; i < positions.size(); i++)
+            if (hasOpacity)
             {
-              const std::size_t colorIndex = hasColors && colors.size() == positions.size() ? i : 0;
-              const std::size_t opacityIndex =
-                hasOpacity && opacities.size() == positions.size() ? i : 0;
-              const pxr::GfVec3f c = hasColors ? colors[colorIndex] : pxr::GfVec3f(1.f);
-
-              if (hasOpacity)
-              {
-                const float rgba[4] = { c[0], c[1], c[2], opacities[opacityIndex] };
-                pointColors->SetTypedTuple(static_cast<vtkIdType>(i), rgba);
-              }
-              else
-              {
-                const float rgb[3] = { c[0], c[1], c[2] };
-                pointColors->SetTypedTuple(static_cast<vtkIdType>(i), rgb);
-              }
+              const float rgba[4] = { c[0], c[1], c[2], opacities[opacityIndex] };
+              pointColors->SetTypedTuple(static_cast<vtkIdType>(i), rgba);
+            }
+            else
+            {
+              const float rgb[3] = { c[0], c[1], c[2] };
+              pointColors->SetTypedTuple(static_cast<vtkIdType>(i), rgb);
             }
-
-            newPolyData->GetPointData()->SetScalars(pointColors);
-            useDirectScalars = true;
           }
 
-          polydata = newPolyData;
-        }
-        else
-        {
-          // unsupported primitive, fallback to an empty polydata
-          vtkWarningWithObjectMacro(nullptr, "Unknown geometry type: " << prim.GetName());
-          polydata = vtkSmartPointer<vtkPolyData>::New();
+          newPolyData->GetPointData()->SetScalars(pointColors);
+          useDirectScalars = true;
         }
 
-        // create actors
+        polydata = newPolyData;
+      }
+      else
+      {
+        // unsupported primitive, fallback to an empty polydata
+        vtkWarningWithObjectMacro(nullptr, "Unknown geometry type: " << prim.GetName());
+        polydata = vtkSmartPointer<vtkPolyData>::New();
+      }
 
-        // get xform
-        auto mat = this->GetLocalTransform(geomPrim, timeCode);
+      // create actors
+
+      // get xform, relative to the point instancer if instanced
+      vtkSmartPointer<vtkMatrix4x4> mat;
+      if (instances)
+      {
+        bool resetsXformStack = false;
+        mat = this->ConvertMatrix(pxr::UsdGeomXformCache(timeCode).ComputeRelativeTransform(
+          prim, instances->Instancer, &resetsXformStack));
+      }
+      else
+      {
+        mat = this->GetLocalTransform(geomPrim, timeCode);
         vtkMatrix4x4::Multiply4x4(currentMatrix, mat, mat);
+      }
 
-        std::vector<pxr::UsdGeomSubset> subsets = pxr::UsdGeomSubset::GetGeomSubsets(geomPrim);
+      std::vector<pxr::UsdGeomSubset> subsets = pxr::UsdGeomSubset::GetGeomSubsets(geomPrim);
 
-        if (subsets.empty())
-        {
-          this->AddActor(renderer, hierarchy, actorCollection, path, geomPrim, prim, mat, polydata,
-            useDirectScalars);
-        }
-        else
+      if (subsets.empty())
+      {
+        this->AddActor(renderer, hierarchy, actorCollection, path, geomPrim, prim, mat, polydata,
+          useDirectScalars, instances);
+      }
+      else
+      {
+        // split subsets
+        for (const pxr::UsdGeomSubset& subset : subsets)
         {
-          // split subsets
-          for (const pxr::UsdGeomSubset& subset : subsets)
+          pxr::UsdAttribute indicesAttr = subset.GetIndicesAttr();
+
+          pxr::VtArray<int> indices;
+          indicesAttr.Get(&indices, timeCode);
+
+          vtkNew<vtkPolyData> polydataSubset;
+          polydataSubset->SetPoints(polydata->GetPoints());
+          polydataSubset->GetPointData()->ShallowCopy(polydata->GetPointData());
+
+          vtkCellArray* mainPolys = polydata->GetPolys();
+
+          // add polygons
+          vtkNew<vtkCellArray> cells;
+          for (int cellId : indices)
           {
-            pxr::UsdAttribute indicesAttr = subset.GetIndicesAttr();
+            vtkIdType cellSize;
+            const vtkIdType* cellPoints;
+            mainPolys->GetCellAtId(cellId, cellSize, cellPoints);
+            cells->InsertNextCell(cellSize, cellPoints);
+          }
+
+          polydataSubset->SetPolys(cells);
+
+          this->AddActor(renderer, hierarchy, actorCollection,
+            path.AppendChild(pxr::TfToken(prim.GetName())), geomPrim, subset.GetPrim(), mat,
+            polydataSubset, false, instances);
+        }
+      }
+    }
+    else
+    {
+      // Create hierarchy node for this intermediate node (Xform, Scope, etc.)
+      pxr::SdfPath nodePath = path.AppendChild(prim.GetName());
+      this->GetOrCreateHierarchyNode(hierarchy, nodePath, prim.GetName().GetString());
 
-            pxr::VtArray<int> indices;
-            indicesAttr.Get(&indices, timeCode);
+      // just traverse the node
+      this->ImportNode(
+        renderer, hierarchy, actorCollection, prim, nodePath, currentMatrix, instances);
+    }
+  }
 
-            vtkNew<vtkPolyData> polydataSubset;
-            polydataSubset->SetPoints(polydata->GetPoints());
-            polydataSubset->GetPointData()->ShallowCopy(polydata->GetPointData());
+  void ImportPointInstancer(vtkRenderer* renderer, vtkDataAssembly* hierarchy,
+    vtkActorCollection* actorCollection, const pxr::UsdGeomPointInstancer& instancer,
+    const pxr::SdfPath& path, vtkMatrix4x4* currentMatrix)
+  {
+    pxr::UsdTimeCode timeCode = this->CurrentTime * this->Stage->GetTimeCodesPerSecond();
+    pxr::UsdPrim prim = instancer.GetPrim();
 
-            vtkCellArray* mainPolys = polydata->GetPolys();
+    pxr::SdfPath instancerPath = path.AppendChild(prim.GetName());
+    this->GetOrCreateHierarchyNode(hierarchy, instancerPath, prim.GetName().GetString());
 
-            // add polygons
-            vtkNew<vtkCellArray> cells;
-            for (int cellId : indices)
-            {
-              vtkIdType cellSize;
-              const vtkIdType* cellPoints;
-              mainPolys->GetCellAtId(cellId, cellSize, cellPoints);
-              cells->InsertNextCell(cellSize, cellPoints);
-            }
+    pxr::SdfPathVector prototypePaths;
+    instancer.GetPrototypesRel().GetForwardedTargets(&prototypePaths);
 
-            polydataSubset->SetPolys(cells);
+    // the mask is applied below, so that transforms stay aligned with the prototype indices
+    pxr::VtIntArray protoIndices;
+    pxr::VtMatrix4dArray xforms;
+    if (!instancer.GetProtoIndicesAttr().Get(&protoIndices, timeCode) ||
+      !instancer.ComputeInstanceTransformsAtTime(&xforms, timeCode, timeCode,
+        pxr::UsdGeomPointInstancer::ExcludeProtoXform, pxr::UsdGeomPointInstancer::IgnoreMask) ||
+      xforms.size() != protoIndices.size())
+    {
+      return;
+    }
 
-            this->AddActor(renderer, hierarchy, actorCollection,
-              path.AppendChild(pxr::TfToken(prim.GetName())), geomPrim, subset.GetPrim(), mat,
-              polydataSubset);
-          }
+    std::vector<bool> mask = instancer.ComputeMaskAtTime(timeCode);
+
+    // the instancer transform is applied by the actors and the instance transforms by the glyphs
+    auto instancerMatrix = this->GetLocalTransform(instancer, timeCode);
+    vtkMatrix4x4::Multiply4x4(currentMatrix, instancerMatrix, instancerMatrix);
+
+    for (std::size_t p = 0; p < prototypePaths.size(); p++)
+    {
+      pxr::UsdPrim prototype = this->Stage->GetPrimAtPath(prototypePaths[p]);
+      if (!prototype)
+      {
+        continue;
+      }
+
+      std::vector<std::size_t> instanceIds;
+      for (std::size_t i = 0; i < protoIndices.size(); i++)
+      {
+        if (protoIndices[i] == static_cast<int>(p) && (mask.empty() || mask[i]))
+        {
+          instanceIds.push_back(i);
         }
       }
-      else
+
+      // nested instancing cannot be glyph mapped, fallback on importing each instance
+      pxr::UsdPrimRange range(prototype);
+      if (std::any_of(range.begin(), range.end(), [](const pxr::UsdPrim& child)
+            { return child.IsInstance() || child.IsA<pxr::UsdGeomPointInstancer>(); }))
       {
-        // Create hierarchy node for this intermediate node (Xform, Scope, etc.)
-        pxr::SdfPath nodePath = path.AppendChild(prim.GetName());
-        this->GetOrCreateHierarchyNode(hierarchy, nodePath, prim.GetName().GetString());
+        for (std::size_t i : instanceIds)
+        {
+          auto mat = this->ConvertMatrix(xforms[i]);
+          vtkMatrix4x4::Multiply4x4(currentMatrix, mat, mat);
+
+          pxr::TfToken tok(std::string("instance_") + std::to_string(i));
+          pxr::SdfPath instancePath = instancerPath.AppendChild(tok);
+          this->GetOrCreateHierarchyNode(hierarchy, instancePath, tok.GetString());
 
-        // just traverse the node
-        this->ImportNode(renderer, hierarchy, actorCollection, prim, nodePath, currentMatrix);
+          this->ImportPrim(renderer, hierarchy, actorCollection, prototype, instancePath, mat);
+        }
+        continue;
       }
+
+      PrototypeInstances instances;
+      instances.Instancer = prim;
+      instances.InstancerMatrix = instancerMatrix;
+      instances.Transforms.reserve(instanceIds.size());
+      for (std::size_t i : instanceIds)
+      {
+        instances.Transforms.push_back(xforms[i]);
+      }
+
+      this->ImportPrim(renderer, hierarchy, actorCollection, prototype, instancerPath,
+        instancerMatrix, &instances);
     }
   }
 
@@ -1744,6 +1978,15 @@ private:
     std::vector<pxr::VtVec3fArray> SubShapePointOffsets;
   };
 
+  struct InstancedMapper
+  {
+    vtkSmartPointer<vtkGlyph3DMapper> Mapper;
+    vtkSmartPointer<vtkPolyData> Instances;
+    vtkSmartPointer<vtkPolyData> Source;
+    vtkMTimeType SourceTime = 0;
+    vtkNew<vtkMatrix4x4> SourceMatrix;
+  };
+
   std::unordered_map<std::string,
     std::pair<vtkSmartPointer<vtkActor>, vtkSmartPointer<vtkPolyData>>>
     ArmatureMap;
@@ -1752,6 +1995,7 @@ private:
   std::unordered_map<std::string, vtkSmartPointer<vtkProperty>> ShaderMap;
   std::unordered_map<std::string, vtkSmartPointer<vtkImageData>> TextureMap;
   std::unordered_map<std::string, MorphingInfo> MorphingMap;
+  std::unordered_map<std::string, InstancedMapper> InstancedMapperMap;
 
   pxr::UsdSkelCache SkelCache;
   vtkNew<vtkMatrix4x4> RootTransform;
@@ -1819,6 +2063,7 @@ vtkF3DUSDImporter::~vtkF3DUSDImporter() = default;
 //----------------------------------------------------------------------------
 int vtkF3DUSDImporter::ImportBegin()
 {
+  F3D_TRACE_SCOPE_DETAIL("Open USD stage", this->GetFileName() ? this->GetFileName() : "stream");
   try
   {
 #if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
@@ -1850,6 +2095,8 @@ int vtkF3DUSDImporter::ImportBegin()
 //----------------------------------------------------------------------------
 void vtkF3DUSDImporter::ImportActors(vtkRenderer* renderer)
 {
+  F3D_TRACE_SCOPE_DETAIL("Import USD actors", this->GetFileName() ? this->GetFileName() : "stream");
+
   // Initialize the scene hierarchy
   this->SceneHierarchy = vtkSmartPointer<vtkDataAssembly>::New();
   this->SceneHierarchy->SetAttribute(vtkDataAssembly::GetRootNode(), "label", "root");
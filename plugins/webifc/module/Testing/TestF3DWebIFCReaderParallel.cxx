@@ -0,0 +1,69 @@
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkDataArray.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPolyData.h>
+#include <vtkSMPTools.h>
+#include <vtkTestUtilities.h>
+
+#include "vtkF3DWebIFCReader.h"
+
+#include <iostream>
+
+namespace
+{
+//----------------------------------------------------------------------------
+bool CompareArrays(vtkDataArray* a, vtkDataArray* b)
+{
+  if (!a || !b || a->GetNumberOfValues() != b->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfValues(); i++)
+  {
+    if (a->GetVariantValue(i) != b->GetVariantValue(i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkPolyData> Read(const std::string& filename)
+{
+  vtkNew<vtkF3DWebIFCReader> reader;
+  reader->SetFileName(filename);
+  reader->Update();
+  return reader->GetOutput();
+}
+}
+
+int TestF3DWebIFCReaderParallel(int vtkNotUsed(argc), char* argv[])
+{
+  std::string filename = std::string(argv[1]) + "data/IfcOpenHouse_IFC4.ifc";
+
+  vtkSmartPointer<vtkPolyData> parallel = ::Read(filename);
+
+  // Stitching geometries sequentially must give the exact same output
+  const std::string backend = vtkSMPTools::GetBackend();
+  vtkSMPTools::SetBackend("Sequential");
+  vtkSmartPointer<vtkPolyData> sequential = ::Read(filename);
+  vtkSMPTools::SetBackend(backend.c_str());
+
+  if (parallel->GetNumberOfPoints() == 0 ||
+    !::CompareArrays(parallel->GetPoints()->GetData(), sequential->GetPoints()->GetData()) ||
+    !::CompareArrays(parallel->GetPolys()->GetConnectivityArray(),
+      sequential->GetPolys()->GetConnectivityArray()) ||
+    !::CompareArrays(
+      parallel->GetPointData()->GetNormals(), sequential->GetPointData()->GetNormals()) ||
+    !::CompareArrays(
+      parallel->GetCellData()->GetScalars(), sequential->GetCellData()->GetScalars()))
+  {
+    std::cerr << "Parallel output differs from sequential output\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
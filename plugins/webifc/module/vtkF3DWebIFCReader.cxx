@@ -2,8 +2,9 @@
 
 #include <vtkCellArray.h>
 #include <vtkCellData.h>
-#include <vtkDoubleArray.h>
 #include <vtkFileResourceStream.h>
+#include <vtkFloatArray.h>
+#include <vtkIdTypeArray.h>
 #include <vtkInformation.h>
 #include <vtkNew.h>
 #include <vtkObjectFactory.h>
@@ -12,6 +13,7 @@
 #include <vtkPolyData.h>
 #include <vtkResourceParser.h>
 #include <vtkResourceStream.h>
+#include <vtkSMPTools.h>
 #include <vtkUnsignedCharArray.h>
 
 #include <web-ifc/modelmanager/ModelManager.h>
@@ -22,10 +24,33 @@
 #include <array>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 vtkStandardNewMacro(vtkF3DWebIFCReader);
 
+namespace
+{
+//----------------------------------------------------------------------------
+// Copy of a web-ifc geometry, shared by all its placements
+struct GeometryBuffers
+{
+  std::vector<double> Vertices; // interleaved positions and normals
+  std::vector<uint32_t> Indices;
+};
+
+//----------------------------------------------------------------------------
+// A geometry placed in the model, with its location in the output arrays
+struct PlacedGeometry
+{
+  const GeometryBuffers* Buffers = nullptr;
+  std::array<double, 16> Transform;
+  std::array<unsigned char, 4> Color;
+  vtkIdType PointOffset = 0;
+  vtkIdType TriangleOffset = 0;
+};
+}
+
 //----------------------------------------------------------------------------
 class vtkF3DWebIFCReader::vtkInternals
 {
@@ -161,14 +186,14 @@ int vtkF3DWebIFCReader::RequestData(
     const webifc::schema::IfcSchemaManager& schemaManager =
       this->Internals->Manager.GetSchemaManager();
 
-    vtkNew<vtkPoints> allPoints;
-    vtkNew<vtkCellArray> allPolys;
-    vtkNew<vtkDoubleArray> normals;
-    normals->SetNumberOfComponents(3);
-    normals->SetName("Normals");
-    vtkNew<vtkUnsignedCharArray> colors;
-    colors->SetNumberOfComponents(4);
-    colors->SetName("Colors");
+    // Phase one: web-ifc geometry generation is not thread safe, so element meshes are
+    // generated serially. Geometries are copied once, and each placed geometry records its
+    // point and triangle offsets in the output.
+    constexpr int vertexSize = 6;
+    std::unordered_map<uint32_t, ::GeometryBuffers> geometries;
+    std::vector<::PlacedGeometry> placedGeometries;
+    vtkIdType nbPoints = 0;
+    vtkIdType nbTriangles = 0;
 
     auto processElement = [&](uint32_t expressID)
     {
@@ -176,123 +201,38 @@ int vtkF3DWebIFCReader::RequestData(
 
       for (const auto& placedGeom : mesh.geometries)
       {
-        const auto& geometry = geometryProcessor->GetGeometry(placedGeom.geometryExpressID);
-
-        const auto& vertexData = geometry.vertexData;
-        const auto& indexData = geometry.indexData;
+        auto it = geometries.find(placedGeom.geometryExpressID);
+        if (it == geometries.end())
+        {
+          const auto& geometry = geometryProcessor->GetGeometry(placedGeom.geometryExpressID);
+          it = geometries
+                 .emplace(placedGeom.geometryExpressID,
+                   ::GeometryBuffers{
+                     std::vector<double>(geometry.vertexData.begin(), geometry.vertexData.end()),
+                     std::vector<uint32_t>(geometry.indexData.begin(), geometry.indexData.end()) })
+                 .first;
+        }
 
-        if (vertexData.empty() || indexData.empty())
+        const ::GeometryBuffers& buffers = it->second;
+        if (buffers.Vertices.empty() || buffers.Indices.empty())
         {
           continue;
         }
 
-        const auto& transform = placedGeom.flatTransformation;
-        std::array<unsigned char, 4> color = { static_cast<unsigned char>(placedGeom.color.r * 255),
+        ::PlacedGeometry placed;
+        placed.Buffers = &buffers;
+        std::copy(placedGeom.flatTransformation.begin(), placedGeom.flatTransformation.end(),
+          placed.Transform.begin());
+        placed.Color = { static_cast<unsigned char>(placedGeom.color.r * 255),
           static_cast<unsigned char>(placedGeom.color.g * 255),
           static_cast<unsigned char>(placedGeom.color.b * 255),
           static_cast<unsigned char>(placedGeom.color.a * 255) };
+        placed.PointOffset = nbPoints;
+        placed.TriangleOffset = nbTriangles;
+        placedGeometries.push_back(placed);
 
-        vtkIdType pointOffset = allPoints->GetNumberOfPoints();
-        constexpr int vertexSize = 6;
-
-#ifdef __linux__
-        // WORKAROUND: web-ifc produces inconsistent triangle winding order on Linux.
-        // Vertex normals are correct, so compare with geometric normal to fix winding.
-        // Once https://github.com/ThatOpen/engine_web-ifc/issues/1811 is fixed,
-        // remove this #ifdef __linux__ block and keep only the #else branch.
-        std::vector<std::array<double, 3>> localPositions;
-        std::vector<std::array<double, 3>> localNormals;
-        localPositions.reserve(vertexData.size() / vertexSize);
-        localNormals.reserve(vertexData.size() / vertexSize);
-
-        for (size_t i = 0; i < vertexData.size(); i += vertexSize)
-        {
-          double x = vertexData[i];
-          double y = vertexData[i + 1];
-          double z = vertexData[i + 2];
-          double nx = vertexData[i + 3];
-          double ny = vertexData[i + 4];
-          double nz = vertexData[i + 5];
-
-          double tx = transform[0] * x + transform[4] * y + transform[8] * z + transform[12];
-          double ty = transform[1] * x + transform[5] * y + transform[9] * z + transform[13];
-          double tz = transform[2] * x + transform[6] * y + transform[10] * z + transform[14];
-
-          double tnx = transform[0] * nx + transform[4] * ny + transform[8] * nz;
-          double tny = transform[1] * nx + transform[5] * ny + transform[9] * nz;
-          double tnz = transform[2] * nx + transform[6] * ny + transform[10] * nz;
-
-          localPositions.push_back({ tx, ty, tz });
-          localNormals.push_back({ tnx, tny, tnz });
-          allPoints->InsertNextPoint(tx, ty, tz);
-          normals->InsertNextTuple3(tnx, tny, tnz);
-        }
-
-        for (size_t i = 0; i < indexData.size(); i += 3)
-        {
-          uint32_t i0 = indexData[i];
-          uint32_t i1 = indexData[i + 1];
-          uint32_t i2 = indexData[i + 2];
-
-          const auto& p0 = localPositions[i0];
-          const auto& p1 = localPositions[i1];
-          const auto& p2 = localPositions[i2];
-
-          double e1x = p1[0] - p0[0], e1y = p1[1] - p0[1], e1z = p1[2] - p0[2];
-          double e2x = p2[0] - p0[0], e2y = p2[1] - p0[1], e2z = p2[2] - p0[2];
-          double gnx = e1y * e2z - e1z * e2y;
-          double gny = e1z * e2x - e1x * e2z;
-          double gnz = e1x * e2y - e1y * e2x;
-
-          const auto& n0 = localNormals[i0];
-          const auto& n1 = localNormals[i1];
-          const auto& n2 = localNormals[i2];
-          double avgNx = n0[0] + n1[0] + n2[0];
-          double avgNy = n0[1] + n1[1] + n2[1];
-          double avgNz = n0[2] + n1[2] + n2[2];
-
-          bool windingIsWrong = (gnx * avgNx + gny * avgNy + gnz * avgNz) < 0;
-          if (windingIsWrong)
-          {
-            std::swap(i1, i2);
-          }
-
-          vtkIdType pts[3] = { static_cast<vtkIdType>(i0) + pointOffset,
-            static_cast<vtkIdType>(i1) + pointOffset, static_cast<vtkIdType>(i2) + pointOffset };
-          allPolys->InsertNextCell(3, pts);
-          colors->InsertNextTypedTuple(color.data());
-        }
-#else
-        for (size_t i = 0; i < vertexData.size(); i += vertexSize)
-        {
-          double x = vertexData[i];
-          double y = vertexData[i + 1];
-          double z = vertexData[i + 2];
-          double nx = vertexData[i + 3];
-          double ny = vertexData[i + 4];
-          double nz = vertexData[i + 5];
-
-          double tx = transform[0] * x + transform[4] * y + transform[8] * z + transform[12];
-          double ty = transform[1] * x + transform[5] * y + transform[9] * z + transform[13];
-          double tz = transform[2] * x + transform[6] * y + transform[10] * z + transform[14];
-
-          double tnx = transform[0] * nx + transform[4] * ny + transform[8] * nz;
-          double tny = transform[1] * nx + transform[5] * ny + transform[9] * nz;
-          double tnz = transform[2] * nx + transform[6] * ny + transform[10] * nz;
-
-          allPoints->InsertNextPoint(tx, ty, tz);
-          normals->InsertNextTuple3(tnx, tny, tnz);
-        }
-
-        for (size_t i = 0; i < indexData.size(); i += 3)
-        {
-          vtkIdType pts[3] = { static_cast<vtkIdType>(indexData[i]) + pointOffset,
-            static_cast<vtkIdType>(indexData[i + 1]) + pointOffset,
-            static_cast<vtkIdType>(indexData[i + 2]) + pointOffset };
-          allPolys->InsertNextCell(3, pts);
-          colors->InsertNextTypedTuple(color.data());
-        }
-#endif
+        nbPoints += static_cast<vtkIdType>(buffers.Vertices.size() / vertexSize);
+        nbTriangles += static_cast<vtkIdType>(buffers.Indices.size() / 3);
       }
     };
 
@@ -318,6 +258,138 @@ int vtkF3DWebIFCReader::RequestData(
       }
     }
 
+    // Phase two: transform and stitch placed geometries concurrently into preallocated arrays,
+    // at the offsets computed above so that the output does not depend on scheduling
+    vtkNew<vtkFloatArray> positionArray;
+    positionArray->SetNumberOfComponents(3);
+    positionArray->SetNumberOfTuples(nbPoints);
+    vtkNew<vtkFloatArray> normals;
+    normals->SetNumberOfComponents(3);
+    normals->SetNumberOfTuples(nbPoints);
+    normals->SetName("Normals");
+    vtkNew<vtkUnsignedCharArray> colors;
+    colors->SetNumberOfComponents(4);
+    colors->SetNumberOfTuples(nbTriangles);
+    colors->SetName("Colors");
+    vtkNew<vtkIdTypeArray> offsets;
+    offsets->SetNumberOfTuples(nbTriangles + 1);
+    vtkNew<vtkIdTypeArray> connectivity;
+    connectivity->SetNumberOfTuples(3 * nbTriangles);
+
+    float* positionPtr = positionArray->GetPointer(0);
+    float* normalPtr = normals->GetPointer(0);
+    unsigned char* colorPtr = colors->GetPointer(0);
+    vtkIdType* offsetPtr = offsets->GetPointer(0);
+    vtkIdType* connectivityPtr = connectivity->GetPointer(0);
+
+    vtkSMPTools::For(0, nbTriangles + 1,
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType i = begin; i < end; i++)
+        {
+          offsetPtr[i] = 3 * i;
+        }
+      });
+
+    vtkSMPTools::For(0, static_cast<vtkIdType>(placedGeometries.size()),
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType g = begin; g < end; g++)
+        {
+          const ::PlacedGeometry& placed = placedGeometries[g];
+          const std::vector<double>& vertexData = placed.Buffers->Vertices;
+          const std::vector<uint32_t>& indexData = placed.Buffers->Indices;
+          const std::array<double, 16>& transform = placed.Transform;
+          const vtkIdType pointOffset = placed.PointOffset;
+
+#ifdef __linux__
+          // WORKAROUND: web-ifc produces inconsistent triangle winding order on Linux.
+          // Vertex normals are correct, so compare with geometric normal to fix winding.
+          // Once https://github.com/ThatOpen/engine_web-ifc/issues/1811 is fixed,
+          // remove the #ifdef __linux__ blocks below.
+          std::vector<std::array<double, 3>> localPositions;
+          std::vector<std::array<double, 3>> localNormals;
+          localPositions.reserve(vertexData.size() / vertexSize);
+          localNormals.reserve(vertexData.size() / vertexSize);
+#endif
+
+          float* position = positionPtr + 3 * pointOffset;
+          float* normal = normalPtr + 3 * pointOffset;
+          for (size_t i = 0; i < vertexData.size(); i += vertexSize)
+          {
+            double x = vertexData[i];
+            double y = vertexData[i + 1];
+            double z = vertexData[i + 2];
+            double nx = vertexData[i + 3];
+            double ny = vertexData[i + 4];
+            double nz = vertexData[i + 5];
+
+            double tx = transform[0] * x + transform[4] * y + transform[8] * z + transform[12];
+            double ty = transform[1] * x + transform[5] * y + transform[9] * z + transform[13];
+            double tz = transform[2] * x + transform[6] * y + transform[10] * z + transform[14];
+
+            double tnx = transform[0] * nx + transform[4] * ny + transform[8] * nz;
+            double tny = transform[1] * nx + transform[5] * ny + transform[9] * nz;
+            double tnz = transform[2] * nx + transform[6] * ny + transform[10] * nz;
+
+#ifdef __linux__
+            localPositions.push_back({ tx, ty, tz });
+            localNormals.push_back({ tnx, tny, tnz });
+#endif
+            *position++ = static_cast<float>(tx);
+            *position++ = static_cast<float>(ty);
+            *position++ = static_cast<float>(tz);
+            *normal++ = static_cast<float>(tnx);
+            *normal++ = static_cast<float>(tny);
+            *normal++ = static_cast<float>(tnz);
+          }
+
+          vtkIdType* cell = connectivityPtr + 3 * placed.TriangleOffset;
+          unsigned char* color = colorPtr + 4 * placed.TriangleOffset;
+          for (size_t i = 0; i < indexData.size(); i += 3)
+          {
+            uint32_t i0 = indexData[i];
+            uint32_t i1 = indexData[i + 1];
+            uint32_t i2 = indexData[i + 2];
+
+#ifdef __linux__
+            const auto& p0 = localPositions[i0];
+            const auto& p1 = localPositions[i1];
+            const auto& p2 = localPositions[i2];
+
+            double e1x = p1[0] - p0[0], e1y = p1[1] - p0[1], e1z = p1[2] - p0[2];
+            double e2x = p2[0] - p0[0], e2y = p2[1] - p0[1], e2z = p2[2] - p0[2];
+            double gnx = e1y * e2z - e1z * e2y;
+            double gny = e1z * e2x - e1x * e2z;
+            double gnz = e1x * e2y - e1y * e2x;
+
+            const auto& n0 = localNormals[i0];
+            const auto& n1 = localNormals[i1];
+            const auto& n2 = localNormals[i2];
+            double avgNx = n0[0] + n1[0] + n2[0];
+            double avgNy = n0[1] + n1[1] + n2[1];
+            double avgNz = n0[2] + n1[2] + n2[2];
+
+            bool windingIsWrong = (gnx * avgNx + gny * avgNy + gnz * avgNz) < 0;
+            if (windingIsWrong)
+            {
+              std::swap(i1, i2);
+            }
+#endif
+
+            *cell++ = static_cast<vtkIdType>(i0) + pointOffset;
+            *cell++ = static_cast<vtkIdType>(i1) + pointOffset;
+            *cell++ = static_cast<vtkIdType>(i2) + pointOffset;
+            color = std::copy(placed.Color.begin(), placed.Color.end(), color);
+          }
+        }
+      });
+
+    vtkNew<vtkPoints> allPoints;
+    allPoints->SetData(positionArray);
+    vtkNew<vtkCellArray> allPolys;
+    allPolys->SetData(offsets, connectivity);
+
     output->SetPoints(allPoints);
     output->SetPolys(allPolys);
     output->GetPointData()->SetNormals(normals);
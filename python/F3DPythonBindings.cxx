@@ -200,7 +200,7 @@ PYBIND11_MODULE(pyf3d, module)
     .def_property_readonly("channel_type", &f3d::image::getChannelType)
     .def_property_readonly("channel_type_size", &f3d::image::getChannelTypeSize)
     .def_property("content", getImageBytes, setImageBytes)
-    .def("compare", &f3d::image::compare)
+    .def("compare", &f3d::image::compare, py::arg("reference"), py::arg("diff") = nullptr)
     .def(
       "save", &f3d::image::save, py::arg("path"), py::arg("format") = f3d::image::SaveFormat::PNG)
     .def("save_buffer", getFileBytes, py::arg("format") = f3d::image::SaveFormat::PNG)
@@ -301,6 +301,7 @@ PYBIND11_MODULE(pyf3d, module)
     .def("keys", &f3d::options::getNames) // to do `dict(options)`
     .def("toggle", &f3d::options::toggle)
     .def("is_same", &f3d::options::isSame)
+    .def("get_changed_names", &f3d::options::getChangedNames)
     .def("has_value", &f3d::options::hasValue)
     .def("copy", &f3d::options::copy)
     .def_static("get_all_names", &f3d::options::getAllNames)
@@ -747,6 +748,24 @@ PYBIND11_MODULE(pyf3d, module)
 
   // f3d::scene
   py::class_<f3d::scene, std::unique_ptr<f3d::scene, py::nodelete>> scene(module, "Scene");
+
+  py::enum_<f3d::scene::LoadStatus>(scene, "LoadStatus")
+    .value("LOADING", f3d::scene::LoadStatus::LOADING)
+    .value("LOADED", f3d::scene::LoadStatus::LOADED)
+    .value("FAILED", f3d::scene::LoadStatus::FAILED)
+    .value("CANCELED", f3d::scene::LoadStatus::CANCELED)
+    .export_values();
+
+  py::class_<f3d::scene::load_handle>(scene, "LoadHandle")
+    .def("get_status", &f3d::scene::load_handle::getStatus,
+      "Get the status of the load without blocking")
+    .def("wait", &f3d::scene::load_handle::wait, "Block until the load is finished")
+    .def("get_progress", &f3d::scene::load_handle::getProgress,
+      "Get the progress of the load, between 0 and 1")
+    .def("cancel", &f3d::scene::load_handle::cancel, "Request the cancellation of the load")
+    .def("get_error", &f3d::scene::load_handle::getError,
+      "Get the error message of a failed load");
+
   scene //
     .def("supports", &f3d::scene::supports)
     .def("clear", &f3d::scene::clear)
@@ -756,6 +775,13 @@ PYBIND11_MODULE(pyf3d, module)
       "Add multiple filepaths to the scene", py::arg("file_path_vector"))
     .def("add", py::overload_cast<const std::vector<std::string>&>(&f3d::scene::add),
       "Add multiple filenames to the scene", py::arg("file_name_vector"))
+    .def("add_async",
+      py::overload_cast<const std::filesystem::path&>(&f3d::scene::addAsync),
+      "Start loading a file into the scene asynchronously", py::arg("file_path"))
+    .def("add_async",
+      py::overload_cast<const std::vector<std::filesystem::path>&>(&f3d::scene::addAsync),
+      "Start loading multiple filepaths into the scene asynchronously",
+      py::arg("file_path_vector"))
     .def("add", py::overload_cast<const f3d::mesh_t&>(&f3d::scene::add),
       "Add a surfacic mesh from memory into the scene", py::arg("mesh"))
     .def("add", py::overload_cast<std::shared_ptr<f3d::mesh_view>>(&f3d::scene::add),
@@ -869,7 +895,41 @@ PYBIND11_MODULE(pyf3d, module)
     .def("get_world_from_display", &f3d::window::getWorldFromDisplay,
       "Get world coordinate point from display coordinate")
     .def("get_display_from_world", &f3d::window::getDisplayFromWorld,
-      "Get display coordinate point from world coordinate");
+      "Get display coordinate point from world coordinate")
+    .def("pick", &f3d::window::pick,
+      "Pick the scene at a display position and return the picked position and actor name",
+      py::arg("x"), py::arg("y"))
+    .def("get_frame_stats", &f3d::window::getFrameStats,
+      "Get the rendering times of the most recent frame whose GPU times are available")
+    .def("begin_capture", &f3d::window::beginCapture,
+      "Start a streaming capture of the rendered frames", py::arg("no_background") = false,
+      py::arg("buffer_count") = 3, py::return_value_policy::reference)
+    .def("acquire_frame", py::overload_cast<f3d::image&>(&f3d::window::acquireFrame),
+      "Render a frame and provide the oldest captured frame into the image if available",
+      py::arg("frame"))
+    .def("flush_frame", py::overload_cast<f3d::image&>(&f3d::window::flushFrame),
+      "Provide the oldest remaining captured frame into the image without rendering",
+      py::arg("frame"))
+    .def("end_capture", &f3d::window::endCapture, "End the capture",
+      py::return_value_policy::reference);
+
+  py::class_<f3d::window::pick_result_t>(window, "PickResult")
+    .def_readonly("picked", &f3d::window::pick_result_t::picked)
+    .def_readonly("position", &f3d::window::pick_result_t::position)
+    .def_readonly("name", &f3d::window::pick_result_t::name)
+    .def_readonly("accelerated", &f3d::window::pick_result_t::accelerated);
+
+  py::class_<f3d::window::pass_stats_t>(window, "PassStats")
+    .def_readonly("name", &f3d::window::pass_stats_t::name)
+    .def_readonly("depth", &f3d::window::pass_stats_t::depth)
+    .def_readonly("cpu_time", &f3d::window::pass_stats_t::cpu_time)
+    .def_readonly("gpu_time", &f3d::window::pass_stats_t::gpu_time);
+
+  py::class_<f3d::window::frame_stats_t>(window, "FrameStats")
+    .def_readonly("frame", &f3d::window::frame_stats_t::frame)
+    .def_readonly("cpu_time", &f3d::window::frame_stats_t::cpu_time)
+    .def_readonly("gpu_time", &f3d::window::frame_stats_t::gpu_time)
+    .def_readonly("passes", &f3d::window::frame_stats_t::passes);
 
   // libInformation
   py::class_<f3d::engine::libInformation>(module, "LibInformation")
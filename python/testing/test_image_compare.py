@@ -23,3 +23,18 @@ def test_compare_with_file():
     img.save(output)
 
     assert img.compare(f3d.Image(reference)) <= 0.05
+
+
+def test_compare_with_diff():
+    gray = f3d.Image(32, 32, 3, f3d.Image.ChannelType.BYTE)
+    gray.content = bytes([128] * 32 * 32 * 3)
+    black = f3d.Image(32, 32, 3, f3d.Image.ChannelType.BYTE)
+    black.content = bytes(32 * 32 * 3)
+
+    diff = f3d.Image()
+    assert gray.compare(black, diff) > 0
+    assert diff.width == 32 and diff.height == 32 and diff.channel_count == 3
+    assert all(v > 0.98 for v in diff.normalized_pixel((16, 16)))
+
+    assert gray.compare(gray, diff) == 0
+    assert diff.normalized_pixel((16, 16)) == [0, 0, 0]
@@ -169,6 +169,14 @@ def test_is_same():
     assert not options2.is_same(options1, "ui.axis")
 
 
+def test_get_changed_names():
+    options1 = f3d.Options()
+    options2 = f3d.Options()
+    assert options1.get_changed_names(options2) == []
+    options2["ui.axis"] = True
+    assert options1.get_changed_names(options2) == ["ui.axis"]
+
+
 def test_has_value():
     options = f3d.Options()
     assert not options.has_value("scene.camera.index")
@@ -87,3 +87,22 @@ def test_scene():
     img.save(output)
 
     assert img.compare(f3d.Image(reference_red_light)) < 0.05
+
+
+def test_scene_async():
+    testing_dir = Path(__file__).parent.parent.parent / "testing"
+    cow = testing_dir / "data/cow.vtp"
+    suzanne = testing_dir / "data/suzanne.obj"
+
+    engine = f3d.Engine.create(True)
+
+    handle = engine.scene.add_async([cow, suzanne])
+    assert handle.wait() == f3d.Scene.LoadStatus.LOADED
+    assert handle.get_status() == f3d.Scene.LoadStatus.LOADED
+    assert handle.get_progress() == 1.0
+    assert handle.get_error() == ""
+
+    engine.scene.clear()
+    handle = engine.scene.add_async(cow)
+    handle.cancel()
+    assert handle.wait() == f3d.Scene.LoadStatus.CANCELED
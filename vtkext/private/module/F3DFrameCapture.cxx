@@ -0,0 +1,226 @@
+#include "F3DFrameCapture.h"
+
+#include <vtkOpenGLRenderWindow.h>
+#include <vtkRect.h>
+#include <vtk_glad.h>
+
+#include <algorithm>
+#include <cstring>
+
+// WebGL does not support mapping buffers
+#if !defined(__EMSCRIPTEN__)
+#define F3D_FRAME_CAPTURE_PBO 1
+#else
+#define F3D_FRAME_CAPTURE_PBO 0
+#endif
+
+//----------------------------------------------------------------------------
+F3DFrameCapture::~F3DFrameCapture()
+{
+  this->Stop();
+}
+
+//----------------------------------------------------------------------------
+void F3DFrameCapture::Start(vtkOpenGLRenderWindow* renWin, size_t bufferCount, bool alpha)
+{
+  this->Stop();
+
+  this->RenderWindow = renWin;
+  this->Slots.resize(std::max<size_t>(1, bufferCount));
+  this->Alpha = alpha;
+  this->UsePBOChecked = false;
+}
+
+//----------------------------------------------------------------------------
+void F3DFrameCapture::Stop()
+{
+  for (Slot& slot : this->Slots)
+  {
+    this->ReleaseSlot(slot);
+  }
+  this->Slots.clear();
+  this->First = 0;
+  this->Count = 0;
+  this->RenderWindow = nullptr;
+}
+
+//----------------------------------------------------------------------------
+bool F3DFrameCapture::IsStarted() const
+{
+  return this->RenderWindow != nullptr;
+}
+
+//----------------------------------------------------------------------------
+bool F3DFrameCapture::Queue()
+{
+  if (!this->IsStarted() || this->IsFull())
+  {
+    return false;
+  }
+
+  Slot& slot = this->Slots[(this->First + this->Count) % this->Slots.size()];
+  const int* size = this->RenderWindow->GetSize();
+  slot.Width = size[0];
+  slot.Height = size[1];
+  const size_t frameSize = this->GetFrameSize(slot);
+
+  const vtkRecti rect(0, 0, slot.Width, slot.Height);
+  const int format = this->Alpha ? GL_RGBA : GL_RGB;
+
+#if F3D_FRAME_CAPTURE_PBO
+  // checked once the context is created, pixel buffer objects and fences
+  // require OpenGL 3.2 or OpenGL ES 3.0
+  if (!this->UsePBOChecked)
+  {
+    this->UsePBO = glMapBufferRange != nullptr && glFenceSync != nullptr;
+    this->UsePBOChecked = true;
+  }
+
+  if (this->UsePBO)
+  {
+    if (slot.Buffer == 0)
+    {
+      glGenBuffers(1, &slot.Buffer);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.Buffer);
+
+    // buffers only grow so that they are not reallocated when the size alternates
+    if (slot.Capacity < frameSize)
+    {
+      glBufferData(GL_PIXEL_PACK_BUFFER, frameSize, nullptr, GL_STREAM_READ);
+      slot.Capacity = frameSize;
+    }
+
+    // with a pixel pack buffer bound, the pixels are copied into it without waiting for the GPU
+    const int ret = this->RenderWindow->ReadPixels(rect, 1, format, GL_UNSIGNED_BYTE, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    if (ret == 0)
+    {
+      return false;
+    }
+
+    if (slot.Fence)
+    {
+      glDeleteSync(static_cast<GLsync>(slot.Fence));
+    }
+    slot.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+
+    this->Count++;
+    return true;
+  }
+#endif
+
+  slot.Pixels.resize(frameSize);
+  if (this->RenderWindow->ReadPixels(rect, 1, format, GL_UNSIGNED_BYTE, slot.Pixels.data()) == 0)
+  {
+    return false;
+  }
+  this->Count++;
+  return true;
+}
+
+//----------------------------------------------------------------------------
+size_t F3DFrameCapture::GetNumberOfPendingFrames() const
+{
+  return this->Count;
+}
+
+//----------------------------------------------------------------------------
+bool F3DFrameCapture::IsFull() const
+{
+  return this->Count >= this->Slots.size();
+}
+
+//----------------------------------------------------------------------------
+int F3DFrameCapture::GetPendingFrameWidth() const
+{
+  return this->Count > 0 ? this->Slots[this->First].Width : 0;
+}
+
+//----------------------------------------------------------------------------
+int F3DFrameCapture::GetPendingFrameHeight() const
+{
+  return this->Count > 0 ? this->Slots[this->First].Height : 0;
+}
+
+//----------------------------------------------------------------------------
+int F3DFrameCapture::GetNumberOfComponents() const
+{
+  return this->Alpha ? 4 : 3;
+}
+
+//----------------------------------------------------------------------------
+bool F3DFrameCapture::Acquire(void* buffer)
+{
+  if (this->Count == 0)
+  {
+    return false;
+  }
+
+  Slot& slot = this->Slots[this->First];
+  const size_t frameSize = this->GetFrameSize(slot);
+  bool success = true;
+
+#if F3D_FRAME_CAPTURE_PBO
+  if (this->UsePBO)
+  {
+    // the frame was queued a few frames ago so its copy has usually completed already
+    if (slot.Fence)
+    {
+      GLsync fence = static_cast<GLsync>(slot.Fence);
+      GLenum status = GL_TIMEOUT_EXPIRED;
+      while (status == GL_TIMEOUT_EXPIRED)
+      {
+        status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+      }
+      glDeleteSync(fence);
+      slot.Fence = nullptr;
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.Buffer);
+    const void* pixels = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, frameSize, GL_MAP_READ_BIT);
+    if (pixels)
+    {
+      std::memcpy(buffer, pixels, frameSize);
+      glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    else
+    {
+      success = false;
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  }
+  else
+#endif
+  {
+    std::memcpy(buffer, slot.Pixels.data(), frameSize);
+  }
+
+  this->First = (this->First + 1) % this->Slots.size();
+  this->Count--;
+  return success;
+}
+
+//----------------------------------------------------------------------------
+size_t F3DFrameCapture::GetFrameSize(const Slot& slot) const
+{
+  return static_cast<size_t>(slot.Width) * static_cast<size_t>(slot.Height) *
+    static_cast<size_t>(this->GetNumberOfComponents());
+}
+
+//----------------------------------------------------------------------------
+void F3DFrameCapture::ReleaseSlot(Slot& slot)
+{
+#if F3D_FRAME_CAPTURE_PBO
+  if (slot.Fence)
+  {
+    glDeleteSync(static_cast<GLsync>(slot.Fence));
+  }
+  if (slot.Buffer != 0)
+  {
+    glDeleteBuffers(1, &slot.Buffer);
+  }
+#endif
+  slot = Slot();
+}
@@ -0,0 +1,101 @@
+/**
+ * @class F3DFrameCapture
+ * @brief A streaming readback of rendered frames using a ring of pixel buffer objects
+ *
+ * Read back the frames rendered in a window asynchronously: queuing a frame starts copying
+ * its pixels into a pixel buffer object, and the copy is only waited for when the frame
+ * is acquired, usually a few frames later, so that the readback of a frame overlaps
+ * the rendering of the next ones. Pixel buffers are reused from one frame to the next.
+ * When pixel buffer objects are not supported, like on WebAssembly,
+ * frames are read synchronously into a ring of CPU buffers instead.
+ * Frames are 8-bit RGB or RGBA images with the origin at the lower left corner.
+ * All methods must be called with the OpenGL context of the window current.
+ */
+#ifndef F3DFrameCapture_h
+#define F3DFrameCapture_h
+
+#include <cstddef>
+#include <vector>
+
+class vtkOpenGLRenderWindow;
+
+class F3DFrameCapture
+{
+public:
+  ~F3DFrameCapture();
+
+  /**
+   * Start a capture with the provided number of frames in flight.
+   * Any previous capture is stopped first.
+   */
+  void Start(vtkOpenGLRenderWindow* renWin, size_t bufferCount, bool alpha);
+
+  /**
+   * Stop the capture, discarding the pending frames and releasing the buffers
+   */
+  void Stop();
+
+  /**
+   * Return true if a capture is started
+   */
+  bool IsStarted() const;
+
+  /**
+   * Start reading back the last frame rendered in the window.
+   * The ring must not be full, acquire a frame first if needed.
+   * Return false on failure.
+   */
+  bool Queue();
+
+  /**
+   * Number of frames queued and not acquired yet
+   */
+  size_t GetNumberOfPendingFrames() const;
+
+  /**
+   * Return true if no frame can be queued before one is acquired
+   */
+  bool IsFull() const;
+
+  /**
+   * Get the size of the oldest pending frame, 0 if there is no pending frame
+   */
+  int GetPendingFrameWidth() const;
+  int GetPendingFrameHeight() const;
+
+  /**
+   * Number of channels of the captured frames, 3 or 4
+   */
+  int GetNumberOfComponents() const;
+
+  /**
+   * Copy the oldest pending frame into the provided buffer, waiting for its readback
+   * to complete, and remove it from the ring. The buffer must be large enough to hold
+   * width * height * components bytes. Return false if there is no pending frame.
+   */
+  bool Acquire(void* buffer);
+
+private:
+  struct Slot
+  {
+    unsigned int Buffer = 0;
+    void* Fence = nullptr;
+    size_t Capacity = 0;
+    int Width = 0;
+    int Height = 0;
+    std::vector<unsigned char> Pixels;
+  };
+
+  size_t GetFrameSize(const Slot& slot) const;
+  void ReleaseSlot(Slot& slot);
+
+  vtkOpenGLRenderWindow* RenderWindow = nullptr;
+  std::vector<Slot> Slots;
+  size_t First = 0;
+  size_t Count = 0;
+  bool Alpha = false;
+  bool UsePBO = false;
+  bool UsePBOChecked = false;
+};
+
+#endif
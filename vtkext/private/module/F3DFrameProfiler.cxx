@@ -0,0 +1,265 @@
+#include "F3DFrameProfiler.h"
+
+#include <vtk_glad.h>
+
+#include <algorithm>
+
+#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+#define F3D_FRAME_PROFILER_GPU 1
+#else
+#define F3D_FRAME_PROFILER_GPU 0
+#endif
+
+//----------------------------------------------------------------------------
+void F3DFrameProfiler::BeginFrame()
+{
+  if (this->Recording)
+  {
+    this->EndFrame();
+  }
+
+  // reuse the oldest frame of the ring, dropping it if it has not been resolved yet
+  this->Current = (this->Current + 1) % RingSize;
+  Frame& frame = this->Frames[this->Current];
+  frame.Index = ++this->FrameCounter;
+  frame.Pending = false;
+  frame.Scopes.clear();
+  frame.UsedQueries = 0;
+
+  this->Recording = true;
+  this->Stack.clear();
+
+#if F3D_FRAME_PROFILER_GPU
+  // timestamp queries require OpenGL 3.3 or ARB_timer_query
+  this->UseGPU = glQueryCounter != nullptr && glGetQueryObjectui64v != nullptr;
+#endif
+
+  Scope& root = frame.Scopes.emplace_back();
+  root.Name = "Frame";
+  root.CPUBegin = Clock::now();
+  root.BeginQuery = this->RecordTimestamp(frame);
+  this->Stack.emplace_back(0);
+}
+
+//----------------------------------------------------------------------------
+void F3DFrameProfiler::EndFrame()
+{
+  if (!this->Recording)
+  {
+    return;
+  }
+
+  // close the passes that were not ended
+  while (this->Stack.size() > 1)
+  {
+    this->EndPass();
+  }
+
+  Frame& frame = this->Frames[this->Current];
+  Scope& root = frame.Scopes.front();
+  root.EndQuery = this->RecordTimestamp(frame);
+  root.CPUEnd = Clock::now();
+
+  this->Stack.clear();
+  this->Recording = false;
+  frame.Pending = true;
+
+  this->Resolve();
+}
+
+//----------------------------------------------------------------------------
+void F3DFrameProfiler::BeginPass(const std::string& name)
+{
+  if (!this->Recording)
+  {
+    return;
+  }
+
+  Frame& frame = this->Frames[this->Current];
+  Scope scope;
+  scope.Name = name;
+  scope.Depth = static_cast<unsigned int>(this->Stack.size());
+  scope.Parent = this->Stack.back();
+  scope.CPUBegin = Clock::now();
+  scope.BeginQuery = this->RecordTimestamp(frame);
+
+  this->Stack.emplace_back(frame.Scopes.size());
+  frame.Scopes.emplace_back(std::move(scope));
+}
+
+//----------------------------------------------------------------------------
+void F3DFrameProfiler::EndPass()
+{
+  // the root scope is ended by EndFrame
+  if (!this->Recording || this->Stack.size() <= 1)
+  {
+    return;
+  }
+
+  Frame& frame = this->Frames[this->Current];
+  Scope& scope = frame.Scopes[this->Stack.back()];
+  scope.EndQuery = this->RecordTimestamp(frame);
+  scope.CPUEnd = Clock::now();
+  this->Stack.pop_back();
+}
+
+//----------------------------------------------------------------------------
+void F3DFrameProfiler::Resolve()
+{
+  // from the oldest to the most recent frame
+  for (size_t i = 1; i <= RingSize; i++)
+  {
+    const size_t index = (this->Current + i) % RingSize;
+    if (this->Recording && index == this->Current)
+    {
+      continue;
+    }
+
+    Frame& frame = this->Frames[index];
+    if (frame.Pending && this->IsAvailable(frame))
+    {
+      this->ResolveFrame(frame);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+const F3DFrameProfiler::FrameStats& F3DFrameProfiler::GetLatestStats() const
+{
+  return this->LatestStats;
+}
+
+//----------------------------------------------------------------------------
+void F3DFrameProfiler::ReleaseGraphicsResources()
+{
+  for (Frame& frame : this->Frames)
+  {
+#if F3D_FRAME_PROFILER_GPU
+    if (!frame.Queries.empty())
+    {
+      glDeleteQueries(static_cast<GLsizei>(frame.Queries.size()), frame.Queries.data());
+    }
+#endif
+    frame.Queries.clear();
+    frame.UsedQueries = 0;
+    frame.Pending = false;
+  }
+  this->Recording = false;
+  this->Stack.clear();
+}
+
+//----------------------------------------------------------------------------
+size_t F3DFrameProfiler::RecordTimestamp([[maybe_unused]] Frame& frame)
+{
+#if F3D_FRAME_PROFILER_GPU
+  if (!this->UseGPU)
+  {
+    return 0;
+  }
+
+  if (frame.UsedQueries == frame.Queries.size())
+  {
+    unsigned int query = 0;
+    glGenQueries(1, &query);
+    frame.Queries.emplace_back(query);
+  }
+
+  glQueryCounter(frame.Queries[frame.UsedQueries], GL_TIMESTAMP);
+  return frame.UsedQueries++;
+#else
+  return 0;
+#endif
+}
+
+//----------------------------------------------------------------------------
+bool F3DFrameProfiler::IsAvailable([[maybe_unused]] const Frame& frame) const
+{
+#if F3D_FRAME_PROFILER_GPU
+  // queries complete in order, the last one is enough
+  if (frame.UsedQueries == 0)
+  {
+    return true;
+  }
+  GLint available = 0;
+  glGetQueryObjectiv(frame.Queries[frame.UsedQueries - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+  return available != 0;
+#else
+  return true;
+#endif
+}
+
+//----------------------------------------------------------------------------
+void F3DFrameProfiler::ResolveFrame(Frame& frame)
+{
+  frame.Pending = false;
+  if (frame.Index <= this->LatestStats.Frame)
+  {
+    return;
+  }
+
+  std::vector<uint64_t> timestamps(frame.UsedQueries, 0);
+#if F3D_FRAME_PROFILER_GPU
+  for (size_t i = 0; i < frame.UsedQueries; i++)
+  {
+    GLuint64 timestamp = 0;
+    glGetQueryObjectui64v(frame.Queries[i], GL_QUERY_RESULT, &timestamp);
+    timestamps[i] = timestamp;
+  }
+#endif
+  const bool useGPU = !timestamps.empty();
+
+  // inclusive times of each scope
+  const size_t nbScopes = frame.Scopes.size();
+  std::vector<double> cpuTimes(nbScopes);
+  std::vector<double> gpuTimes(nbScopes, -1.0);
+  for (size_t i = 0; i < nbScopes; i++)
+  {
+    const Scope& scope = frame.Scopes[i];
+    cpuTimes[i] = std::chrono::duration<double>(scope.CPUEnd - scope.CPUBegin).count();
+    if (useGPU)
+    {
+      gpuTimes[i] = (static_cast<double>(timestamps[scope.EndQuery]) -
+                      static_cast<double>(timestamps[scope.BeginQuery])) *
+        1e-9;
+    }
+  }
+
+  FrameStats& stats = this->LatestStats;
+  stats.Frame = frame.Index;
+  stats.CPUTime = cpuTimes.front();
+  stats.GPUTime = gpuTimes.front();
+  stats.Passes.clear();
+
+  // remove the times of the children so that times are exclusive
+  std::vector<double> cpuSelfTimes = cpuTimes;
+  std::vector<double> gpuSelfTimes = gpuTimes;
+  for (size_t i = 1; i < nbScopes; i++)
+  {
+    const size_t parent = frame.Scopes[i].Parent;
+    cpuSelfTimes[parent] -= cpuTimes[i];
+    if (useGPU)
+    {
+      gpuSelfTimes[parent] -= gpuTimes[i];
+    }
+  }
+
+  for (size_t i = 1; i < nbScopes; i++)
+  {
+    const Scope& scope = frame.Scopes[i];
+    stats.Passes.emplace_back(PassStats{ scope.Name, scope.Depth - 1, cpuSelfTimes[i],
+      useGPU ? std::max(gpuSelfTimes[i], 0.0) : -1.0 });
+  }
+}
+
+//----------------------------------------------------------------------------
+F3DFrameProfiler::ScopedPass::ScopedPass(F3DFrameProfiler& profiler, const std::string& name)
+  : Profiler(profiler)
+{
+  this->Profiler.BeginPass(name);
+}
+
+//----------------------------------------------------------------------------
+F3DFrameProfiler::ScopedPass::~ScopedPass()
+{
+  this->Profiler.EndPass();
+}
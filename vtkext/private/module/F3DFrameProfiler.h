@@ -0,0 +1,135 @@
+/**
+ * @class F3DFrameProfiler
+ * @brief A non-blocking per pass CPU/GPU frame profiler
+ *
+ * Measure the CPU and GPU times of a frame and of the render passes nested in it.
+ * GPU times are measured with OpenGL timestamp queries stored in a ring of frames.
+ * Results are read back a few frames later, only when available, so that measuring
+ * never stalls the rendering pipeline. When the ring is full because the GPU is too late,
+ * the oldest frame is dropped.
+ * GPU times are not measured on Android and WebAssembly, or if timestamp queries are not supported.
+ * All methods must be called with the OpenGL context current.
+ */
+#ifndef F3DFrameProfiler_h
+#define F3DFrameProfiler_h
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class F3DFrameProfiler
+{
+public:
+  /**
+   * Times of a pass in seconds, exclusive of the nested passes.
+   * GPUTime is negative if not measured.
+   */
+  struct PassStats
+  {
+    std::string Name;
+    unsigned int Depth = 0;
+    double CPUTime = 0.0;
+    double GPUTime = -1.0;
+  };
+
+  /**
+   * Times of a frame in seconds with its passes in rendering order.
+   * GPUTime is negative if not measured, Frame is 0 if no frame has been resolved yet.
+   */
+  struct FrameStats
+  {
+    uint64_t Frame = 0;
+    double CPUTime = 0.0;
+    double GPUTime = -1.0;
+    std::vector<PassStats> Passes;
+  };
+
+  /**
+   * Number of frames that can be in flight before being resolved
+   */
+  static constexpr size_t RingSize = 4;
+
+  /**
+   * Begin and end the recording of a frame.
+   * EndFrame also resolves the frames whose results are available.
+   */
+  void BeginFrame();
+  void EndFrame();
+
+  /**
+   * Begin and end a pass of the current frame, passes can be nested.
+   * Does nothing if no frame is being recorded.
+   */
+  void BeginPass(const std::string& name);
+  void EndPass();
+
+  /**
+   * Resolve all frames whose results are available, without waiting for the others.
+   */
+  void Resolve();
+
+  /**
+   * Get the stats of the most recent resolved frame
+   */
+  const FrameStats& GetLatestStats() const;
+
+  /**
+   * Release the OpenGL queries
+   */
+  void ReleaseGraphicsResources();
+
+  /**
+   * Helper to record a pass in a scope
+   */
+  class ScopedPass
+  {
+  public:
+    ScopedPass(F3DFrameProfiler& profiler, const std::string& name);
+    ~ScopedPass();
+    ScopedPass(const ScopedPass&) = delete;
+    ScopedPass& operator=(const ScopedPass&) = delete;
+
+  private:
+    F3DFrameProfiler& Profiler;
+  };
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Scope
+  {
+    std::string Name;
+    unsigned int Depth = 0;
+    size_t Parent = 0;
+    Clock::time_point CPUBegin;
+    Clock::time_point CPUEnd;
+    size_t BeginQuery = 0;
+    size_t EndQuery = 0;
+  };
+
+  // the first scope of a frame is the frame itself
+  struct Frame
+  {
+    uint64_t Index = 0;
+    bool Pending = false;
+    std::vector<Scope> Scopes;
+    std::vector<unsigned int> Queries;
+    size_t UsedQueries = 0;
+  };
+
+  size_t RecordTimestamp(Frame& frame);
+  bool IsAvailable(const Frame& frame) const;
+  void ResolveFrame(Frame& frame);
+
+  std::array<Frame, RingSize> Frames;
+  size_t Current = 0;
+  uint64_t FrameCounter = 0;
+  bool Recording = false;
+  bool UseGPU = false;
+  std::vector<size_t> Stack;
+  FrameStats LatestStats;
+};
+
+#endif
@@ -0,0 +1,181 @@
+#include "F3DGlyphInstances.h"
+
+#include <vtkAppendPolyData.h>
+#include <vtkDataArray.h>
+#include <vtkDataSet.h>
+#include <vtkGlyph3DMapper.h>
+#include <vtkInformation.h>
+#include <vtkMath.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPolyData.h>
+#include <vtkQuaternion.h>
+#include <vtkTransform.h>
+#include <vtkTransformPolyDataFilter.h>
+
+#include <algorithm>
+
+namespace
+{
+//----------------------------------------------------------------------------
+// Recover an input array of the mapper, set either by name or by attribute type
+vtkDataArray* GetInputArray(vtkGlyph3DMapper* mapper, vtkDataSet* input, int index)
+{
+  vtkInformation* info = mapper->GetInputArrayInformation(index);
+  if (info->Has(vtkDataObject::FIELD_NAME()))
+  {
+    return input->GetPointData()->GetArray(info->Get(vtkDataObject::FIELD_NAME()));
+  }
+  if (info->Has(vtkDataObject::FIELD_ATTRIBUTE_TYPE()))
+  {
+    return input->GetPointData()->GetAttribute(info->Get(vtkDataObject::FIELD_ATTRIBUTE_TYPE()));
+  }
+  return nullptr;
+}
+}
+
+//----------------------------------------------------------------------------
+bool F3DGlyphInstances::IsSupported(vtkGlyph3DMapper* mapper)
+{
+  vtkDataSet* input = mapper ? mapper->GetInput() : nullptr;
+  if (!input || !mapper->GetSource() || mapper->GetSourceIndexing() || mapper->GetMasking() ||
+    mapper->GetClamping())
+  {
+    return false;
+  }
+
+  vtkDataArray* orientations = mapper->GetOrient()
+    ? ::GetInputArray(mapper, input, vtkGlyph3DMapper::ORIENTATION)
+    : nullptr;
+  return !orientations ||
+    (mapper->GetOrientationMode() == vtkGlyph3DMapper::QUATERNION &&
+      orientations->GetNumberOfComponents() == 4);
+}
+
+//----------------------------------------------------------------------------
+std::vector<std::array<double, 16>> F3DGlyphInstances::ComputeMatrices(vtkGlyph3DMapper* mapper)
+{
+  std::vector<std::array<double, 16>> matrices;
+  if (!F3DGlyphInstances::IsSupported(mapper))
+  {
+    return matrices;
+  }
+
+  vtkDataSet* input = mapper->GetInput();
+  vtkDataArray* orientations = mapper->GetOrient()
+    ? ::GetInputArray(mapper, input, vtkGlyph3DMapper::ORIENTATION)
+    : nullptr;
+  vtkDataArray* scales =
+    mapper->GetScaling() ? ::GetInputArray(mapper, input, vtkGlyph3DMapper::SCALE) : nullptr;
+
+  const vtkIdType nbInstances = input->GetNumberOfPoints();
+  matrices.resize(nbInstances);
+  for (vtkIdType i = 0; i < nbInstances; i++)
+  {
+    // same transform than vtkGlyph3DMapper: translation * rotation * scale
+    double scale[3] = { 1.0, 1.0, 1.0 };
+    if (mapper->GetScaling())
+    {
+      if (scales && mapper->GetScaleMode() == vtkGlyph3DMapper::SCALE_BY_MAGNITUDE)
+      {
+        const double norm = vtkMath::Norm(scales->GetTuple(i), scales->GetNumberOfComponents());
+        std::fill_n(scale, 3, norm);
+      }
+      else if (scales && mapper->GetScaleMode() == vtkGlyph3DMapper::SCALE_BY_COMPONENTS &&
+        scales->GetNumberOfComponents() == 3)
+      {
+        scales->GetTuple(i, scale);
+      }
+
+      for (double& s : scale)
+      {
+        s *= mapper->GetScaleFactor();
+        s = s == 0.0 ? 1e-10 : s;
+      }
+    }
+
+    double rotation[3][3] = { { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 } };
+    if (orientations)
+    {
+      const double* tuple = orientations->GetTuple4(i);
+      vtkQuaterniond quaternion(tuple[0], tuple[1], tuple[2], tuple[3]);
+      quaternion.Normalize();
+      quaternion.ToMatrix3x3(rotation);
+    }
+
+    double position[3];
+    input->GetPoint(i, position);
+
+    std::array<double, 16>& matrix = matrices[i];
+    for (int r = 0; r < 3; r++)
+    {
+      for (int c = 0; c < 3; c++)
+      {
+        matrix[4 * r + c] = rotation[r][c] * scale[c];
+      }
+      matrix[4 * r + 3] = position[r];
+    }
+    matrix[12] = matrix[13] = matrix[14] = 0.0;
+    matrix[15] = 1.0;
+  }
+  return matrices;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkPolyData> F3DGlyphInstances::Expand(vtkGlyph3DMapper* mapper)
+{
+  if (!F3DGlyphInstances::IsSupported(mapper))
+  {
+    return nullptr;
+  }
+
+  const std::vector<std::array<double, 16>> matrices = F3DGlyphInstances::ComputeMatrices(mapper);
+  if (matrices.empty())
+  {
+    return vtkSmartPointer<vtkPolyData>::New();
+  }
+
+  vtkNew<vtkTransform> transform;
+  vtkNew<vtkTransformPolyDataFilter> transformFilter;
+  transformFilter->SetTransform(transform);
+  transformFilter->SetInputData(mapper->GetSource());
+
+  // per instance arrays are added on the points of each instance, unless the source has them
+  vtkPointData* sourcePointData = mapper->GetSource()->GetPointData();
+  vtkPointData* instancesPointData = mapper->GetInput()->GetPointData();
+  std::vector<vtkDataArray*> instancesArrays;
+  for (int i = 0; i < instancesPointData->GetNumberOfArrays(); i++)
+  {
+    vtkDataArray* array = instancesPointData->GetArray(i);
+    if (array && array->GetName() && !sourcePointData->HasArray(array->GetName()))
+    {
+      instancesArrays.emplace_back(array);
+    }
+  }
+
+  vtkNew<vtkAppendPolyData> append;
+  for (std::size_t i = 0; i < matrices.size(); i++)
+  {
+    transform->SetMatrix(matrices[i].data());
+    transformFilter->Update();
+
+    vtkNew<vtkPolyData> instance;
+    instance->ShallowCopy(transformFilter->GetOutput());
+    for (vtkDataArray* instancesArray : instancesArrays)
+    {
+      vtkSmartPointer<vtkDataArray> array;
+      array.TakeReference(instancesArray->NewInstance());
+      array->SetName(instancesArray->GetName());
+      array->SetNumberOfComponents(instancesArray->GetNumberOfComponents());
+      array->SetNumberOfTuples(instance->GetNumberOfPoints());
+      for (vtkIdType j = 0; j < instance->GetNumberOfPoints(); j++)
+      {
+        array->SetTuple(j, static_cast<vtkIdType>(i), instancesArray);
+      }
+      instance->GetPointData()->AddArray(array);
+    }
+    append->AddInputData(instance);
+  }
+  append->Update();
+  return append->GetOutput();
+}
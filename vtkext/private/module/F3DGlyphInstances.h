@@ -0,0 +1,43 @@
+/**
+ * @namespace F3DGlyphInstances
+ * @brief Namespace containing methods to work with glyph mapped instances
+ *
+ * Compute the transforms a vtkGlyph3DMapper applies to its source for each point of its input,
+ * so that instanced geometry can be picked or expanded into a single polydata when needed,
+ * eg: for point sprites or normal glyphs.
+ * Only mappers with a single source, an optional quaternion orientation, no masking and
+ * no clamping are supported, which is what the importers create.
+ */
+
+#ifndef F3DGlyphInstances_h
+#define F3DGlyphInstances_h
+
+#include <vtkSmartPointer.h>
+
+#include <array>
+#include <vector>
+
+class vtkGlyph3DMapper;
+class vtkPolyData;
+namespace F3DGlyphInstances
+{
+/**
+ * Return true if the instances of the mapper are supported
+ */
+bool IsSupported(vtkGlyph3DMapper* mapper);
+
+/**
+ * Compute the row major matrices transforming the source of the mapper into each instance.
+ * Return an empty vector if the mapper is not supported.
+ */
+std::vector<std::array<double, 16>> ComputeMatrices(vtkGlyph3DMapper* mapper);
+
+/**
+ * Expand the source of the mapper on each instance, keeping the source point and cell data.
+ * Point arrays of the instances are added on the points of each instance.
+ * Return nullptr if the mapper is not supported.
+ */
+vtkSmartPointer<vtkPolyData> Expand(vtkGlyph3DMapper* mapper);
+};
+
+#endif
@@ -0,0 +1,182 @@
+#include "F3DHDRICache.h"
+
+#include <vtkAbstractArray.h>
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+
+namespace
+{
+// Bump the version whenever the layout or the precomputation changes
+constexpr std::array<char, 8> CacheMagic = { 'F', '3', 'D', 'H', 'D', 'R', 'I', '\0' };
+constexpr uint32_t CacheVersion = 1;
+constexpr std::size_t CacheAlignment = 16;
+
+struct CacheHeader
+{
+  std::array<char, 8> Magic;
+  uint32_t Version;
+  int32_t DataType;
+  uint32_t Components;
+  uint32_t Faces;
+  uint32_t Size;
+  uint32_t Levels;
+  uint32_t NumberOfSphericalHarmonics;
+  uint32_t Padding[3];
+};
+static_assert(sizeof(CacheHeader) % CacheAlignment == 0);
+
+constexpr std::size_t Align(std::size_t offset)
+{
+  return (offset + CacheAlignment - 1) & ~(CacheAlignment - 1);
+}
+
+std::size_t GetFaceSize(const F3DHDRICache::TextureInfo& info, unsigned int level)
+{
+  const std::size_t size = std::max(info.Size >> level, 1u);
+  return size * size * info.Components * vtkAbstractArray::GetDataTypeSize(info.DataType);
+}
+}
+
+//----------------------------------------------------------------------------
+bool F3DHDRICache::Open(const std::string& path)
+{
+  this->Close();
+
+  if (!vtksys::SystemTools::FileExists(path, true) || !this->File.Open(path))
+  {
+    return false;
+  }
+
+  const std::byte* data = this->File.GetData();
+  const std::size_t fileSize = this->File.GetSize();
+
+  CacheHeader header;
+  if (fileSize < sizeof(header))
+  {
+    this->Close();
+    return false;
+  }
+  std::memcpy(&header, data, sizeof(header));
+
+  if (header.Magic != ::CacheMagic || header.Version != ::CacheVersion ||
+    header.Components == 0 || header.Faces == 0 || header.Levels == 0 || header.Size == 0 ||
+    header.Levels > static_cast<uint32_t>(std::bit_width(header.Size)) ||
+    vtkAbstractArray::GetDataTypeSize(header.DataType) == 0)
+  {
+    this->Close();
+    return false;
+  }
+
+  this->Info.DataType = header.DataType;
+  this->Info.Components = header.Components;
+  this->Info.Faces = header.Faces;
+  this->Info.Size = header.Size;
+  this->Info.Levels = header.Levels;
+  this->NumberOfSphericalHarmonics = header.NumberOfSphericalHarmonics;
+
+  // Compute the offsets of the levels and check the file is not truncated
+  std::size_t offset =
+    ::Align(sizeof(header) + std::size_t(this->NumberOfSphericalHarmonics) * 3 * sizeof(float));
+  for (unsigned int level = 0; level < this->Info.Levels; level++)
+  {
+    this->LevelOffsets.emplace_back(offset);
+    offset = ::Align(offset + ::GetFaceSize(this->Info, level) * this->Info.Faces);
+  }
+
+  if (offset > fileSize)
+  {
+    this->Close();
+    return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void F3DHDRICache::Close()
+{
+  this->File.Close();
+  this->Info = TextureInfo();
+  this->NumberOfSphericalHarmonics = 0;
+  this->LevelOffsets.clear();
+}
+
+//----------------------------------------------------------------------------
+const void* F3DHDRICache::GetFace(unsigned int level, unsigned int face) const
+{
+  if (level >= this->LevelOffsets.size() || face >= this->Info.Faces)
+  {
+    return nullptr;
+  }
+  return this->File.GetData() + this->LevelOffsets[level] +
+    ::GetFaceSize(this->Info, level) * face;
+}
+
+//----------------------------------------------------------------------------
+const float* F3DHDRICache::GetSphericalHarmonics() const
+{
+  if (this->NumberOfSphericalHarmonics == 0 || !this->File.GetData())
+  {
+    return nullptr;
+  }
+  // the header size is a multiple of the alignment so the coefficients are aligned
+  return reinterpret_cast<const float*>(this->File.GetData() + sizeof(CacheHeader));
+}
+
+//----------------------------------------------------------------------------
+bool F3DHDRICache::Write(const std::string& path, const TextureInfo& info,
+  const std::vector<const void*>& levels, const std::vector<float>& sphericalHarmonics)
+{
+  if (levels.size() != info.Levels || sphericalHarmonics.size() % 3 != 0)
+  {
+    return false;
+  }
+
+  CacheHeader header{};
+  header.Magic = ::CacheMagic;
+  header.Version = ::CacheVersion;
+  header.DataType = info.DataType;
+  header.Components = info.Components;
+  header.Faces = info.Faces;
+  header.Size = info.Size;
+  header.Levels = info.Levels;
+  header.NumberOfSphericalHarmonics = static_cast<uint32_t>(sphericalHarmonics.size() / 3);
+
+  // Write to a temporary file first so that an interrupted write never leaves a partial file
+  const std::string tmpPath = path + ".tmp";
+  bool success = false;
+  {
+    vtksys::ofstream file(tmpPath.c_str(), std::ios_base::binary | std::ios_base::trunc);
+    if (file.is_open())
+    {
+      const std::array<char, CacheAlignment> padding{};
+      auto writeAligned = [&](const void* data, std::size_t size)
+      {
+        file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        file.write(padding.data(), static_cast<std::streamsize>(::Align(size) - size));
+      };
+
+      file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+      writeAligned(sphericalHarmonics.data(), sphericalHarmonics.size() * sizeof(float));
+      for (unsigned int level = 0; level < info.Levels; level++)
+      {
+        writeAligned(levels[level], ::GetFaceSize(info, level) * info.Faces);
+      }
+      success = file.good();
+    }
+  }
+
+  if (success)
+  {
+    success = vtksys::SystemTools::RenameFile(tmpPath, path).IsSuccess();
+  }
+  if (!success)
+  {
+    vtksys::SystemTools::RemoveFile(tmpPath);
+  }
+  return success;
+}
@@ -0,0 +1,101 @@
+/**
+ * @class F3DHDRICache
+ * @brief A binary, memory mapped cache of precomputed image based lighting data
+ *
+ * Store textures precomputed from a HDRI, with their mip levels, and optionally
+ * the spherical harmonics of the HDRI, in a single binary file.
+ * The file starts with a versioned header, followed by the spherical harmonics coefficients
+ * and the raw texels of each mip level, faces after faces, every block being aligned
+ * on 16 bytes. Cache files are memory mapped when opened so that the texels can be
+ * uploaded to textures without any parsing or copy.
+ * Files that are truncated or written by another version are considered invalid.
+ */
+#ifndef F3DHDRICache_h
+#define F3DHDRICache_h
+
+#include "F3DMemoryMappedFile.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class F3DHDRICache
+{
+public:
+  /**
+   * Description of the cached texture.
+   * DataType is a VTK scalar type, Size is the size of the square base level.
+   */
+  struct TextureInfo
+  {
+    int DataType = 0;
+    unsigned int Components = 0;
+    unsigned int Faces = 0;
+    unsigned int Size = 0;
+    unsigned int Levels = 0;
+  };
+
+  /**
+   * Map and validate a cache file, releasing any previous mapping.
+   * Return false if the file does not exist or is not a valid cache file.
+   */
+  bool Open(const std::string& path);
+
+  /**
+   * Release the mapping, if any
+   */
+  void Close();
+
+  /**
+   * Get the description of the cached texture, only valid after a successful Open
+   */
+  const TextureInfo& GetTextureInfo() const
+  {
+    return this->Info;
+  }
+
+  /**
+   * Return true if the cached texture has the provided number of faces and components,
+   * a cache with another layout must be considered as a cache miss
+   */
+  bool HasLayout(unsigned int faces, unsigned int components) const
+  {
+    return this->Info.Faces == faces && this->Info.Components == components;
+  }
+
+  /**
+   * Get a pointer to the texels of a face of a mip level, mapped in memory
+   */
+  const void* GetFace(unsigned int level, unsigned int face) const;
+
+  /**
+   * Get the spherical harmonics coefficients, 3 per basis function,
+   * nullptr if there are none
+   */
+  const float* GetSphericalHarmonics() const;
+
+  /**
+   * Get the number of spherical harmonics basis functions
+   */
+  unsigned int GetNumberOfSphericalHarmonics() const
+  {
+    return this->NumberOfSphericalHarmonics;
+  }
+
+  /**
+   * Write a cache file with the provided texture, levels holding the texels of all faces of each
+   * mip level, and spherical harmonics coefficients, 3 per basis function.
+   * The file is written to a temporary file first so that a cache file is never partial.
+   * Return true on success, false otherwise.
+   */
+  static bool Write(const std::string& path, const TextureInfo& info,
+    const std::vector<const void*>& levels, const std::vector<float>& sphericalHarmonics = {});
+
+private:
+  F3DMemoryMappedFile File;
+  TextureInfo Info;
+  unsigned int NumberOfSphericalHarmonics = 0;
+  std::vector<std::size_t> LevelOffsets;
+};
+
+#endif
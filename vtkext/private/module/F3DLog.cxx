@@ -5,6 +5,15 @@
 #include <vtkCallbackCommand.h>
 #include <vtkNew.h>
 
+#include <mutex>
+
+namespace
+{
+// Logs can be printed from importers read concurrently, serialize them so the forwarder
+// is never invoked concurrently
+std::recursive_mutex PrintMutex;
+}
+
 // extern variables
 F3DLog::Severity F3DLog::VerboseLevel = F3DLog::Severity::Info;
 std::function<void(F3DLog::Severity, const std::string&)> F3DLog::Forwarder;
@@ -12,6 +21,7 @@ std::function<void(F3DLog::Severity, const std::string&)> F3DLog::Forwarder;
 //----------------------------------------------------------------------------
 void F3DLog::Print(Severity sev, const std::string& str)
 {
+  std::scoped_lock lock(::PrintMutex);
   if (F3DLog::Forwarder)
   {
     F3DLog::Forwarder(sev, str);
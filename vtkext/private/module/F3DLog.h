@@ -39,7 +39,8 @@ enum class StandardStream : unsigned char
 extern Severity VerboseLevel;
 
 /**
- * Print a message with corresponding severity in the output window
+ * Print a message with corresponding severity in the output window.
+ * Can be called from any thread, messages and the forwarder are serialized.
  */
 void Print(Severity sev, const std::string& msg);
 
@@ -0,0 +1,1072 @@
+#include "F3DPicker.h"
+
+#include "F3DGlyphInstances.h"
+
+#include <vtkActor.h>
+#include <vtkArrayDispatch.h>
+#include <vtkCamera.h>
+#include <vtkCellArray.h>
+#include <vtkCellArrayIterator.h>
+#include <vtkCellPicker.h>
+#include <vtkDataArrayRange.h>
+#include <vtkGlyph3DMapper.h>
+#include <vtkImageSlice.h>
+#include <vtkMath.h>
+#include <vtkMatrix4x4.h>
+#include <vtkNew.h>
+#include <vtkPointPicker.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkPropCollection.h>
+#include <vtkRenderer.h>
+#include <vtkSmartPointer.h>
+#include <vtkVolume.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <set>
+#include <vector>
+
+#ifndef __EMSCRIPTEN__
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace
+{
+constexpr double Infinity = std::numeric_limits<double>::infinity();
+
+// Same default tolerance than vtkPointPicker, as a fraction of the viewport diagonal
+constexpr double PointTolerance = 0.025;
+
+#ifndef __EMSCRIPTEN__
+// Structures are built after a render once their geometry has not been modified for this long
+constexpr std::chrono::milliseconds StableDelay(500);
+#endif
+
+// Structures are never deeper, which bounds the traversal stack
+constexpr int MaxDepth = 64;
+
+constexpr int BinCount = 16;
+constexpr size_t MaxTrianglesPerLeaf = 4;
+constexpr size_t MaxPointsPerLeaf = 16;
+
+//----------------------------------------------------------------------------
+// Segment from Origin to Origin + Direction, parameterized from 0 to 1
+struct Ray
+{
+  Ray(const double origin[3], const double end[3])
+  {
+    for (int c = 0; c < 3; c++)
+    {
+      this->Origin[c] = origin[c];
+      this->Direction[c] = end[c] - origin[c];
+      this->InverseDirection[c] = 1.0 / this->Direction[c];
+    }
+  }
+
+  double Origin[3];
+  double Direction[3];
+  double InverseDirection[3];
+};
+
+//----------------------------------------------------------------------------
+// Closest intersection found so far, in model coordinates
+struct Hit
+{
+  double T = Infinity;
+  double Position[3] = { 0.0, 0.0, 0.0 };
+};
+
+//----------------------------------------------------------------------------
+struct Box
+{
+  void Add(const float* point)
+  {
+    for (int c = 0; c < 3; c++)
+    {
+      this->Min[c] = std::min(this->Min[c], static_cast<double>(point[c]));
+      this->Max[c] = std::max(this->Max[c], static_cast<double>(point[c]));
+    }
+  }
+
+  void Add(const Box& other)
+  {
+    for (int c = 0; c < 3; c++)
+    {
+      this->Min[c] = std::min(this->Min[c], other.Min[c]);
+      this->Max[c] = std::max(this->Max[c], other.Max[c]);
+    }
+  }
+
+  double HalfArea() const
+  {
+    if (this->Min[0] > this->Max[0])
+    {
+      return 0.0;
+    }
+    const double x = this->Max[0] - this->Min[0];
+    const double y = this->Max[1] - this->Min[1];
+    const double z = this->Max[2] - this->Min[2];
+    return x * y + y * z + z * x;
+  }
+
+  int LargestAxis() const
+  {
+    int axis = 0;
+    for (int c = 1; c < 3; c++)
+    {
+      if (this->Max[c] - this->Min[c] > this->Max[axis] - this->Min[axis])
+      {
+        axis = c;
+      }
+    }
+    return axis;
+  }
+
+  // Return the parameter where the ray enters the box expanded by margin,
+  // or Infinity if it does not before tMax
+  double Intersect(const Ray& ray, double margin, double tMax) const
+  {
+    double tNear = 0.0;
+    double tFar = tMax;
+    for (int c = 0; c < 3; c++)
+    {
+      double t0 = (this->Min[c] - margin - ray.Origin[c]) * ray.InverseDirection[c];
+      double t1 = (this->Max[c] + margin - ray.Origin[c]) * ray.InverseDirection[c];
+      if (t0 > t1)
+      {
+        std::swap(t0, t1);
+      }
+      // written so that NaN, for a ray parallel to a face of the box, is ignored
+      tNear = t0 > tNear ? t0 : tNear;
+      tFar = t1 < tFar ? t1 : tFar;
+    }
+    return tNear <= tFar ? tNear : Infinity;
+  }
+
+  double Min[3] = { Infinity, Infinity, Infinity };
+  double Max[3] = { -Infinity, -Infinity, -Infinity };
+};
+
+//----------------------------------------------------------------------------
+// The first child of an inner node is the next node, Index is the second child.
+// Leaves reference Count primitives from Index.
+struct Node
+{
+  Box Bounds;
+  size_t Index = 0;
+  size_t Count = 0;
+};
+
+//----------------------------------------------------------------------------
+// Call intersectLeaf(first, count) on the leaves hit by the ray, closest first,
+// skipping the nodes farther than the current hit
+template<typename F>
+void Traverse(const std::vector<Node>& nodes, const Ray& ray, double margin, const Hit& hit,
+  F&& intersectLeaf)
+{
+  if (nodes.empty())
+  {
+    return;
+  }
+
+  std::array<std::pair<size_t, double>, 2 * MaxDepth + 2> stack;
+  size_t size = 0;
+  stack[size++] = { 0, nodes[0].Bounds.Intersect(ray, margin, hit.T) };
+  while (size > 0)
+  {
+    const auto [index, tEntry] = stack[--size];
+    if (tEntry >= hit.T)
+    {
+      continue;
+    }
+
+    const Node& node = nodes[index];
+    if (node.Count > 0)
+    {
+      intersectLeaf(node.Index, node.Count);
+      continue;
+    }
+
+    const size_t first = index + 1;
+    const size_t second = node.Index;
+    const double tFirst = nodes[first].Bounds.Intersect(ray, margin, hit.T);
+    const double tSecond = nodes[second].Bounds.Intersect(ray, margin, hit.T);
+
+    // push the farthest child first so that the closest is visited first
+    if (tFirst <= tSecond)
+    {
+      stack[size++] = { second, tSecond };
+      stack[size++] = { first, tFirst };
+    }
+    else
+    {
+      stack[size++] = { first, tFirst };
+      stack[size++] = { second, tSecond };
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Copy the points in single precision, like they are rendered
+std::vector<float> CopyPoints(vtkPoints* points)
+{
+  std::vector<float> result;
+  if (!points)
+  {
+    return result;
+  }
+
+  vtkDataArray* data = points->GetData();
+  result.resize(3 * static_cast<size_t>(data->GetNumberOfTuples()));
+  auto copy = [&](auto* array)
+  {
+    const auto range = vtk::DataArrayValueRange<3>(array);
+    std::transform(range.cbegin(), range.cend(), result.begin(),
+      [](auto value) { return static_cast<float>(value); });
+  };
+  if (!vtkArrayDispatch::DispatchByValueType<vtkArrayDispatch::Reals>::Execute(data, copy))
+  {
+    copy(data);
+  }
+  return result;
+}
+
+//----------------------------------------------------------------------------
+// Acceleration structure of the geometry of a polydata, in model coordinates
+class Structure
+{
+public:
+  virtual ~Structure() = default;
+
+  /**
+   * Update the hit if the geometry is hit closer than it.
+   * tolerance is the distance from the ray where points are picked.
+   */
+  virtual void Intersect(const Ray& ray, double tolerance, Hit& hit) const = 0;
+};
+
+//----------------------------------------------------------------------------
+// Bounding volume hierarchy of the triangles of polygons and triangle strips,
+// split using a binned surface area heuristic
+class TriangleHierarchy : public Structure
+{
+public:
+  // Return nullptr if canceled
+  static std::unique_ptr<TriangleHierarchy> Build(
+    vtkPolyData* polydata, const std::atomic<bool>& canceled)
+  {
+    auto hierarchy = std::make_unique<TriangleHierarchy>();
+    hierarchy->Points = ::CopyPoints(polydata->GetPoints());
+    const vtkIdType nbPoints = static_cast<vtkIdType>(hierarchy->Points.size() / 3);
+
+    // polygons are triangulated as fans, like they are rendered
+    auto addTriangles = [&](vtkCellArray* cells, bool strip)
+    {
+      auto it = vtk::TakeSmartPointer(cells->NewIterator());
+      for (it->GoToFirstCell(); !it->IsDoneWithTraversal(); it->GoToNextCell())
+      {
+        vtkIdType npts;
+        const vtkIdType* pts;
+        it->GetCurrentCell(npts, pts);
+        if (std::any_of(pts, pts + npts, [&](vtkIdType id) { return id < 0 || id >= nbPoints; }))
+        {
+          continue;
+        }
+        for (vtkIdType i = 2; i < npts; i++)
+        {
+          hierarchy->Triangles.push_back(
+            { strip ? pts[i - 2] : pts[0], pts[i - 1], pts[i] });
+        }
+      }
+    };
+    addTriangles(polydata->GetPolys(), false);
+    addTriangles(polydata->GetStrips(), true);
+
+    const size_t nbTriangles = hierarchy->Triangles.size();
+    std::vector<float> centroids(3 * nbTriangles);
+    for (size_t i = 0; i < nbTriangles; i++)
+    {
+      for (int c = 0; c < 3; c++)
+      {
+        float sum = 0.f;
+        for (vtkIdType id : hierarchy->Triangles[i])
+        {
+          sum += hierarchy->Points[3 * id + c];
+        }
+        centroids[3 * i + c] = sum / 3.f;
+      }
+    }
+
+    std::vector<size_t> order(nbTriangles);
+    std::iota(order.begin(), order.end(), 0);
+    if (nbTriangles > 0)
+    {
+      hierarchy->Nodes.emplace_back();
+      if (!hierarchy->BuildNode(0, order.data(), 0, nbTriangles, 0, centroids, canceled))
+      {
+        return nullptr;
+      }
+    }
+
+    // store the triangles in leaf order
+    std::vector<std::array<vtkIdType, 3>> sorted(nbTriangles);
+    for (size_t i = 0; i < nbTriangles; i++)
+    {
+      sorted[i] = hierarchy->Triangles[order[i]];
+    }
+    hierarchy->Triangles = std::move(sorted);
+    return hierarchy;
+  }
+
+  void Intersect(const Ray& ray, double, Hit& hit) const override
+  {
+    ::Traverse(this->Nodes, ray, 0.0, hit,
+      [&](size_t first, size_t count)
+      {
+        for (size_t i = first; i < first + count; i++)
+        {
+          this->IntersectTriangle(ray, this->Triangles[i], hit);
+        }
+      });
+  }
+
+private:
+  Box GetTriangleBounds(size_t index) const
+  {
+    Box box;
+    for (vtkIdType id : this->Triangles[index])
+    {
+      box.Add(&this->Points[3 * id]);
+    }
+    return box;
+  }
+
+  // Two sided Moller-Trumbore intersection
+  void IntersectTriangle(const Ray& ray, const std::array<vtkIdType, 3>& triangle, Hit& hit) const
+  {
+    double v0[3], e1[3], e2[3];
+    for (int c = 0; c < 3; c++)
+    {
+      v0[c] = this->Points[3 * triangle[0] + c];
+      e1[c] = this->Points[3 * triangle[1] + c] - v0[c];
+      e2[c] = this->Points[3 * triangle[2] + c] - v0[c];
+    }
+
+    const double* d = ray.Direction;
+    const double p[3] = { d[1] * e2[2] - d[2] * e2[1], d[2] * e2[0] - d[0] * e2[2],
+      d[0] * e2[1] - d[1] * e2[0] };
+    const double det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+    if (det == 0.0)
+    {
+      return;
+    }
+    const double inverseDet = 1.0 / det;
+
+    const double s[3] = { ray.Origin[0] - v0[0], ray.Origin[1] - v0[1], ray.Origin[2] - v0[2] };
+    const double u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * inverseDet;
+    if (u < 0.0 || u > 1.0)
+    {
+      return;
+    }
+
+    const double q[3] = { s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2],
+      s[0] * e1[1] - s[1] * e1[0] };
+    const double v = (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]) * inverseDet;
+    if (v < 0.0 || u + v > 1.0)
+    {
+      return;
+    }
+
+    const double t = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * inverseDet;
+    if (t >= 0.0 && t <= 1.0 && t < hit.T)
+    {
+      hit.T = t;
+      for (int c = 0; c < 3; c++)
+      {
+        hit.Position[c] = ray.Origin[c] + t * d[c];
+      }
+    }
+  }
+
+  bool BuildNode(size_t nodeIndex, size_t* order, size_t begin, size_t end, int depth,
+    const std::vector<float>& centroids, const std::atomic<bool>& canceled)
+  {
+    if (canceled)
+    {
+      return false;
+    }
+
+    Box bounds;
+    Box centroidBounds;
+    for (size_t i = begin; i < end; i++)
+    {
+      bounds.Add(this->GetTriangleBounds(order[i]));
+      centroidBounds.Add(&centroids[3 * order[i]]);
+    }
+    this->Nodes[nodeIndex].Bounds = bounds;
+
+    const size_t count = end - begin;
+    if (count <= MaxTrianglesPerLeaf || depth >= MaxDepth)
+    {
+      this->Nodes[nodeIndex].Index = begin;
+      this->Nodes[nodeIndex].Count = count;
+      return true;
+    }
+
+    // bin the triangles by centroid along each axis and keep the cheapest split
+    struct Bin
+    {
+      Box Bounds;
+      size_t Count = 0;
+    };
+    std::array<std::array<Bin, BinCount>, 3> bins;
+    auto binIndex = [&](size_t triangle, int axis)
+    {
+      const double extent = centroidBounds.Max[axis] - centroidBounds.Min[axis];
+      const double position = centroids[3 * triangle + axis] - centroidBounds.Min[axis];
+      return std::min(BinCount - 1, static_cast<int>(position * BinCount / extent));
+    };
+    for (size_t i = begin; i < end; i++)
+    {
+      const Box triangleBounds = this->GetTriangleBounds(order[i]);
+      for (int axis = 0; axis < 3; axis++)
+      {
+        if (centroidBounds.Max[axis] > centroidBounds.Min[axis])
+        {
+          Bin& bin = bins[axis][binIndex(order[i], axis)];
+          bin.Bounds.Add(triangleBounds);
+          bin.Count++;
+        }
+      }
+    }
+
+    double bestCost = static_cast<double>(count) * bounds.HalfArea();
+    int bestAxis = -1;
+    int bestSplit = 0;
+    for (int axis = 0; axis < 3; axis++)
+    {
+      if (centroidBounds.Max[axis] <= centroidBounds.Min[axis])
+      {
+        continue;
+      }
+
+      // cost of the right side of each split, accumulated from the right
+      std::array<double, BinCount> rightCosts{};
+      Box right;
+      size_t rightCount = 0;
+      for (int split = BinCount - 1; split > 0; split--)
+      {
+        right.Add(bins[axis][split].Bounds);
+        rightCount += bins[axis][split].Count;
+        rightCosts[split] = static_cast<double>(rightCount) * right.HalfArea();
+      }
+
+      Box left;
+      size_t leftCount = 0;
+      for (int split = 1; split < BinCount; split++)
+      {
+        left.Add(bins[axis][split - 1].Bounds);
+        leftCount += bins[axis][split - 1].Count;
+        const double cost = static_cast<double>(leftCount) * left.HalfArea() + rightCosts[split];
+        if (cost < bestCost)
+        {
+          bestCost = cost;
+          bestAxis = axis;
+          bestSplit = split;
+        }
+      }
+    }
+
+    size_t middle = begin;
+    if (bestAxis >= 0)
+    {
+      middle = static_cast<size_t>(
+        std::partition(order + begin, order + end,
+          [&](size_t triangle) { return binIndex(triangle, bestAxis) < bestSplit; }) -
+        order);
+    }
+    else if (count > 4 * MaxTrianglesPerLeaf)
+    {
+      // splitting is not worth it but the leaf would be too large, split in the middle
+      const int axis = centroidBounds.LargestAxis();
+      middle = begin + count / 2;
+      std::nth_element(order + begin, order + middle, order + end, [&](size_t a, size_t b)
+        { return centroids[3 * a + axis] < centroids[3 * b + axis]; });
+    }
+
+    if (middle == begin || middle == end)
+    {
+      this->Nodes[nodeIndex].Index = begin;
+      this->Nodes[nodeIndex].Count = count;
+      return true;
+    }
+
+    this->Nodes.emplace_back();
+    if (!this->BuildNode(nodeIndex + 1, order, begin, middle, depth + 1, centroids, canceled))
+    {
+      return false;
+    }
+    const size_t second = this->Nodes.size();
+    this->Nodes[nodeIndex].Index = second;
+    this->Nodes.emplace_back();
+    return this->BuildNode(second, order, middle, end, depth + 1, centroids, canceled);
+  }
+
+  std::vector<float> Points;
+  std::vector<std::array<vtkIdType, 3>> Triangles;
+  std::vector<Node> Nodes;
+};
+
+//----------------------------------------------------------------------------
+// K-d tree of points, split at the median along the largest axis
+class PointTree : public Structure
+{
+public:
+  // Return nullptr if canceled
+  static std::unique_ptr<PointTree> Build(vtkPolyData* polydata, const std::atomic<bool>& canceled)
+  {
+    auto tree = std::make_unique<PointTree>();
+    const std::vector<float> points = ::CopyPoints(polydata->GetPoints());
+    const size_t nbPoints = points.size() / 3;
+
+    std::vector<size_t> order(nbPoints);
+    std::iota(order.begin(), order.end(), 0);
+    if (nbPoints > 0)
+    {
+      tree->Nodes.emplace_back();
+      if (!tree->BuildNode(0, order.data(), 0, nbPoints, 0, points, canceled))
+      {
+        return nullptr;
+      }
+    }
+
+    // store the points in leaf order
+    tree->Points.resize(points.size());
+    for (size_t i = 0; i < nbPoints; i++)
+    {
+      std::copy_n(&points[3 * order[i]], 3, &tree->Points[3 * i]);
+    }
+    return tree;
+  }
+
+  void Intersect(const Ray& ray, double tolerance, Hit& hit) const override
+  {
+    const double* d = ray.Direction;
+    const double squaredLength = d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+    if (squaredLength == 0.0)
+    {
+      return;
+    }
+
+    ::Traverse(this->Nodes, ray, tolerance, hit,
+      [&](size_t first, size_t count)
+      {
+        for (size_t i = first; i < first + count; i++)
+        {
+          const float* point = &this->Points[3 * i];
+          double v[3];
+          for (int c = 0; c < 3; c++)
+          {
+            v[c] = point[c] - ray.Origin[c];
+          }
+          const double t = (v[0] * d[0] + v[1] * d[1] + v[2] * d[2]) / squaredLength;
+          if (t < 0.0 || t > 1.0 || t >= hit.T)
+          {
+            continue;
+          }
+
+          double squaredDistance = 0.0;
+          for (int c = 0; c < 3; c++)
+          {
+            const double delta = v[c] - t * d[c];
+            squaredDistance += delta * delta;
+          }
+          if (squaredDistance <= tolerance * tolerance)
+          {
+            hit.T = t;
+            std::copy_n(point, 3, hit.Position);
+          }
+        }
+      });
+  }
+
+private:
+  bool BuildNode(size_t nodeIndex, size_t* order, size_t begin, size_t end, int depth,
+    const std::vector<float>& points, const std::atomic<bool>& canceled)
+  {
+    if (canceled)
+    {
+      return false;
+    }
+
+    Box bounds;
+    for (size_t i = begin; i < end; i++)
+    {
+      bounds.Add(&points[3 * order[i]]);
+    }
+    this->Nodes[nodeIndex].Bounds = bounds;
+
+    const size_t count = end - begin;
+    if (count <= MaxPointsPerLeaf || depth >= MaxDepth)
+    {
+      this->Nodes[nodeIndex].Index = begin;
+      this->Nodes[nodeIndex].Count = count;
+      return true;
+    }
+
+    const int axis = bounds.LargestAxis();
+    const size_t middle = begin + count / 2;
+    std::nth_element(order + begin, order + middle, order + end,
+      [&](size_t a, size_t b) { return points[3 * a + axis] < points[3 * b + axis]; });
+
+    this->Nodes.emplace_back();
+    if (!this->BuildNode(nodeIndex + 1, order, begin, middle, depth + 1, points, canceled))
+    {
+      return false;
+    }
+    const size_t second = this->Nodes.size();
+    this->Nodes[nodeIndex].Index = second;
+    this->Nodes.emplace_back();
+    return this->BuildNode(second, order, middle, end, depth + 1, points, canceled);
+  }
+
+  std::vector<float> Points;
+  std::vector<Node> Nodes;
+};
+
+//----------------------------------------------------------------------------
+// Surfaces are picked on their triangles, other polydata on their points
+std::unique_ptr<Structure> BuildStructure(vtkPolyData* polydata, const std::atomic<bool>& canceled)
+{
+  if (polydata->GetNumberOfPolys() > 0 || polydata->GetNumberOfStrips() > 0)
+  {
+    return TriangleHierarchy::Build(polydata, canceled);
+  }
+  return PointTree::Build(polydata, canceled);
+}
+
+//----------------------------------------------------------------------------
+// Modification time of the geometry only, so that coloring does not invalidate structures
+vtkMTimeType GetGeometryMTime(vtkPolyData* polydata)
+{
+  vtkMTimeType mtime = polydata->vtkObject::GetMTime();
+  for (vtkObject* object : std::initializer_list<vtkObject*>{ polydata->GetPoints(),
+         polydata->GetVerts(), polydata->GetLines(), polydata->GetPolys(), polydata->GetStrips() })
+  {
+    if (object)
+    {
+      mtime = std::max(mtime, object->GetMTime());
+    }
+  }
+  return mtime;
+}
+
+//----------------------------------------------------------------------------
+// Return the polydata picked on a prop, or nullptr if there is none.
+// supported is set to false if the prop can be picked, but not using a structure.
+vtkPolyData* GetPickedPolyData(vtkProp* prop, bool& supported)
+{
+  supported = true;
+  if (!prop->GetPickable())
+  {
+    return nullptr;
+  }
+
+  vtkActor* actor = vtkActor::SafeDownCast(prop);
+  if (!actor)
+  {
+    supported = !vtkVolume::SafeDownCast(prop) && !vtkImageSlice::SafeDownCast(prop);
+    return nullptr;
+  }
+
+  // actors without bounds, like the skybox, are never picked
+  if (!actor->GetMapper() || !actor->GetBounds())
+  {
+    return nullptr;
+  }
+
+  // instanced actors are picked using the structure of their source
+  vtkGlyph3DMapper* glyphMapper = vtkGlyph3DMapper::SafeDownCast(actor->GetMapper());
+  if (glyphMapper)
+  {
+    supported = F3DGlyphInstances::IsSupported(glyphMapper);
+    return supported ? glyphMapper->GetSource() : nullptr;
+  }
+
+  vtkPolyDataMapper* mapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
+  vtkPolyData* polydata = mapper ? mapper->GetInput() : nullptr;
+  supported = polydata != nullptr;
+  return polydata;
+}
+
+//----------------------------------------------------------------------------
+// Return the row major matrices transforming the picked polydata of an actor into world
+// coordinates, one per instance for glyph mapped actors
+std::vector<std::array<double, 16>> GetPickedMatrices(vtkActor* actor)
+{
+  std::array<double, 16> actorMatrix;
+  std::copy_n(actor->GetMatrix()->GetData(), 16, actorMatrix.data());
+
+  vtkGlyph3DMapper* glyphMapper = vtkGlyph3DMapper::SafeDownCast(actor->GetMapper());
+  if (!glyphMapper)
+  {
+    return { actorMatrix };
+  }
+
+  std::vector<std::array<double, 16>> matrices = F3DGlyphInstances::ComputeMatrices(glyphMapper);
+  for (std::array<double, 16>& matrix : matrices)
+  {
+    const std::array<double, 16> instanceMatrix = matrix;
+    vtkMatrix4x4::Multiply4x4(actorMatrix.data(), instanceMatrix.data(), matrix.data());
+  }
+  return matrices;
+}
+
+//----------------------------------------------------------------------------
+void DisplayToWorld(vtkRenderer* renderer, double x, double y, double z, double world[3])
+{
+  renderer->SetDisplayPoint(x, y, z);
+  renderer->DisplayToWorld();
+  const double* point = renderer->GetWorldPoint();
+  const double w = point[3] != 0.0 ? point[3] : 1.0;
+  for (int c = 0; c < 3; c++)
+  {
+    world[c] = point[c] / w;
+  }
+}
+}
+
+//----------------------------------------------------------------------------
+struct F3DPicker::Internals
+{
+  // Structure of a polydata, built from the geometry at MTime, modified at ModifiedTime.
+  // Structure is set by the worker before Ready.
+  struct Entry
+  {
+    vtkMTimeType MTime = 0;
+    std::chrono::steady_clock::time_point ModifiedTime;
+    bool Started = false;
+    std::atomic<bool> Canceled = false;
+    std::atomic<bool> Ready = false;
+    std::unique_ptr<::Structure> Structure;
+  };
+
+  struct Job
+  {
+    vtkSmartPointer<vtkPolyData> Geometry;
+    std::shared_ptr<Entry> Target;
+  };
+
+  static void Build(const Job& job)
+  {
+    if (!job.Target->Canceled)
+    {
+      job.Target->Structure = ::BuildStructure(job.Geometry, job.Target->Canceled);
+      if (job.Target->Structure)
+      {
+        job.Target->Ready.store(true, std::memory_order_release);
+      }
+    }
+  }
+
+  /**
+   * Return the entry of the polydata, a new one if it is missing or outdated
+   */
+  std::shared_ptr<Entry> GetEntry(vtkPolyData* polydata)
+  {
+    const vtkMTimeType mtime = ::GetGeometryMTime(polydata);
+    std::shared_ptr<Entry>& entry = this->Entries[polydata];
+    if (entry && entry->MTime == mtime)
+    {
+      return entry;
+    }
+
+    if (entry)
+    {
+      entry->Canceled = true;
+    }
+    entry = std::make_shared<Entry>();
+    entry->MTime = mtime;
+    entry->ModifiedTime = std::chrono::steady_clock::now();
+    return entry;
+  }
+
+  /**
+   * Start building the structure of the entry of the polydata if not started yet
+   */
+  void StartBuild(vtkPolyData* polydata, const std::shared_ptr<Entry>& entry)
+  {
+    if (entry->Started)
+    {
+      return;
+    }
+    entry->Started = true;
+
+    // the worker references the geometry arrays without copying them, if they are modified
+    // while the structure is built, the entry is replaced by GetEntry before being used
+    Job job{ vtkSmartPointer<vtkPolyData>::New(), entry };
+    job.Geometry->SetPoints(polydata->GetPoints());
+    job.Geometry->SetVerts(polydata->GetVerts());
+    job.Geometry->SetLines(polydata->GetLines());
+    job.Geometry->SetPolys(polydata->GetPolys());
+    job.Geometry->SetStrips(polydata->GetStrips());
+
+#ifdef __EMSCRIPTEN__
+    Internals::Build(job);
+#else
+    {
+      std::scoped_lock lock(this->Mutex);
+      this->Jobs.emplace_back(std::move(job));
+    }
+    this->Condition.notify_one();
+    if (!this->Worker.joinable())
+    {
+      this->Worker = std::thread(&Internals::Work, this);
+    }
+#endif
+  }
+
+  /**
+   * Call visit(actor, polydata) on each actor of the renderer picked with a structure,
+   * return false if any visible prop cannot be picked using a structure
+   */
+  template<typename F>
+  static bool VisitPickedActors(vtkRenderer* renderer, bool visibleOnly, F&& visit)
+  {
+    bool supported = true;
+    vtkPropCollection* props = renderer->GetViewProps();
+    vtkCollectionSimpleIterator it;
+    props->InitTraversal(it);
+    while (vtkProp* prop = props->GetNextProp(it))
+    {
+      if (visibleOnly && !prop->GetVisibility())
+      {
+        continue;
+      }
+
+      bool propSupported = true;
+      vtkPolyData* polydata = ::GetPickedPolyData(prop, propSupported);
+      supported = supported && propSupported;
+      if (polydata)
+      {
+        visit(vtkActor::SafeDownCast(prop), polydata);
+      }
+    }
+    return supported;
+  }
+
+  Result FallbackPick(double x, double y, vtkRenderer* renderer)
+  {
+    Result result;
+    vtkPicker* picker = nullptr;
+    if (this->CellPicker->Pick(x, y, 0, renderer))
+    {
+      picker = this->CellPicker;
+    }
+    else if (this->PointPicker->Pick(x, y, 0, renderer))
+    {
+      picker = this->PointPicker;
+    }
+
+    if (picker)
+    {
+      result.Picked = true;
+      picker->GetPickPosition(result.Position);
+      result.Prop = picker->GetViewProp();
+    }
+    return result;
+  }
+
+#ifndef __EMSCRIPTEN__
+  void Work()
+  {
+    for (;;)
+    {
+      Job job;
+      {
+        std::unique_lock lock(this->Mutex);
+        this->Condition.wait(lock, [&]() { return this->Stop || !this->Jobs.empty(); });
+        if (this->Stop)
+        {
+          return;
+        }
+        job = std::move(this->Jobs.front());
+        this->Jobs.pop_front();
+      }
+      Internals::Build(job);
+    }
+  }
+
+  ~Internals()
+  {
+    {
+      std::scoped_lock lock(this->Mutex);
+      this->Stop = true;
+      for (auto& [polydata, entry] : this->Entries)
+      {
+        entry->Canceled = true;
+      }
+    }
+    this->Condition.notify_one();
+    if (this->Worker.joinable())
+    {
+      this->Worker.join();
+    }
+  }
+
+  std::mutex Mutex;
+  std::condition_variable Condition;
+  std::deque<Job> Jobs;
+  bool Stop = false;
+  std::thread Worker;
+#endif
+
+  std::map<vtkPolyData*, std::shared_ptr<Entry>> Entries;
+  vtkNew<vtkCellPicker> CellPicker;
+  vtkNew<vtkPointPicker> PointPicker;
+};
+
+//----------------------------------------------------------------------------
+F3DPicker::F3DPicker()
+  : Pimpl(std::make_unique<Internals>())
+{
+}
+
+//----------------------------------------------------------------------------
+F3DPicker::~F3DPicker() = default;
+
+//----------------------------------------------------------------------------
+void F3DPicker::Prepare(vtkRenderer* renderer)
+{
+  Internals::VisitPickedActors(renderer, true, [&](vtkActor*, vtkPolyData* polydata)
+    { this->Pimpl->StartBuild(polydata, this->Pimpl->GetEntry(polydata)); });
+}
+
+//----------------------------------------------------------------------------
+void F3DPicker::PrepareWhenStable(vtkRenderer* renderer)
+{
+  // structures of hidden actors are kept but not built, as they may never be picked
+  std::set<vtkPolyData*> used;
+  Internals::VisitPickedActors(renderer, false,
+    [&]([[maybe_unused]] vtkActor* actor, vtkPolyData* polydata)
+    {
+      used.insert(polydata);
+#ifndef __EMSCRIPTEN__
+      // building would block the rendering on WebAssembly, structures are built when picking
+      if (actor->GetVisibility())
+      {
+        std::shared_ptr<Internals::Entry> entry = this->Pimpl->GetEntry(polydata);
+        if (std::chrono::steady_clock::now() - entry->ModifiedTime >= ::StableDelay)
+        {
+          this->Pimpl->StartBuild(polydata, entry);
+        }
+      }
+#endif
+    });
+
+  for (auto it = this->Pimpl->Entries.begin(); it != this->Pimpl->Entries.end();)
+  {
+    if (used.count(it->first) == 0)
+    {
+      it->second->Canceled = true;
+      it = this->Pimpl->Entries.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+bool F3DPicker::IsReady(vtkRenderer* renderer)
+{
+  bool ready = true;
+  const bool supported = Internals::VisitPickedActors(renderer, true,
+    [&](vtkActor*, vtkPolyData* polydata)
+    { ready = ready && this->Pimpl->GetEntry(polydata)->Ready.load(std::memory_order_acquire); });
+  return supported && ready;
+}
+
+//----------------------------------------------------------------------------
+F3DPicker::Result F3DPicker::Pick(double x, double y, vtkRenderer* renderer)
+{
+  std::vector<std::pair<vtkActor*, std::shared_ptr<Internals::Entry>>> actors;
+  bool ready = true;
+  const bool supported = Internals::VisitPickedActors(renderer, true,
+    [&](vtkActor* actor, vtkPolyData* polydata)
+    {
+      std::shared_ptr<Internals::Entry> entry = this->Pimpl->GetEntry(polydata);
+      this->Pimpl->StartBuild(polydata, entry);
+      ready = ready && entry->Ready.load(std::memory_order_acquire);
+      actors.emplace_back(actor, entry);
+    });
+
+  if (!supported || !ready)
+  {
+    return this->Pimpl->FallbackPick(x, y, renderer);
+  }
+
+  // the ray goes through the clipping range
+  double nearPoint[3], farPoint[3];
+  ::DisplayToWorld(renderer, x, y, 0.0, nearPoint);
+  ::DisplayToWorld(renderer, x, y, 1.0, farPoint);
+
+  // points are picked within a fraction of the viewport diagonal at the focal point depth
+  double focalPoint[3];
+  renderer->GetActiveCamera()->GetFocalPoint(focalPoint);
+  renderer->SetWorldPoint(focalPoint[0], focalPoint[1], focalPoint[2], 1.0);
+  renderer->WorldToDisplay();
+  const double focalDepth = renderer->GetDisplayPoint()[2];
+  const int* origin = renderer->GetOrigin();
+  const int* size = renderer->GetSize();
+  double lowerLeft[3], upperRight[3];
+  ::DisplayToWorld(renderer, origin[0], origin[1], focalDepth, lowerLeft);
+  ::DisplayToWorld(renderer, origin[0] + size[0], origin[1] + size[1], focalDepth, upperRight);
+  const double tolerance =
+    PointTolerance * std::sqrt(vtkMath::Distance2BetweenPoints(lowerLeft, upperRight));
+
+  Result result;
+  result.Accelerated = true;
+  double bestT = Infinity;
+  for (const auto& [actor, entry] : actors)
+  {
+    for (const std::array<double, 16>& matrix : ::GetPickedMatrices(actor))
+    {
+      // intersect in model coordinates, the ray parameter is preserved by affine transforms
+      double inverse[16];
+      vtkMatrix4x4::Invert(matrix.data(), inverse);
+      double modelNear[4] = { nearPoint[0], nearPoint[1], nearPoint[2], 1.0 };
+      double modelFar[4] = { farPoint[0], farPoint[1], farPoint[2], 1.0 };
+      vtkMatrix4x4::MultiplyPoint(inverse, modelNear, modelNear);
+      vtkMatrix4x4::MultiplyPoint(inverse, modelFar, modelFar);
+
+      const double scale = std::cbrt(std::abs(vtkMatrix4x4::Determinant(matrix.data())));
+      ::Hit hit;
+      hit.T = bestT;
+      entry->Structure->Intersect(
+        ::Ray(modelNear, modelFar), scale > 0.0 ? tolerance / scale : tolerance, hit);
+      if (hit.T < bestT)
+      {
+        bestT = hit.T;
+        double position[4] = { hit.Position[0], hit.Position[1], hit.Position[2], 1.0 };
+        vtkMatrix4x4::MultiplyPoint(matrix.data(), position, position);
+        std::copy_n(position, 3, result.Position);
+        result.Picked = true;
+        result.Prop = actor;
+      }
+    }
+  }
+  return result;
+}
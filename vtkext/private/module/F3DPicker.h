@@ -0,0 +1,78 @@
+/**
+ * @class F3DPicker
+ * @brief A picker using acceleration structures built in the background
+ *
+ * Pick the closest geometry under a display position using an acceleration structure per polydata:
+ * a bounding volume hierarchy of triangles built with the surface area heuristic for surfaces,
+ * and a k-d tree of points for point clouds and polydata without polygons.
+ * Points are picked within a tolerance of the ray, like vtkPointPicker, and the front-most one
+ * is kept.
+ * Glyph mapped instanced actors are picked using the structure of their source on each instance.
+ * Structures of the visible actors are built lazily by a worker thread, on the first pick or
+ * once their geometry has not been modified for a while, and are rebuilt when it is modified.
+ * The worker references the geometry without copying it, so a structure is discarded if its
+ * geometry is modified while it is built.
+ * When a structure is not built yet, or when a prop is not supported, like a volume,
+ * it falls back to picking with a vtkCellPicker, then a vtkPointPicker.
+ * On WebAssembly, there is no worker thread and structures are built when picking.
+ * All methods must be called from the rendering thread.
+ */
+#ifndef F3DPicker_h
+#define F3DPicker_h
+
+#include <memory>
+
+class vtkProp;
+class vtkRenderer;
+class F3DPicker
+{
+public:
+  /**
+   * Result of a pick, Position is in world coordinates
+   */
+  struct Result
+  {
+    bool Picked = false;
+    double Position[3] = { 0.0, 0.0, 0.0 };
+    vtkProp* Prop = nullptr;
+    bool Accelerated = false;
+  };
+
+  F3DPicker();
+  ~F3DPicker();
+  F3DPicker(const F3DPicker&) = delete;
+  F3DPicker& operator=(const F3DPicker&) = delete;
+
+  /**
+   * Start building the structures of the visible actors of the renderer that are missing
+   * or outdated.
+   */
+  void Prepare(vtkRenderer* renderer);
+
+  /**
+   * Start building the structures of the visible actors of the renderer whose geometry has not
+   * been modified for a while, usually called after a render.
+   * Structures of polydata that are not in the renderer anymore are released.
+   * On WebAssembly, structures are only built when picking.
+   */
+  void PrepareWhenStable(vtkRenderer* renderer);
+
+  /**
+   * Return true if the structures of all the visible and pickable props of the renderer are
+   * built and up to date, so that picking does not fall back to the VTK pickers.
+   */
+  bool IsReady(vtkRenderer* renderer);
+
+  /**
+   * Pick the renderer at the display position, in pixels from the lower left corner.
+   * Start building the missing or outdated structures of the visible actors.
+   * Accelerated is set if the structures have been used.
+   */
+  Result Pick(double x, double y, vtkRenderer* renderer);
+
+private:
+  struct Internals;
+  std::unique_ptr<Internals> Pimpl;
+};
+
+#endif
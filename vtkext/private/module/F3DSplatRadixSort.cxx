@@ -0,0 +1,167 @@
+#include "F3DSplatRadixSort.h"
+
+#include <vtkArrayDispatch.h>
+#include <vtkDataArray.h>
+#include <vtkDataArrayRange.h>
+#include <vtkSMPTools.h>
+
+#include <algorithm>
+
+namespace
+{
+constexpr int DigitBits = 8;
+constexpr int NumberOfDigits = 1 << DigitBits;
+constexpr int NumberOfPasses = (F3DSplatRadixSort::KeyBits + DigitBits - 1) / DigitBits;
+
+// Below this number of keys per block, threading overhead is not worth it
+constexpr vtkIdType MinimumBlockSize = 1 << 16;
+}
+
+//----------------------------------------------------------------------------
+const std::vector<unsigned int>& F3DSplatRadixSort::Sort(
+  vtkDataArray* points, const double direction[3])
+{
+  if (!points || points->GetNumberOfComponents() != 3)
+  {
+    this->Indices.clear();
+    return this->Indices;
+  }
+
+  // the depth range is deduced from the cached point bounds, so no reduction pass is needed
+  double depthRange[2] = { 0.0, 0.0 };
+  for (int c = 0; c < 3; c++)
+  {
+    const double* range = points->GetRange(c);
+    depthRange[0] += std::min(range[0] * direction[c], range[1] * direction[c]);
+    depthRange[1] += std::max(range[0] * direction[c], range[1] * direction[c]);
+  }
+
+  auto worker = [&](auto* array) { this->ComputeKeys(array, direction, depthRange); };
+  if (!vtkArrayDispatch::DispatchByValueType<vtkArrayDispatch::Reals>::Execute(points, worker))
+  {
+    worker(points);
+  }
+
+  this->RadixSort();
+  return this->Indices;
+}
+
+//----------------------------------------------------------------------------
+template<typename ArrayT>
+void F3DSplatRadixSort::ComputeKeys(
+  ArrayT* points, const double direction[3], const double depthRange[2])
+{
+  const vtkIdType nbPoints = points->GetNumberOfTuples();
+  this->Keys.resize(nbPoints);
+  this->Indices.resize(nbPoints);
+
+  const double minDepth = depthRange[0];
+  const double maxDepth = depthRange[1];
+  const double maxKey = static_cast<double>((1u << F3DSplatRadixSort::KeyBits) - 1);
+  const double scale = maxDepth > minDepth ? maxKey / (maxDepth - minDepth) : 0.0;
+  const float dir[3] = { static_cast<float>(direction[0] * scale),
+    static_cast<float>(direction[1] * scale), static_cast<float>(direction[2] * scale) };
+  const float offset = static_cast<float>(minDepth * scale);
+  const float maxKeyF = static_cast<float>(maxKey);
+
+  uint32_t* keys = this->Keys.data();
+  unsigned int* indices = this->Indices.data();
+  vtkSMPTools::For(0, nbPoints,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      const auto tuples = vtk::DataArrayTupleRange<3>(points, begin, end);
+      vtkIdType i = begin;
+      for (const auto tuple : tuples)
+      {
+        const float depth = static_cast<float>(tuple[0]) * dir[0] +
+          static_cast<float>(tuple[1]) * dir[1] + static_cast<float>(tuple[2]) * dir[2] - offset;
+        keys[i] = static_cast<uint32_t>(std::clamp(depth, 0.f, maxKeyF));
+        indices[i] = static_cast<unsigned int>(i);
+        i++;
+      }
+    });
+}
+
+//----------------------------------------------------------------------------
+void F3DSplatRadixSort::RadixSort()
+{
+  const vtkIdType nbKeys = static_cast<vtkIdType>(this->Keys.size());
+  this->KeysScratch.resize(nbKeys);
+  this->IndicesScratch.resize(nbKeys);
+
+  const vtkIdType nbThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+  const vtkIdType nbBlocks =
+    std::max<vtkIdType>(1, std::min(nbThreads, nbKeys / ::MinimumBlockSize));
+  const vtkIdType blockSize = (nbKeys + nbBlocks - 1) / nbBlocks;
+  this->Histograms.resize(nbBlocks);
+
+  for (int pass = 0; pass < ::NumberOfPasses; pass++)
+  {
+    const int shift = pass * ::DigitBits;
+
+    // count digits of each block
+    vtkSMPTools::For(0, nbBlocks, 1,
+      [&](vtkIdType firstBlock, vtkIdType lastBlock)
+      {
+        for (vtkIdType b = firstBlock; b < lastBlock; b++)
+        {
+          std::array<size_t, ::NumberOfDigits>& histogram = this->Histograms[b];
+          histogram.fill(0);
+          const vtkIdType end = std::min(nbKeys, (b + 1) * blockSize);
+          for (vtkIdType i = b * blockSize; i < end; i++)
+          {
+            histogram[(this->Keys[i] >> shift) & (::NumberOfDigits - 1)]++;
+          }
+        }
+      });
+
+    // skip the pass if all keys have the same digit, which is frequent for the highest digits
+    bool skip = false;
+    for (int d = 0; d < ::NumberOfDigits && !skip; d++)
+    {
+      size_t count = 0;
+      for (const auto& histogram : this->Histograms)
+      {
+        count += histogram[d];
+      }
+      skip = count == static_cast<size_t>(nbKeys);
+    }
+    if (skip)
+    {
+      continue;
+    }
+
+    // convert counts into output offsets, digit major then block, to keep the sort stable
+    size_t offset = 0;
+    for (int d = 0; d < ::NumberOfDigits; d++)
+    {
+      for (auto& histogram : this->Histograms)
+      {
+        const size_t count = histogram[d];
+        histogram[d] = offset;
+        offset += count;
+      }
+    }
+
+    // scatter keys and indices of each block
+    vtkSMPTools::For(0, nbBlocks, 1,
+      [&](vtkIdType firstBlock, vtkIdType lastBlock)
+      {
+        for (vtkIdType b = firstBlock; b < lastBlock; b++)
+        {
+          std::array<size_t, ::NumberOfDigits>& offsets = this->Histograms[b];
+          const vtkIdType end = std::min(nbKeys, (b + 1) * blockSize);
+          for (vtkIdType i = b * blockSize; i < end; i++)
+          {
+            const uint32_t key = this->Keys[i];
+            const size_t target = offsets[(key >> shift) & (::NumberOfDigits - 1)]++;
+            this->KeysScratch[target] = key;
+            this->IndicesScratch[target] = this->Indices[i];
+          }
+        }
+      });
+
+    std::swap(this->Keys, this->KeysScratch);
+    std::swap(this->Indices, this->IndicesScratch);
+  }
+}
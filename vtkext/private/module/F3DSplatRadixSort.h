@@ -0,0 +1,49 @@
+/**
+ * @class F3DSplatRadixSort
+ * @brief A multi-threaded CPU sorting engine for splats
+ *
+ * Sort splats by depth along a direction, used when compute shaders are not available.
+ * Depths are computed with a typed pass over the point array and quantized into
+ * integer keys using the depth range of the point bounds, then sorted with a
+ * multi-threaded LSD radix sort.
+ * Buffers are kept between calls so that sorting the same splats again does not allocate.
+ */
+#ifndef F3DSplatRadixSort_h
+#define F3DSplatRadixSort_h
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+class vtkDataArray;
+class F3DSplatRadixSort
+{
+public:
+  /**
+   * Number of bits of the quantized depth keys.
+   * Splats with depths closer than the depth range divided by 2^KeyBits may not be ordered.
+   */
+  static constexpr int KeyBits = 24;
+
+  /**
+   * Sort the points by increasing depth along the provided direction.
+   * Return the sorted point indices, valid until the next call.
+   */
+  const std::vector<unsigned int>& Sort(vtkDataArray* points, const double direction[3]);
+
+private:
+  template<typename ArrayT>
+  void ComputeKeys(ArrayT* points, const double direction[3], const double depthRange[2]);
+
+  void RadixSort();
+
+  std::vector<uint32_t> Keys;
+  std::vector<uint32_t> KeysScratch;
+  std::vector<unsigned int> Indices;
+  std::vector<unsigned int> IndicesScratch;
+
+  // one histogram of digits per block of keys
+  std::vector<std::array<size_t, 256>> Histograms;
+};
+
+#endif
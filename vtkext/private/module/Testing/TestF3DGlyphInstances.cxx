@@ -0,0 +1,205 @@
+#include <vtkActor.h>
+#include <vtkCellPicker.h>
+#include <vtkFloatArray.h>
+#include <vtkGlyph3DMapper.h>
+#include <vtkMath.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+#include <vtkSphereSource.h>
+
+#include "F3DGlyphInstances.h"
+#include "F3DPicker.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+
+int TestF3DGlyphInstances(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
+{
+  // a source with an array to color with, instanced the same way than the USD importer
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(32);
+  sphere->SetPhiResolution(32);
+  sphere->Update();
+  vtkNew<vtkPolyData> source;
+  source->DeepCopy(sphere->GetOutput());
+  vtkNew<vtkFloatArray> heights;
+  heights->SetName("Height");
+  heights->SetNumberOfTuples(source->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < source->GetNumberOfPoints(); i++)
+  {
+    heights->SetValue(i, static_cast<float>(source->GetPoint(i)[2]));
+  }
+  source->GetPointData()->AddArray(heights);
+
+  vtkNew<vtkPoints> positions;
+  positions->InsertNextPoint(0.0, 0.0, 0.0);
+  positions->InsertNextPoint(1.5, 0.5, 0.0);
+  positions->InsertNextPoint(-1.0, 1.0, -1.0);
+  vtkNew<vtkFloatArray> orientations;
+  orientations->SetName("Orientation");
+  orientations->SetNumberOfComponents(4);
+  orientations->InsertNextTuple4(1.0, 0.0, 0.0, 0.0);
+  orientations->InsertNextTuple4(0.9238795, 0.0, 0.3826834, 0.0);
+  orientations->InsertNextTuple4(0.7071068, 0.7071068, 0.0, 0.0);
+  vtkNew<vtkFloatArray> scales;
+  scales->SetName("Scale");
+  scales->SetNumberOfComponents(3);
+  scales->InsertNextTuple3(1.0, 1.0, 1.0);
+  scales->InsertNextTuple3(0.5, 2.0, 1.0);
+  scales->InsertNextTuple3(1.5, 0.5, 0.5);
+  vtkNew<vtkFloatArray> temperatures;
+  temperatures->SetName("Temperature");
+  temperatures->InsertNextValue(10.0);
+  temperatures->InsertNextValue(20.0);
+  temperatures->InsertNextValue(30.0);
+  vtkNew<vtkPolyData> instances;
+  instances->SetPoints(positions);
+  instances->GetPointData()->AddArray(orientations);
+  instances->GetPointData()->AddArray(scales);
+  instances->GetPointData()->AddArray(temperatures);
+
+  vtkNew<vtkGlyph3DMapper> glyphMapper;
+  glyphMapper->SetInputData(instances);
+  glyphMapper->SetSourceData(source);
+  glyphMapper->SetOrientationModeToQuaternion();
+  glyphMapper->SetOrientationArray("Orientation");
+  glyphMapper->SetScaleModeToScaleByVectorComponents();
+  glyphMapper->SetScaleArray("Scale");
+
+  if (!F3DGlyphInstances::IsSupported(glyphMapper) ||
+    F3DGlyphInstances::ComputeMatrices(glyphMapper).size() != 3)
+  {
+    std::cerr << "Instances of the glyph mapper are not supported\n";
+    return EXIT_FAILURE;
+  }
+
+  // the expanded geometry keeps the arrays of the source and is within the glyph mapper bounds
+  vtkSmartPointer<vtkPolyData> expanded = F3DGlyphInstances::Expand(glyphMapper);
+  if (expanded->GetNumberOfPoints() != 3 * source->GetNumberOfPoints() ||
+    expanded->GetNumberOfCells() != 3 * source->GetNumberOfCells() ||
+    !expanded->GetPointData()->GetArray("Height"))
+  {
+    std::cerr << "Unexpected expanded geometry\n";
+    return EXIT_FAILURE;
+  }
+
+  double glyphBounds[6];
+  glyphMapper->GetBounds(glyphBounds);
+  double expandedBounds[6];
+  expanded->GetBounds(expandedBounds);
+  for (int i = 0; i < 3; i++)
+  {
+    if (expandedBounds[2 * i] < glyphBounds[2 * i] - 1e-4 ||
+      expandedBounds[2 * i + 1] > glyphBounds[2 * i + 1] + 1e-4)
+    {
+      std::cerr << "Expanded geometry is outside of the glyph mapper bounds\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  // the arrays of the instances are added on the points of each instance
+  vtkDataArray* expandedTemperatures = expanded->GetPointData()->GetArray("Temperature");
+  if (!expandedTemperatures ||
+    expandedTemperatures->GetTuple1(2 * source->GetNumberOfPoints()) != 30.0 ||
+    expandedTemperatures->GetTuple1(2 * source->GetNumberOfPoints() - 1) != 20.0)
+  {
+    std::cerr << "Arrays of the instances are not expanded\n";
+    return EXIT_FAILURE;
+  }
+
+  // the third instance is rotated by 90 degrees around X, then scaled and translated
+  double sourcePoint[3];
+  source->GetPoint(0, sourcePoint);
+  const double expectedPoint[3] = { -1.0 + 1.5 * sourcePoint[0], 1.0 - 0.5 * sourcePoint[2],
+    -1.0 + 0.5 * sourcePoint[1] };
+  double expandedPoint[3];
+  expanded->GetPoint(2 * source->GetNumberOfPoints(), expandedPoint);
+  if (vtkMath::Distance2BetweenPoints(expectedPoint, expandedPoint) > 1e-8)
+  {
+    std::cerr << "Unexpected transform of an instance\n";
+    return EXIT_FAILURE;
+  }
+
+  // masked glyph mappers are not supported
+  vtkNew<vtkGlyph3DMapper> maskedMapper;
+  maskedMapper->SetInputData(instances);
+  maskedMapper->SetSourceData(source);
+  maskedMapper->MaskingOn();
+  if (F3DGlyphInstances::IsSupported(maskedMapper) || F3DGlyphInstances::Expand(maskedMapper))
+  {
+    std::cerr << "Masked glyph mapper should not be supported\n";
+    return EXIT_FAILURE;
+  }
+
+  // picking the instances matches picking the expanded geometry
+  vtkNew<vtkActor> glyphActor;
+  glyphActor->SetMapper(glyphMapper);
+  glyphActor->SetPosition(0.2, -0.3, 0.0);
+  vtkNew<vtkRenderer> renderer;
+  renderer->AddActor(glyphActor);
+  vtkNew<vtkRenderWindow> window;
+  window->SetOffScreenRendering(true);
+  window->SetSize(300, 300);
+  window->AddRenderer(renderer);
+  renderer->ResetCamera();
+
+  vtkNew<vtkPolyDataMapper> expandedMapper;
+  expandedMapper->SetInputData(expanded);
+  vtkNew<vtkActor> expandedActor;
+  expandedActor->SetMapper(expandedMapper);
+  expandedActor->SetPosition(0.2, -0.3, 0.0);
+  vtkNew<vtkRenderer> expandedRenderer;
+  expandedRenderer->AddActor(expandedActor);
+  expandedRenderer->SetActiveCamera(renderer->GetActiveCamera());
+  vtkNew<vtkRenderWindow> expandedWindow;
+  expandedWindow->SetOffScreenRendering(true);
+  expandedWindow->SetSize(300, 300);
+  expandedWindow->AddRenderer(expandedRenderer);
+
+  F3DPicker picker;
+  picker.Prepare(renderer);
+  for (int i = 0; i < 200 && !picker.IsReady(renderer); i++)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  }
+  if (!picker.IsReady(renderer))
+  {
+    std::cerr << "Picking structure of the instances has not been built\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkCellPicker> cellPicker;
+  int mismatches = 0;
+  int picks = 0;
+  for (int y = 10; y < 300; y += 20)
+  {
+    for (int x = 10; x < 300; x += 20)
+    {
+      const F3DPicker::Result result = picker.Pick(x, y, renderer);
+      const bool picked = cellPicker->Pick(x, y, 0, expandedRenderer) != 0;
+      picks += picked ? 1 : 0;
+      if (result.Picked != picked ||
+        (picked &&
+          (result.Prop != glyphActor ||
+            vtkMath::Distance2BetweenPoints(result.Position, cellPicker->GetPickPosition()) >
+              1e-6)))
+      {
+        mismatches++;
+      }
+    }
+  }
+  if (picks == 0 || mismatches > 2)
+  {
+    std::cerr << "Unexpected picks of instances\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,100 @@
+#include "vtkF3DGenericImporter.h"
+#include "vtkF3DMetaImporter.h"
+
+#include <vtkActorCollection.h>
+#include <vtkNew.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+#include <vtkXMLPolyDataReader.h>
+#include <vtkXMLStructuredGridReader.h>
+#include <vtkXMLUnstructuredGridReader.h>
+
+#include <iostream>
+
+int TestF3DMetaImporterConcurrentRead(int argc, char* argv[])
+{
+  vtkNew<vtkF3DMetaImporter> importer;
+
+  // Three independent files, read concurrently by the meta importer
+  vtkNew<vtkXMLPolyDataReader> readerVTP;
+  std::string filename = std::string(argv[1]) + "data/cow.vtp";
+  readerVTP->SetFileName(filename.c_str());
+  vtkNew<vtkF3DGenericImporter> importerVTP;
+  importerVTP->SetInternalReader(readerVTP);
+
+  vtkNew<vtkXMLUnstructuredGridReader> readerVTU;
+  filename = std::string(argv[1]) + "data/dragon.vtu";
+  readerVTU->SetFileName(filename.c_str());
+  vtkNew<vtkF3DGenericImporter> importerVTU;
+  importerVTU->SetInternalReader(readerVTU);
+
+  vtkNew<vtkXMLStructuredGridReader> readerVTS;
+  filename = std::string(argv[1]) + "data/bluntfin.vts";
+  readerVTS->SetFileName(filename.c_str());
+  vtkNew<vtkF3DGenericImporter> importerVTS;
+  importerVTS->SetInternalReader(readerVTS);
+
+  // Readers are only read concurrently once declared thread safe
+  importerVTP->ThreadSafeOn();
+  importerVTU->ThreadSafeOn();
+  importerVTS->ThreadSafeOn();
+
+  importer->AddImporter({ "cow", importerVTP });
+  importer->AddImporter({ "dragon", importerVTU });
+  importer->AddImporter({ "bluntfin", importerVTS });
+
+  vtkNew<vtkRenderWindow> window;
+  vtkNew<vtkRenderer> renderer;
+  window->AddRenderer(renderer);
+  importer->SetRenderWindow(window);
+  if (!importer->Update())
+  {
+    std::cerr << "Meta importer failed to update\n";
+    return EXIT_FAILURE;
+  }
+
+  // Actors must be in the original importer order, whatever the order of completion
+  const auto& coloringStructs = importer->GetColoringActorsAndMappers();
+  if (coloringStructs.size() != 3)
+  {
+    std::cerr << "Unexpected number of coloring actors: " << coloringStructs.size() << "\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkImporter* importers[3] = { importerVTP, importerVTU, importerVTS };
+  for (int i = 0; i < 3; i++)
+  {
+    vtkActor* actor = importers[i]->GetImportedActors()->GetLastActor();
+    if (coloringStructs[i].OriginalActor != actor)
+    {
+      std::cerr << "Unexpected actor order for importer " << i << "\n";
+      return EXIT_FAILURE;
+    }
+
+    // Imported actors must have been forwarded to the actual renderer
+    if (!renderer->HasViewProp(actor))
+    {
+      std::cerr << "Imported actor " << i << " is not in the renderer\n";
+      return EXIT_FAILURE;
+    }
+
+    if (!importer->GetImporterInfo(i).Updated)
+    {
+      std::cerr << "Importer " << i << " is not flagged as updated\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Time update should not lose any actor
+  importer->UpdateAtTimeValue(0.0);
+  for (vtkImporter* imp : importers)
+  {
+    if (!renderer->HasViewProp(imp->GetImportedActors()->GetLastActor()))
+    {
+      std::cerr << "Imported actor removed from the renderer after a time update\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
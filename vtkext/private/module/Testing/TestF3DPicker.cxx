@@ -0,0 +1,181 @@
+#include <vtkActor.h>
+#include <vtkCellArray.h>
+#include <vtkCellPicker.h>
+#include <vtkMath.h>
+#include <vtkNew.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+#include <vtkSphereSource.h>
+
+#include "F3DPicker.h"
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+bool WaitUntilReady(F3DPicker& picker, vtkRenderer* renderer)
+{
+  picker.Prepare(renderer);
+  for (int i = 0; i < 200 && !picker.IsReady(renderer); i++)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  }
+  return picker.IsReady(renderer);
+}
+
+// Compare picks on a grid of positions with a vtkCellPicker, rays grazing the silhouettes
+// can be picked differently so a few mismatches are tolerated
+bool CompareWithCellPicker(F3DPicker& picker, vtkRenderer* renderer)
+{
+  vtkNew<vtkCellPicker> cellPicker;
+  int mismatches = 0;
+  for (int y = 10; y < 300; y += 20)
+  {
+    for (int x = 10; x < 300; x += 20)
+    {
+      const F3DPicker::Result result = picker.Pick(x, y, renderer);
+      const bool picked = cellPicker->Pick(x, y, 0, renderer) != 0;
+      if (result.Picked != picked ||
+        (picked &&
+          (result.Prop != cellPicker->GetViewProp() ||
+            vtkMath::Distance2BetweenPoints(result.Position, cellPicker->GetPickPosition()) >
+              1e-6)))
+      {
+        mismatches++;
+      }
+    }
+  }
+  return mismatches <= 2;
+}
+}
+
+int TestF3DPicker(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
+{
+  vtkNew<vtkRenderer> renderer;
+  vtkNew<vtkRenderWindow> window;
+  window->SetOffScreenRendering(true);
+  window->SetSize(300, 300);
+  window->AddRenderer(renderer);
+
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(64);
+  sphere->SetPhiResolution(64);
+  vtkNew<vtkPolyDataMapper> sphereMapper;
+  sphereMapper->SetInputConnection(sphere->GetOutputPort());
+  vtkNew<vtkActor> sphereActor;
+  sphereActor->SetMapper(sphereMapper);
+  renderer->AddActor(sphereActor);
+
+  // a transformed actor sharing the same geometry
+  vtkNew<vtkActor> transformedActor;
+  transformedActor->SetMapper(sphereMapper);
+  transformedActor->SetPosition(0.8, 0.3, -1.0);
+  transformedActor->SetScale(0.5, 1.5, 1.0);
+  renderer->AddActor(transformedActor);
+
+  renderer->ResetCamera();
+
+  F3DPicker picker;
+  if (!::WaitUntilReady(picker, renderer))
+  {
+    std::cerr << "Picking structures have not been built\n";
+    return EXIT_FAILURE;
+  }
+
+  if (!::CompareWithCellPicker(picker, renderer))
+  {
+    std::cerr << "Unexpected picks of surfaces\n";
+    return EXIT_FAILURE;
+  }
+
+  // modifying the geometry invalidates its structure
+  sphere->SetRadius(0.8);
+  sphere->Update();
+  if (picker.IsReady(renderer))
+  {
+    std::cerr << "Picking structure has not been invalidated\n";
+    return EXIT_FAILURE;
+  }
+
+  if (!::WaitUntilReady(picker, renderer) || !::CompareWithCellPicker(picker, renderer))
+  {
+    std::cerr << "Unexpected picks of a modified surface\n";
+    return EXIT_FAILURE;
+  }
+
+  // points are picked within a tolerance, in front of the surfaces
+  vtkNew<vtkPoints> points;
+  points->InsertNextPoint(0.1, 0.1, 2.0);
+  points->InsertNextPoint(0.1, 0.1, -2.0);
+  vtkNew<vtkCellArray> verts;
+  const vtkIdType ids[2] = { 0, 1 };
+  verts->InsertNextCell(2, ids);
+  vtkNew<vtkPolyData> cloud;
+  cloud->SetPoints(points);
+  cloud->SetVerts(verts);
+  vtkNew<vtkPolyDataMapper> cloudMapper;
+  cloudMapper->SetInputData(cloud);
+  vtkNew<vtkActor> cloudActor;
+  cloudActor->SetMapper(cloudMapper);
+  renderer->AddActor(cloudActor);
+  renderer->ResetCamera();
+
+  if (!::WaitUntilReady(picker, renderer))
+  {
+    std::cerr << "Picking structure of points has not been built\n";
+    return EXIT_FAILURE;
+  }
+
+  double display[3];
+  renderer->SetWorldPoint(0.1, 0.1, 2.0, 1.0);
+  renderer->WorldToDisplay();
+  renderer->GetDisplayPoint(display);
+
+  const double expected[3] = { 0.1, 0.1, 2.0 };
+  const F3DPicker::Result result = picker.Pick(display[0] + 2, display[1] - 2, renderer);
+  if (!result.Picked || !result.Accelerated || result.Prop != cloudActor ||
+    vtkMath::Distance2BetweenPoints(result.Position, expected) > 1e-10)
+  {
+    std::cerr << "Unexpected pick of points\n";
+    return EXIT_FAILURE;
+  }
+
+  // hidden actors are not picked
+  cloudActor->VisibilityOff();
+  if (picker.Pick(display[0], display[1], renderer).Prop == cloudActor)
+  {
+    std::cerr << "Hidden actor has been picked\n";
+    return EXIT_FAILURE;
+  }
+
+  // after a render, only the visible actors are built, once their geometry is stable
+  points->SetPoint(0, 0.2, 0.1, 2.0);
+  points->Modified();
+  sphere->SetRadius(0.9);
+  sphere->Update();
+  picker.PrepareWhenStable(renderer);
+  for (int i = 0; i < 200 && !picker.IsReady(renderer); i++)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    picker.PrepareWhenStable(renderer);
+  }
+  if (!picker.IsReady(renderer) || !::CompareWithCellPicker(picker, renderer))
+  {
+    std::cerr << "Picking structure of a stable surface has not been built\n";
+    return EXIT_FAILURE;
+  }
+
+  cloudActor->VisibilityOn();
+  if (picker.IsReady(renderer))
+  {
+    std::cerr << "Picking structure of a hidden actor has been built\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,145 @@
+#include <vtkFloatArray.h>
+#include <vtkNew.h>
+#include <vtkSMPTools.h>
+
+#include "F3DSplatRadixSort.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+//----------------------------------------------------------------------------
+void GeneratePoints(vtkFloatArray* points, vtkIdType nbPoints)
+{
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<float> distribution(-10.f, 10.f);
+  points->SetNumberOfComponents(3);
+  points->SetNumberOfTuples(nbPoints);
+  float* data = points->GetPointer(0);
+  std::generate(data, data + 3 * nbPoints, [&]() { return distribution(generator); });
+}
+
+//----------------------------------------------------------------------------
+double Depth(vtkFloatArray* points, unsigned int index, const double direction[3])
+{
+  const float* p = points->GetPointer(3 * static_cast<vtkIdType>(index));
+  return p[0] * direction[0] + p[1] * direction[1] + p[2] * direction[2];
+}
+
+//----------------------------------------------------------------------------
+// Check that indices are a permutation sorted by increasing depth, up to the key quantization
+bool CheckSorted(
+  vtkFloatArray* points, const std::vector<unsigned int>& indices, const double direction[3])
+{
+  const vtkIdType nbPoints = points->GetNumberOfTuples();
+  if (static_cast<vtkIdType>(indices.size()) != nbPoints)
+  {
+    return false;
+  }
+
+  std::vector<bool> seen(nbPoints, false);
+  for (unsigned int index : indices)
+  {
+    if (static_cast<vtkIdType>(index) >= nbPoints || seen[index])
+    {
+      return false;
+    }
+    seen[index] = true;
+  }
+
+  // the depth range of points generated in [-10, 10] is at most 20 * sqrt(3),
+  // allow a few quantization steps of error
+  const double tolerance = 4.0 * 20.0 * std::sqrt(3.0) / (1 << F3DSplatRadixSort::KeyBits);
+  for (size_t i = 1; i < indices.size(); i++)
+  {
+    const double previous = ::Depth(points, indices[i - 1], direction);
+    if (previous > ::Depth(points, indices[i], direction) + tolerance)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Check that the depths of the sorted indices match the ones of a comparison sort,
+// up to the key quantization
+bool CheckAgainstComparisonSort(
+  vtkFloatArray* points, const std::vector<unsigned int>& indices, const double direction[3])
+{
+  const vtkIdType nbPoints = points->GetNumberOfTuples();
+  std::vector<double> depths(nbPoints);
+  for (vtkIdType i = 0; i < nbPoints; i++)
+  {
+    depths[i] = ::Depth(points, static_cast<unsigned int>(i), direction);
+  }
+  std::vector<double> expected = depths;
+  std::sort(expected.begin(), expected.end());
+
+  const double tolerance = 4.0 * 20.0 * std::sqrt(3.0) / (1 << F3DSplatRadixSort::KeyBits);
+  for (size_t i = 0; i < indices.size(); i++)
+  {
+    if (std::abs(depths[indices[i]] - expected[i]) > tolerance)
+    {
+      return false;
+    }
+  }
+  return indices.size() == expected.size();
+}
+}
+
+int TestF3DSplatRadixSort(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
+{
+  F3DSplatRadixSort sorter;
+  const double direction[3] = { 0.267261, 0.534522, -0.801784 };
+  const double otherDirection[3] = { -0.801784, 0.267261, 0.534522 };
+
+  // Correctness, including the sequential backend and a second sort reusing the buffers
+  vtkNew<vtkFloatArray> points;
+  ::GeneratePoints(points, 50000);
+  if (!::CheckSorted(points, sorter.Sort(points, direction), direction) ||
+    !::CheckAgainstComparisonSort(points, sorter.Sort(points, direction), direction) ||
+    !::CheckSorted(points, sorter.Sort(points, otherDirection), otherDirection))
+  {
+    std::cerr << "Splats are not sorted correctly\n";
+    return EXIT_FAILURE;
+  }
+
+  const std::string backend = vtkSMPTools::GetBackend();
+  vtkSMPTools::SetBackend("Sequential");
+  const std::vector<unsigned int> sequentialIndices = sorter.Sort(points, direction);
+  vtkSMPTools::SetBackend(backend.c_str());
+  if (sequentialIndices != sorter.Sort(points, direction))
+  {
+    std::cerr << "Sequential and parallel sorting differ\n";
+    return EXIT_FAILURE;
+  }
+
+  // Degenerate inputs
+  vtkNew<vtkFloatArray> empty;
+  empty->SetNumberOfComponents(3);
+  if (!sorter.Sort(empty, direction).empty())
+  {
+    std::cerr << "Unexpected indices for empty points\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkFloatArray> flat;
+  flat->SetNumberOfComponents(3);
+  flat->SetNumberOfTuples(10);
+  flat->FillValue(1.f);
+  std::vector<unsigned int> identity(10);
+  std::iota(identity.begin(), identity.end(), 0);
+  if (sorter.Sort(flat, direction) != identity)
+  {
+    std::cerr << "Sorting splats with the same depth is not stable\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -10,6 +10,7 @@ vtkF3DAndroidLogOutputWindow::vtkF3DAndroidLogOutputWindow() = default;
 
 void vtkF3DAndroidLogOutputWindow::DisplayText(const char* txt)
 {
+  std::scoped_lock lock(this->DisplayMutex);
   int prio = ANDROID_LOG_INFO;
   switch (this->GetCurrentMessageType())
   {
@@ -26,3 +27,27 @@ void vtkF3DAndroidLogOutputWindow::DisplayText(const char* txt)
 
   __android_log_print(prio, "F3DLog", "%s", txt);
 }
+
+void vtkF3DAndroidLogOutputWindow::DisplayErrorText(const char* txt)
+{
+  std::scoped_lock lock(this->DisplayMutex);
+  this->Superclass::DisplayErrorText(txt);
+}
+
+void vtkF3DAndroidLogOutputWindow::DisplayWarningText(const char* txt)
+{
+  std::scoped_lock lock(this->DisplayMutex);
+  this->Superclass::DisplayWarningText(txt);
+}
+
+void vtkF3DAndroidLogOutputWindow::DisplayGenericWarningText(const char* txt)
+{
+  std::scoped_lock lock(this->DisplayMutex);
+  this->Superclass::DisplayGenericWarningText(txt);
+}
+
+void vtkF3DAndroidLogOutputWindow::DisplayDebugText(const char* txt)
+{
+  std::scoped_lock lock(this->DisplayMutex);
+  this->Superclass::DisplayDebugText(txt);
+}
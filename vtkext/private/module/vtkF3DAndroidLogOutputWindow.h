@@ -8,6 +8,8 @@
 
 #include "vtkOutputWindow.h"
 
+#include <mutex>
+
 class vtkF3DAndroidLogOutputWindow : public vtkOutputWindow
 {
 public:
@@ -20,10 +22,23 @@ public:
    */
   void DisplayText(const char*) override;
 
+  ///@{
+  /**
+   * Reimplemented to serialize the display of messages, including their message type,
+   * as importers can be read concurrently
+   */
+  void DisplayErrorText(const char*) override;
+  void DisplayWarningText(const char*) override;
+  void DisplayGenericWarningText(const char*) override;
+  void DisplayDebugText(const char*) override;
+  ///@}
+
 protected:
   vtkF3DAndroidLogOutputWindow();
   ~vtkF3DAndroidLogOutputWindow() override = default;
 
+  std::recursive_mutex DisplayMutex;
+
 private:
   vtkF3DAndroidLogOutputWindow(const vtkF3DAndroidLogOutputWindow&) = delete;
   void operator=(const vtkF3DAndroidLogOutputWindow&) = delete;
@@ -1,12 +1,12 @@
 #include "vtkF3DCachedLUTTexture.h"
 
-#include <vtkImageData.h>
+#include "F3DHDRICache.h"
+
 #include <vtkObjectFactory.h>
 #include <vtkOpenGLRenderWindow.h>
 #include <vtkRenderer.h>
 #include <vtkTextureObject.h>
 #include <vtkVersion.h>
-#include <vtkXMLImageDataReader.h>
 #include <vtk_glad.h>
 
 vtkStandardNewMacro(vtkF3DCachedLUTTexture);
@@ -49,26 +49,21 @@ void vtkF3DCachedLUTTexture::Load(vtkRenderer* ren)
     this->TextureObject->SetMinificationFilter(vtkTextureObject::Linear);
     this->TextureObject->SetMagnificationFilter(vtkTextureObject::Linear);
 
-    vtkNew<vtkXMLImageDataReader> reader;
-    reader->SetFileName(this->FileName.c_str());
-    reader->Update();
-
-    vtkImageData* img = reader->GetOutput();
-    int dims[3];
-    img->GetDimensions(dims);
-    if (dims[0] != dims[1])
+    // an invalid cache is a cache miss, the texture is computed instead
+    F3DHDRICache cache;
+    if (!cache.Open(this->FileName) || !cache.HasLayout(1, 2))
     {
-      vtkWarningMacro("LUT cache has unexpected dimensions");
+      vtkWarningMacro("Invalid LUT cache " << this->FileName << ", recomputing it");
+      this->UseCache = false;
+      return this->Superclass::Load(ren);
     }
-    this->LUTSize = dims[0];
 
-#ifdef GL_ES_VERSION_3_0
-    this->TextureObject->Create2DFromRaw(
-      this->LUTSize, this->LUTSize, 2, VTK_UNSIGNED_CHAR, img->GetScalarPointer());
-#else
-    this->TextureObject->Create2DFromRaw(
-      this->LUTSize, this->LUTSize, 2, VTK_UNSIGNED_SHORT, img->GetScalarPointer());
-#endif
+    const F3DHDRICache::TextureInfo& info = cache.GetTextureInfo();
+    this->LUTSize = info.Size;
+
+    // texels are uploaded straight from the mapped file
+    this->TextureObject->Create2DFromRaw(this->LUTSize, this->LUTSize, 2, info.DataType,
+      const_cast<void*>(cache.GetFace(0, 0)));
 
     this->RenderWindow = renWin;
     this->LoadTime.Modified();
@@ -1,6 +1,6 @@
 /**
  * @class   vtkF3DCachedLUTTexture
- * @brief   create a LUT texture from a vti file
+ * @brief   create a LUT texture from a binary HDRI cache file
  */
 
 #ifndef vtkF3DCachedLUTTexture_h
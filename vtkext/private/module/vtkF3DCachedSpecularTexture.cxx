@@ -1,15 +1,16 @@
 #include "vtkF3DCachedSpecularTexture.h"
 
-#include <vtkImageData.h>
-#include <vtkMultiBlockDataSet.h>
+#include "F3DHDRICache.h"
+
 #include <vtkObjectFactory.h>
 #include <vtkOpenGLRenderWindow.h>
 #include <vtkRenderer.h>
 #include <vtkTextureObject.h>
 #include <vtkVersion.h>
-#include <vtkXMLMultiBlockDataReader.h>
 #include <vtk_glad.h>
 
+#include <algorithm>
+
 vtkStandardNewMacro(vtkF3DCachedSpecularTexture);
 
 //------------------------------------------------------------------------------
@@ -54,45 +55,39 @@ void vtkF3DCachedSpecularTexture::Load(vtkRenderer* ren)
 
     this->RenderWindow = renWin;
 
-    vtkNew<vtkXMLMultiBlockDataReader> reader;
-    reader->SetFileName(this->FileName.c_str());
-    reader->Update();
-
-    vtkMultiBlockDataSet* mb = vtkMultiBlockDataSet::SafeDownCast(reader->GetOutput());
-
-    unsigned int nbLevels = mb->GetNumberOfBlocks();
-
-    this->TextureObject->SetMaxLevel(static_cast<int>(nbLevels) - 1);
+    // an invalid cache is a cache miss, the texture is computed instead
+    F3DHDRICache cache;
+    if (!cache.Open(this->FileName) || !cache.HasLayout(6, 3))
+    {
+      vtkWarningMacro("Invalid specular cache " << this->FileName << ", recomputing it");
+      this->UseCache = false;
+      return this->Superclass::Load(ren);
+    }
 
-    vtkImageData* firstImg = vtkImageData::SafeDownCast(mb->GetBlock(0));
+    const F3DHDRICache::TextureInfo& info = cache.GetTextureInfo();
+    this->TextureObject->SetMaxLevel(static_cast<int>(info.Levels) - 1);
 
+    // texels are uploaded straight from the mapped file
     void* data[6];
-    for (int i = 0; i < 6; i++)
+    for (unsigned int i = 0; i < 6; i++)
     {
-      data[i] = firstImg->GetScalarPointer(0, 0, i);
+      data[i] = const_cast<void*>(cache.GetFace(0, i));
     }
 
-    const int* firstDims = firstImg->GetDimensions();
-    if (firstDims[0] != firstDims[1])
-    {
-      vtkWarningMacro("Specular cache has unexpected dimensions");
-    }
-    this->PrefilterSize = firstDims[0];
+    this->PrefilterSize = info.Size;
     this->TextureObject->CreateCubeFromRaw(
-      this->PrefilterSize, this->PrefilterSize, 3, VTK_FLOAT, data);
+      this->PrefilterSize, this->PrefilterSize, 3, info.DataType, data);
 
     // the mip levels are manually uploaded because there is no abstraction in VTK
-    for (unsigned int i = 1; i < nbLevels; i++)
+    for (unsigned int i = 1; i < info.Levels; i++)
     {
-      vtkImageData* img = vtkImageData::SafeDownCast(mb->GetBlock(i));
-      int* dims = img->GetDimensions();
-
-      for (int j = 0; j < 6; j++)
+      const GLsizei size = static_cast<GLsizei>(std::max(info.Size >> i, 1u));
+      for (unsigned int j = 0; j < 6; j++)
       {
         glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + j, static_cast<GLint>(i),
-          this->TextureObject->GetInternalFormat(VTK_FLOAT, 3, false), static_cast<GLint>(dims[0]),
-          static_cast<GLint>(dims[1]), 0, this->TextureObject->GetFormat(VTK_FLOAT, 3, false),
-          this->TextureObject->GetDataType(VTK_FLOAT), img->GetScalarPointer(0, 0, j));
+          this->TextureObject->GetInternalFormat(info.DataType, 3, false), size, size, 0,
+          this->TextureObject->GetFormat(info.DataType, 3, false),
+          this->TextureObject->GetDataType(info.DataType), cache.GetFace(i, j));
       }
     }
 
@@ -1,6 +1,6 @@
 /**
  * @class   vtkF3DCachedSpecularTexture
- * @brief   create a prefiltered specular texture from a vtm file
+ * @brief   create a prefiltered specular texture from a binary HDRI cache file
  */
 
 #ifndef vtkF3DCachedSpecularTexture_h
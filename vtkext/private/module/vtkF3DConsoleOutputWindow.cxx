@@ -12,6 +12,7 @@ vtkF3DConsoleOutputWindow::vtkF3DConsoleOutputWindow() = default;
 //----------------------------------------------------------------------------
 void vtkF3DConsoleOutputWindow::DisplayText(const char* txt)
 {
+  std::scoped_lock lock(this->DisplayMutex);
   std::string fmtText;
 
   if (this->UseColoring)
@@ -54,3 +55,31 @@ void vtkF3DConsoleOutputWindow::DisplayText(const char* txt)
       break;
   }
 }
+
+//----------------------------------------------------------------------------
+void vtkF3DConsoleOutputWindow::DisplayErrorText(const char* txt)
+{
+  std::scoped_lock lock(this->DisplayMutex);
+  this->Superclass::DisplayErrorText(txt);
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DConsoleOutputWindow::DisplayWarningText(const char* txt)
+{
+  std::scoped_lock lock(this->DisplayMutex);
+  this->Superclass::DisplayWarningText(txt);
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DConsoleOutputWindow::DisplayGenericWarningText(const char* txt)
+{
+  std::scoped_lock lock(this->DisplayMutex);
+  this->Superclass::DisplayGenericWarningText(txt);
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DConsoleOutputWindow::DisplayDebugText(const char* txt)
+{
+  std::scoped_lock lock(this->DisplayMutex);
+  this->Superclass::DisplayDebugText(txt);
+}
@@ -2,6 +2,8 @@
  * @class   vtkF3DConsoleOutputWindow
  * @brief   Custom console output window
  *
+ * Messages can be displayed from importers read concurrently by vtkF3DMetaImporter,
+ * so displaying a message is serialized, including its message type.
  */
 #ifndef vtkF3DConsoleOutputWindow_h
 #define vtkF3DConsoleOutputWindow_h
@@ -10,6 +12,8 @@
 
 #include <vtkCommand.h>
 
+#include <mutex>
+
 class vtkF3DConsoleOutputWindow : public vtkOutputWindow
 {
 public:
@@ -21,6 +25,16 @@ public:
    */
   void DisplayText(const char*) override;
 
+  ///@{
+  /**
+   * Reimplemented to serialize the display of messages
+   */
+  void DisplayErrorText(const char*) override;
+  void DisplayWarningText(const char*) override;
+  void DisplayGenericWarningText(const char*) override;
+  void DisplayDebugText(const char*) override;
+  ///@}
+
   //@{
   /**
    * Set/Get the coloring usage.
@@ -37,6 +51,11 @@ protected:
   vtkF3DConsoleOutputWindow();
   ~vtkF3DConsoleOutputWindow() override = default;
 
+  /**
+   * Recursive as the Display*Text methods call DisplayText
+   */
+  std::recursive_mutex DisplayMutex;
+
 private:
   bool UseColoring = true;
 };
@@ -211,8 +211,9 @@ void vtkF3DGenericImporter::ImportActors(vtkRenderer* ren)
   this->Pimpl->Reader->AddObserver(vtkCommand::ProgressEvent, progressForwarder);
   bool status = this->Pimpl->Reader->GetExecutive()->Update();
 
+  // An aborted reader output is incomplete
   vtkDataObject* output = this->Pimpl->Reader->GetOutputDataObject(0);
-  if (!status || !output)
+  if (!status || !output || this->Pimpl->Reader->GetAbortExecute())
   {
     this->SetFailureStatus();
     return;
@@ -288,6 +289,12 @@ void vtkF3DGenericImporter::SetInternalReader(vtkAlgorithm* reader)
   }
 }
 
+//----------------------------------------------------------------------------
+vtkAlgorithm* vtkF3DGenericImporter::GetInternalReader()
+{
+  return this->Pimpl->Reader;
+}
+
 //----------------------------------------------------------------------------
 std::string vtkF3DGenericImporter::GetOutputsDescription()
 {
@@ -378,6 +385,14 @@ bool vtkF3DGenericImporter::UpdateAtTimeValue(double timeValue)
 
   vtkInformation* info = this->Pimpl->Reader->GetOutputInformation(0);
   info->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(), timeValue);
+  return this->UpdateReader();
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DGenericImporter::UpdateReader()
+{
+  assert(this->Pimpl->Reader);
+
   bool status = this->Pimpl->Reader->GetExecutive()->Update();
 
   vtkDataObject* output = this->Pimpl->Reader->GetOutputDataObject(0);
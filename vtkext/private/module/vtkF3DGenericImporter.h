@@ -29,6 +29,11 @@ public:
    */
   void SetInternalReader(vtkAlgorithm* reader);
 
+  /**
+   * Get the internal reader
+   */
+  vtkAlgorithm* GetInternalReader();
+
   /**
    * Get a string describing the outputs
    */
@@ -49,6 +54,12 @@ public:
    */
   bool UpdateAtTimeValue(double timeValue) override;
 
+  /**
+   * Update internal reader at its current time, even if animation is not enabled,
+   * to recover the data when it has been modified outside of the animation
+   */
+  bool UpdateReader();
+
   /**
    * Get the level of animation support in this importer, which is always
    * AnimationSupportLevel::UNIQUE
@@ -9,10 +9,10 @@
 #include "vtkF3DRenderer.h"
 #include "vtkF3DUserEvents.h"
 
+#include <vtkActorCollection.h>
 #include <vtkCallbackCommand.h>
 #include <vtkCommand.h>
 #include <vtkDataAssembly.h>
-#include <vtkDataAssemblyVisitor.h>
 #include <vtkImageData.h>
 #include <vtkInformation.h>
 #include <vtkObjectFactory.h>
@@ -40,6 +40,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstdint>
 #include <functional>
 #include <iomanip>
@@ -78,160 +79,65 @@ static std::vector<std::string> SplitBindings(const std::string& s, const char d
 }
 
 /**
- * Visitor used to traverse a subtree when a checkbox is toggled.
- * It will add an attribute `f3d_visible` on each node to the value of the checkbox.
- * It will also add (or remove) a `ACTOR_HIDDEN()` information key on nodes associated with actors.
+ * A node of a scene hierarchy flattened in depth-first order,
+ * so that the subtree of a node is the range of nodes from it to its SubtreeEnd.
  */
-class vtkF3DVisibilityDataAssemblyVisitor : public vtkDataAssemblyVisitor
+struct HierarchyNode
 {
-public:
-  static vtkF3DVisibilityDataAssemblyVisitor* New();
-  vtkTypeMacro(vtkF3DVisibilityDataAssemblyVisitor, vtkDataAssemblyVisitor);
-
-  void SetVisibleAttribute(int visible)
-  {
-    this->Visible = visible;
-  }
-
-  void SetImporter(vtkImporter* importer)
-  {
-    this->Importer = importer;
-  }
-
-protected:
-  void Visit(int nodeid) override
-  {
-    // add the visibility state in the current node
-    // `GetAssembly()` is a const method, but we need to modify it, so the cast is needed
-    vtkDataAssembly* mutableAssembly = const_cast<vtkDataAssembly*>(this->GetAssembly());
-    mutableAssembly->SetAttribute(nodeid, "f3d_visible", this->Visible);
-
-    const int flatActorIndex =
-      this->GetAssembly()->GetAttributeOrDefault(nodeid, "flat_actor_id", -1);
-
-    if (flatActorIndex >= 0)
-    {
-      vtkActorCollection* actors = this->Importer->GetImportedActors();
-      vtkActor* actor = vtkActor::SafeDownCast(actors->GetItemAsObject(flatActorIndex));
-
-      vtkSmartPointer<vtkInformation> keys = actor->GetPropertyKeys();
-
-      // if there's no property keys yet, create one
-      if (!keys)
-      {
-        keys = vtkSmartPointer<vtkInformation>::New();
-        actor->SetPropertyKeys(keys);
-      }
-
-      // this key will be used in the renderer to know if the actor rendering should be skipped
-      if (this->Visible == 1)
-      {
-        keys->Remove(vtkF3DMetaImporter::ACTOR_HIDDEN());
-      }
-      else
-      {
-        keys->Set(vtkF3DMetaImporter::ACTOR_HIDDEN(), 1);
-      }
-    }
-  }
-
-private:
-  int Visible = 0;
-  vtkImporter* Importer = nullptr;
+  int NodeId = 0;
+  int Parent = -1;
+  int SubtreeEnd = 0;
+  int Depth = 0;
+  bool LastChild = true;
+  bool Open = true;
+  bool Visible = true;
+  vtkActor* Actor = nullptr;
+  std::string Label;
 };
-vtkStandardNewMacro(vtkF3DVisibilityDataAssemblyVisitor);
 
 /**
- * Visitor used to traverse a full tree (one per importer).
- * It will take care of rendering the tree with imgui.
- * If a checkbox is toggled, it triggers another traversal of a subtree to change the internal
- * state.
+ * The flattened scene hierarchy of an importer, valid as long as the assembly is not modified
+ * by someone else
  */
-class vtkF3DRenderDataAssemblyVisitor : public vtkDataAssemblyVisitor
+struct Hierarchy
 {
-public:
-  static vtkF3DRenderDataAssemblyVisitor* New();
-  vtkTypeMacro(vtkF3DRenderDataAssemblyVisitor, vtkDataAssemblyVisitor);
-
-  void SetRenderWindow(vtkOpenGLRenderWindow* renWin)
-  {
-    this->RenderWindow = renWin;
-  }
-
-  void SetImporter(vtkImporter* importer)
-  {
-    this->Importer = importer;
-  }
-
-  void SetImporterIndex(int index)
-  {
-    this->ImporterId = index;
-  }
-
-protected:
-  void EndSubTree(int vtkNotUsed(nodeid)) override
-  {
-    ImGui::TreePop();
-  }
-
-  bool GetTraverseSubtree(int vtkNotUsed(nodeid)) override
-  {
-    return this->CurrentNodeOpened;
-  }
+  vtkSmartPointer<vtkImporter> Importer;
+  vtkSmartPointer<vtkDataAssembly> Assembly;
+  vtkMTimeType AssemblyMTime = 0;
+  std::vector<HierarchyNode> Nodes;
+};
 
-  void Visit(int nodeid) override
+/**
+ * Append the subtree of a node of the assembly to the flattened nodes, linking the nodes
+ * to the imported actors using their `flat_actor_id` attribute
+ */
+void FlattenHierarchy(vtkDataAssembly* assembly, int nodeid, int depth,
+  const std::vector<vtkActor*>& actors, std::vector<HierarchyNode>& nodes)
+{
+  const std::vector<int> children = assembly->GetChildNodes(nodeid, false);
+  const int index = static_cast<int>(nodes.size());
+  const int actorIndex = assembly->GetAttributeOrDefault(nodeid, "flat_actor_id", -1);
+
+  HierarchyNode& node = nodes.emplace_back();
+  node.NodeId = nodeid;
+  node.Depth = depth;
+  node.Open = assembly->GetAttributeOrDefault(nodeid, "f3d_collapsed", 0) == 0;
+  node.Visible = assembly->GetAttributeOrDefault(nodeid, "f3d_visible", 1) != 0;
+  node.Actor = actorIndex >= 0 && actorIndex < static_cast<int>(actors.size())
+    ? actors[actorIndex]
+    : nullptr;
+  node.Label =
+    assembly->GetAttributeOrDefault(nodeid, "label", children.empty() ? "<object>" : "<group>");
+
+  for (size_t i = 0; i < children.size(); i++)
   {
-    int flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_DrawLinesToNodes;
-
-    if (!this->GetAssembly()->GetAttributeOrDefault(nodeid, "f3d_collapsed", 0))
-    {
-      flags |= ImGuiTreeNodeFlags_DefaultOpen;
-    }
-
-    if (this->GetAssembly()->GetNumberOfChildren(nodeid) == 0)
-    {
-      flags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_Bullet;
-    }
-
-    // this is only used internally by imgui, it must be unique
-    const int uuid = (this->ImporterId << 16) + nodeid;
-
-    ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(0, 0));
-    this->CurrentNodeOpened = ImGui::TreeNodeEx(("##tree_" + std::to_string(uuid)).c_str(), flags);
-
-    ImGui::SameLine();
-
-    // get the current visibility state
-    bool visible = (this->GetAssembly()->GetAttributeOrDefault(nodeid, "f3d_visible", 1) != 0);
-
-    const char* defaultLabel =
-      this->GetAssembly()->GetNumberOfChildren(nodeid) > 0 ? "<group>" : "<object>";
-
-    ImGui::PushID(uuid);
-    if (ImGui::Checkbox(
-          this->GetAssembly()->GetAttributeOrDefault(nodeid, "label", defaultLabel), &visible))
-    {
-      // if the checkbox is toggled, trigger a traversal of the subtree to change each node state
-      vtkNew<vtkF3DVisibilityDataAssemblyVisitor> attrVisitor;
-      attrVisitor->SetImporter(this->Importer);
-      attrVisitor->SetVisibleAttribute(visible ? 1 : 0);
-      this->GetAssembly()->Visit(nodeid, attrVisitor);
-
-      this->RenderWindow->GetInteractor()->InvokeEvent(
-        vtkF3DUserEvents::SceneHierarchyChangedEvent, nullptr);
-    }
-
-    ImGui::PopID();
-    ImGui::PopStyleVar();
+    const int child = static_cast<int>(nodes.size());
+    ::FlattenHierarchy(assembly, children[i], depth + 1, actors, nodes);
+    nodes[child].Parent = index;
+    nodes[child].LastChild = i + 1 == children.size();
   }
-
-private:
-  bool CurrentNodeOpened = true;
-  vtkOpenGLRenderWindow* RenderWindow = nullptr;
-  vtkImporter* Importer = nullptr;
-  int ImporterId = -1;
-};
-vtkStandardNewMacro(vtkF3DRenderDataAssemblyVisitor);
+  nodes[index].SubtreeEnd = static_cast<int>(nodes.size());
+}
 
 }
 
@@ -433,6 +339,186 @@ struct vtkF3DImguiActor::Internals
     this->LogoTexture->Deactivate();
   }
 
+  /**
+   * Flatten the scene hierarchies of the importers that have been updated since the last call,
+   * and update the rows to display if needed
+   */
+  void UpdateHierarchies(vtkF3DMetaImporter* importer)
+  {
+    const int count = importer->GetImporterInfoCount();
+    if (static_cast<int>(this->Hierarchies.size()) != count)
+    {
+      this->Hierarchies.resize(count);
+      this->HierarchyRowsModified = true;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+      const vtkF3DMetaImporter::ImporterInfo info = importer->GetImporterInfo(i);
+      ::Hierarchy& hierarchy = this->Hierarchies[i];
+      if (hierarchy.Importer == info.Importer && hierarchy.Assembly == info.DataAssembly &&
+        hierarchy.AssemblyMTime == info.DataAssembly->GetMTime())
+      {
+        continue;
+      }
+
+      std::vector<vtkActor*> actors;
+      vtkActorCollection* collection = info.Importer->GetImportedActors();
+      vtkCollectionSimpleIterator it;
+      collection->InitTraversal(it);
+      while (vtkActor* actor = collection->GetNextActor(it))
+      {
+        actors.emplace_back(actor);
+      }
+
+      hierarchy.Importer = info.Importer;
+      hierarchy.Assembly = info.DataAssembly;
+      hierarchy.Nodes.clear();
+      ::FlattenHierarchy(
+        hierarchy.Assembly, vtkDataAssembly::GetRootNode(), 0, actors, hierarchy.Nodes);
+      hierarchy.AssemblyMTime = hierarchy.Assembly->GetMTime();
+      this->HierarchyRowsModified = true;
+    }
+
+    if (this->HierarchyRowsModified)
+    {
+      // descendants of collapsed nodes are skipped
+      this->HierarchyRows.clear();
+      for (int i = 0; i < count; i++)
+      {
+        const std::vector<::HierarchyNode>& nodes = this->Hierarchies[i].Nodes;
+        for (int n = 0; n < static_cast<int>(nodes.size());
+             n = nodes[n].Open ? n + 1 : nodes[n].SubtreeEnd)
+        {
+          this->HierarchyRows.emplace_back(i, n);
+        }
+      }
+      this->HierarchyRowsModified = false;
+    }
+  }
+
+  /**
+   * Show or hide a node of a hierarchy and all its descendants,
+   * using a `f3d_visible` attribute on the nodes and a `ACTOR_HIDDEN()` information key
+   * on their actors
+   */
+  void SetHierarchyVisibility(::Hierarchy& hierarchy, int index, bool visible)
+  {
+    for (int i = index; i < hierarchy.Nodes[index].SubtreeEnd; i++)
+    {
+      ::HierarchyNode& node = hierarchy.Nodes[i];
+      node.Visible = visible;
+      hierarchy.Assembly->SetAttribute(node.NodeId, "f3d_visible", visible ? 1 : 0);
+
+      if (node.Actor)
+      {
+        vtkSmartPointer<vtkInformation> keys = node.Actor->GetPropertyKeys();
+
+        // if there's no property keys yet, create one
+        if (!keys)
+        {
+          keys = vtkSmartPointer<vtkInformation>::New();
+          node.Actor->SetPropertyKeys(keys);
+        }
+
+        // this key will be used in the renderer to know if the actor rendering should be skipped
+        if (visible)
+        {
+          keys->Remove(vtkF3DMetaImporter::ACTOR_HIDDEN());
+        }
+        else
+        {
+          keys->Set(vtkF3DMetaImporter::ACTOR_HIDDEN(), 1);
+        }
+      }
+    }
+
+    // the hierarchy is still valid
+    hierarchy.AssemblyMTime = hierarchy.Assembly->GetMTime();
+  }
+
+  /**
+   * Render a row of the scene hierarchy panel: the lines to the parent node, the tree node
+   * and the visibility checkbox
+   */
+  void RenderHierarchyRow(vtkOpenGLRenderWindow* renWin, int hierarchyIndex, int index)
+  {
+    ::Hierarchy& hierarchy = this->Hierarchies[hierarchyIndex];
+    ::HierarchyNode& node = hierarchy.Nodes[index];
+    const ImGuiStyle& style = ImGui::GetStyle();
+    const float indent = style.IndentSpacing;
+
+    // rows are not nested, so the lines connecting the nodes are drawn manually, at the same
+    // positions than the ones drawn by ImGuiTreeNodeFlags_DrawLinesToNodes for nested tree nodes
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    if (node.Parent >= 0)
+    {
+      ImDrawList* drawList = ImGui::GetWindowDrawList();
+      const ImU32 color = ImGui::GetColorU32(ImGuiCol_TreeLines);
+      const float thickness = style.TreeLinesSize;
+      const float fontSize = ImGui::GetFontSize();
+      const float top = origin.y - style.ItemSpacing.y;
+      const float bottom = origin.y + ImGui::GetFrameHeight();
+      const float center = std::trunc(origin.y + fontSize * 0.5f);
+      auto lineX = [&](int depth)
+      { return std::trunc(origin.x + depth * indent + fontSize * 0.5f); };
+
+      // line from the parent, which ends at the last child
+      const float parentX = lineX(node.Depth - 1);
+      const float nodeX = std::trunc(origin.x + node.Depth * indent - style.ItemInnerSpacing.x);
+      if (parentX < nodeX)
+      {
+        drawList->AddLineH(parentX, nodeX, center, color, thickness);
+      }
+      drawList->AddLineV(parentX, top, node.LastChild ? center : bottom, color, thickness);
+
+      // lines of the ancestors with following siblings
+      for (int ancestor = node.Parent; hierarchy.Nodes[ancestor].Parent >= 0;
+           ancestor = hierarchy.Nodes[ancestor].Parent)
+      {
+        if (!hierarchy.Nodes[ancestor].LastChild)
+        {
+          drawList->AddLineV(
+            lineX(hierarchy.Nodes[ancestor].Depth - 1), top, bottom, color, thickness);
+        }
+      }
+    }
+
+    ImGui::PushID(hierarchyIndex);
+    ImGui::PushID(index);
+    ImGui::SetCursorScreenPos(ImVec2(origin.x + node.Depth * indent, origin.y));
+
+    const bool leaf = node.SubtreeEnd == index + 1;
+    int flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+    if (leaf)
+    {
+      flags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_Bullet;
+    }
+
+    ImGui::SetNextItemOpen(node.Open);
+    const bool open = ImGui::TreeNodeEx("##tree", flags);
+    if (!leaf && open != node.Open)
+    {
+      // the collapsed state is kept in the assembly so that it survives a new flattening
+      node.Open = open;
+      hierarchy.Assembly->SetAttribute(node.NodeId, "f3d_collapsed", open ? 0 : 1);
+      hierarchy.AssemblyMTime = hierarchy.Assembly->GetMTime();
+      this->HierarchyRowsModified = true;
+    }
+
+    ImGui::SameLine();
+
+    bool visible = node.Visible;
+    if (ImGui::Checkbox(node.Label.c_str(), &visible))
+    {
+      this->SetHierarchyVisibility(hierarchy, index, visible);
+      renWin->GetInteractor()->InvokeEvent(vtkF3DUserEvents::SceneHierarchyChangedEvent, nullptr);
+    }
+
+    ImGui::PopID();
+    ImGui::PopID();
+  }
+
   vtkSmartPointer<vtkTextureObject> FontTexture;
   vtkSmartPointer<vtkOpenGLVertexArrayObject> VertexArray;
   vtkSmartPointer<vtkOpenGLBufferObject> VertexBuffer;
@@ -451,6 +537,11 @@ struct vtkF3DImguiActor::Internals
   bool SearchFocusRequested = false;
   float CheatSheetWidth = 0.f;
   std::map<std::string, ImFont*> ExtraFonts;
+
+  // scene hierarchies of the importers, and the rows to display as hierarchy and node indices
+  std::vector<::Hierarchy> Hierarchies;
+  std::vector<std::pair<int, int>> HierarchyRows;
+  bool HierarchyRowsModified = true;
 };
 
 namespace
@@ -623,17 +714,22 @@ void vtkF3DImguiActor::RenderSceneHierarchy(vtkOpenGLRenderWindow* renWin)
   vtkF3DMetaImporter* importer = ren->GetMetaImporter();
   assert(importer != nullptr);
 
-  for (int i = 0; i < importer->GetImporterInfoCount(); i++)
-  {
-    vtkF3DMetaImporter::ImporterInfo info = importer->GetImporterInfo(i);
-
-    vtkNew<::vtkF3DRenderDataAssemblyVisitor> visitor;
-    visitor->SetRenderWindow(renWin);
-    visitor->SetImporter(info.Importer);
-    visitor->SetImporterIndex(i);
+  // hierarchies are flattened when updated, and only the visible rows are rendered,
+  // so that large hierarchies do not slow down the rendering
+  this->Pimpl->UpdateHierarchies(importer);
 
-    info.DataAssembly->Visit(vtkDataAssembly::GetRootNode(), visitor);
+  ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(0, 0));
+  ImGuiListClipper clipper;
+  clipper.Begin(static_cast<int>(this->Pimpl->HierarchyRows.size()));
+  while (clipper.Step())
+  {
+    for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+    {
+      const auto [hierarchyIndex, index] = this->Pimpl->HierarchyRows[row];
+      this->Pimpl->RenderHierarchyRow(renWin, hierarchyIndex, index);
+    }
   }
+  ImGui::PopStyleVar();
 
   ImGui::End();
 }
@@ -1187,6 +1283,66 @@ void vtkF3DImguiActor::RenderFpsCounter()
   ImGui::End();
 }
 
+//----------------------------------------------------------------------------
+void vtkF3DImguiActor::RenderFrameStats()
+{
+  const ImGuiViewport* viewport = ImGui::GetMainViewport();
+
+  constexpr float margin = F3DStyle::GetDefaultMargin();
+
+  // one line per pass, indented by depth, times are exclusive of the nested passes
+  const auto formatTime = [](double time)
+  {
+    std::ostringstream oss;
+    oss << std::setw(8);
+    if (time >= 0.0)
+    {
+      oss << std::fixed << std::setprecision(2) << time * 1000.0;
+    }
+    else
+    {
+      oss << "-";
+    }
+    return oss.str();
+  };
+
+  std::ostringstream stream;
+  stream << std::left << std::setw(20) << "Pass" << std::right << std::setw(8) << "CPU ms"
+         << std::setw(8) << "GPU ms";
+  for (const F3DFrameProfiler::PassStats& pass : this->FrameStats.Passes)
+  {
+    stream << "\n"
+           << std::left << std::setw(20) << std::string(2 * pass.Depth, ' ') + pass.Name
+           << std::right << formatTime(pass.CPUTime) << formatTime(pass.GPUTime);
+  }
+  stream << "\n"
+         << std::left << std::setw(20) << "Frame" << std::right
+         << formatTime(this->FrameStats.CPUTime) << formatTime(this->FrameStats.GPUTime);
+  const std::string statsString = stream.str();
+
+  ImVec2 winSize = ImGui::CalcTextSize(statsString.c_str());
+  winSize.x += 2.f * ImGui::GetStyle().WindowPadding.x;
+  winSize.y += 2.f * ImGui::GetStyle().WindowPadding.y;
+
+  float posY = margin;
+  if (this->FpsCounterVisible)
+  {
+    posY += ImGui::GetTextLineHeight() + 2.f * ImGui::GetStyle().WindowPadding.y + margin;
+  }
+
+  ::SetupNextWindow(ImVec2(viewport->WorkSize.x - winSize.x - margin, posY), winSize);
+  ImGuiStyle& style = ImGui::GetStyle();
+  style.Colors[ImGuiCol_WindowBg] = ImVec4(
+    this->BackdropColor[0], this->BackdropColor[1], this->BackdropColor[2], this->BackdropOpacity);
+
+  ImGuiWindowFlags flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoSavedSettings |
+    ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoMove;
+
+  ImGui::Begin("FrameStats", nullptr, flags);
+  ImGui::TextUnformatted(statsString.c_str());
+  ImGui::End();
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DImguiActor::RenderAnimationProgressBar()
 {
@@ -91,6 +91,11 @@ private:
    */
   void RenderFpsCounter() override;
 
+  /**
+   * Render the frame stats UI widget, below the fps counter
+   */
+  void RenderFrameStats() override;
+
   /**
    * Render the animation progress bar at the bottom of the viewport.
    */
@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <mutex>
 
 struct vtkF3DImguiConsole::Internals
 {
@@ -26,6 +27,7 @@ struct vtkF3DImguiConsole::Internals
   };
 
   std::vector<std::pair<LogType, std::string>> Logs;
+  std::mutex LogsMutex; // Logs can be added from importers read concurrently
   std::array<char, 2048> CurrentInput = {};
   bool NewError = false;
   bool NewWarning = false;
@@ -219,9 +221,11 @@ vtkF3DImguiConsole::~vtkF3DImguiConsole() = default;
 //----------------------------------------------------------------------------
 void vtkF3DImguiConsole::DisplayText(const char* text)
 {
+  std::scoped_lock displayLock(this->DisplayMutex);
   MessageTypes type = this->GetCurrentMessageType();
   if (this->GetDisplayStream(type) != StreamType::Null)
   {
+    std::scoped_lock lock(this->Pimpl->LogsMutex);
     switch (type)
     {
       case vtkOutputWindow::MESSAGE_TYPE_ERROR:
@@ -297,6 +301,7 @@ void vtkF3DImguiConsole::ShowConsole(bool minimal)
           "LogRegion", ImVec2(0, -reservedHeight), 0, ImGuiWindowFlags_HorizontalScrollbar))
     {
       ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(4, 1)); // Tighten spacing
+      std::scoped_lock lock(this->Pimpl->LogsMutex);
       for (const auto& [severity, msg] : this->Pimpl->Logs)
       {
         bool hasColor = true;
@@ -456,6 +461,7 @@ ImVec2 vtkF3DImguiConsole::GetBadgeSize()
 //----------------------------------------------------------------------------
 void vtkF3DImguiConsole::Clear()
 {
+  std::scoped_lock lock(this->Pimpl->LogsMutex);
   this->Pimpl->Logs.clear();
   this->Pimpl->NewError = false;
   this->Pimpl->NewWarning = false;
@@ -1,12 +1,20 @@
 #include "vtkF3DMemoryMesh.h"
 
+#include "vtkDataArray.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
+#include "vtkInformationIdTypeKey.h"
+#include "vtkInformationObjectBaseKey.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 vtkStandardNewMacro(vtkF3DMemoryMesh);
 
+vtkInformationKeyMacro(vtkF3DMemoryMesh, DIRTY_RANGES, ObjectBase);
+vtkInformationKeyMacro(vtkF3DMemoryMesh, DIRTY_RANGES_BASE_MTIME, IdType);
+vtkInformationKeyMacro(vtkF3DMemoryMesh, DIRTY_RANGES_MTIME, IdType);
+
 //------------------------------------------------------------------------------
 vtkF3DMemoryMesh::vtkF3DMemoryMesh()
 {
@@ -29,6 +37,61 @@ void vtkF3DMemoryMesh::SetUpdateFunction(std::function<void(double, vtkPolyData*
   this->UpdateFunction = std::move(updateFunction);
 }
 
+//------------------------------------------------------------------------------
+void vtkF3DMemoryMesh::SetDirtyRanges(
+  vtkDataArray* array, const std::vector<std::array<vtkIdType, 2>>& ranges)
+{
+  vtkInformation* info = array->GetInformation();
+  const vtkMTimeType baseMTime = array->GetMTime();
+  array->Modified();
+
+  if (ranges.empty())
+  {
+    info->Remove(vtkF3DMemoryMesh::DIRTY_RANGES());
+    info->Remove(vtkF3DMemoryMesh::DIRTY_RANGES_BASE_MTIME());
+    info->Remove(vtkF3DMemoryMesh::DIRTY_RANGES_MTIME());
+    return;
+  }
+
+  vtkNew<vtkIdTypeArray> rangesArray;
+  rangesArray->SetNumberOfComponents(2);
+  rangesArray->SetNumberOfTuples(static_cast<vtkIdType>(ranges.size()));
+  for (size_t i = 0; i < ranges.size(); i++)
+  {
+    rangesArray->SetTypedTuple(static_cast<vtkIdType>(i), ranges[i].data());
+  }
+
+  // the modification times are stored so that the ranges are ignored if the array
+  // is modified again without recording new ranges, or if a previous update has been missed
+  info->Set(vtkF3DMemoryMesh::DIRTY_RANGES(), rangesArray);
+  info->Set(vtkF3DMemoryMesh::DIRTY_RANGES_BASE_MTIME(), static_cast<vtkIdType>(baseMTime));
+  info->Set(vtkF3DMemoryMesh::DIRTY_RANGES_MTIME(), static_cast<vtkIdType>(array->GetMTime()));
+}
+
+//------------------------------------------------------------------------------
+vtkMTimeType vtkF3DMemoryMesh::GetDirtyRanges(
+  vtkDataArray* array, std::vector<std::array<vtkIdType, 2>>& ranges)
+{
+  ranges.clear();
+
+  vtkInformation* info = array->GetInformation();
+  vtkIdTypeArray* rangesArray =
+    vtkIdTypeArray::SafeDownCast(info->Get(vtkF3DMemoryMesh::DIRTY_RANGES()));
+  if (!rangesArray ||
+    static_cast<vtkMTimeType>(info->Get(vtkF3DMemoryMesh::DIRTY_RANGES_MTIME())) !=
+      array->GetMTime())
+  {
+    return 0;
+  }
+
+  ranges.resize(rangesArray->GetNumberOfTuples());
+  for (vtkIdType i = 0; i < rangesArray->GetNumberOfTuples(); i++)
+  {
+    rangesArray->GetTypedTuple(i, ranges[i].data());
+  }
+  return static_cast<vtkMTimeType>(info->Get(vtkF3DMemoryMesh::DIRTY_RANGES_BASE_MTIME()));
+}
+
 //------------------------------------------------------------------------------
 int vtkF3DMemoryMesh::RequestInformation(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
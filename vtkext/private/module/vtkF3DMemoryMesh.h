@@ -6,12 +6,22 @@
  * The function is called when the pipeline updates, and is passed the time for which the update is
  * triggered and a pointer to the vtkPolyData to update. The function must fill the provided
  * vtkPolyData with the mesh data corresponding to the provided time.
+ *
+ * Arrays of the vtkPolyData can be updated in place by the update function, in which case
+ * the ranges of tuples that changed can be recorded with SetDirtyRanges so that only these
+ * ranges are uploaded to the GPU by vtkF3DPolyDataMapper.
  */
 #ifndef vtkF3DMemoryMesh_h
 #define vtkF3DMemoryMesh_h
 
 #include "vtkPolyDataAlgorithm.h"
 
+#include <array>
+#include <vector>
+
+class vtkInformationIdTypeKey;
+class vtkInformationObjectBaseKey;
+
 class vtkF3DMemoryMesh : public vtkPolyDataAlgorithm
 {
 public:
@@ -35,6 +45,23 @@ public:
    */
   void SetUpdateFunction(std::function<void(double, vtkPolyData*)> updateFunction);
 
+  /**
+   * Mark an array whose content has been modified in place, recording the provided [begin, end)
+   * ranges of tuples as the only ones that changed since its last modification.
+   * If ranges is empty, the whole array is considered modified.
+   * The array is always marked as modified.
+   */
+  static void SetDirtyRanges(
+    vtkDataArray* array, const std::vector<std::array<vtkIdType, 2>>& ranges);
+
+  /**
+   * Get the ranges recorded by SetDirtyRanges, if the array has not been modified since.
+   * Return the modification time of the array before these ranges changed,
+   * or 0 if the ranges are not available.
+   */
+  static vtkMTimeType GetDirtyRanges(
+    vtkDataArray* array, std::vector<std::array<vtkIdType, 2>>& ranges);
+
 protected:
   vtkF3DMemoryMesh();
   ~vtkF3DMemoryMesh() override;
@@ -43,6 +70,13 @@ protected:
     vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector) override;
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
+  /**
+   * Information keys used to store the dirty ranges on the arrays
+   */
+  static vtkInformationObjectBaseKey* DIRTY_RANGES();
+  static vtkInformationIdTypeKey* DIRTY_RANGES_BASE_MTIME();
+  static vtkInformationIdTypeKey* DIRTY_RANGES_MTIME();
+
 private:
   vtkF3DMemoryMesh(const vtkF3DMemoryMesh&) = delete;
   void operator=(const vtkF3DMemoryMesh&) = delete;
@@ -1,8 +1,11 @@
 #include "vtkF3DMetaImporter.h"
 
+#include "F3DGlyphInstances.h"
 #include "F3DLog.h"
+#include "F3DTrace.h"
 #include "vtkF3DGenericImporter.h"
 #include "vtkF3DImporter.h"
+#include "vtkF3DNoRenderWindow.h"
 
 #include <vtkActorCollection.h>
 #include <vtkArrowSource.h>
@@ -12,18 +15,29 @@
 #include <vtkDataSetAttributes.h>
 #include <vtkImageData.h>
 #include <vtkInformationIntegerKey.h>
+#include <vtkLight.h>
+#include <vtkLightCollection.h>
 #include <vtkObjectFactory.h>
 #include <vtkPointData.h>
 #include <vtkPolyData.h>
+#include <vtkPropCollection.h>
 #include <vtkRenderWindow.h>
 #include <vtkRendererCollection.h>
 #include <vtkSmartPointer.h>
 #include <vtkTexture.h>
 #include <vtkVersion.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
 #include <iostream>
+#include <mutex>
 #include <numeric>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 namespace
@@ -106,24 +120,143 @@ protected:
   }
 };
 vtkStandardNewMacro(vtkF3DCollapseOnLoadVisitor);
+
+/**
+ * Update an importer in a trace scope named after the importer class.
+ * Importers not declared thread safe, for example readers relying on libraries with
+ * unsynchronized global state like HDF5, are serialized, including across meta importers.
+ */
+bool TracedUpdate(vtkImporter* importer)
+{
+  F3D_TRACE_SCOPE_DETAIL("Read", importer->GetClassName());
+  vtkF3DImporter* f3dImporter = vtkF3DImporter::SafeDownCast(importer);
+  if (!f3dImporter || !f3dImporter->GetThreadSafe())
+  {
+    static std::mutex serializedMutex;
+    std::scoped_lock lock(serializedMutex);
+    return importer->Update();
+  }
+  return importer->Update();
+}
 }
 
 //----------------------------------------------------------------------------
 struct vtkF3DMetaImporter::Internals
 {
+  /**
+   * Importers read concurrently are imported into their own staging render window so that
+   * no renderer in use is modified from multiple threads. Its content is then forwarded to the
+   * actual renderer on the main thread, after the read and after each time update.
+   */
+  struct StagingStruct
+  {
+    vtkImporter* Importer;
+    vtkSmartPointer<vtkRenderWindow> RenderWindow;
+    vtkRenderer* Renderer;
+    bool ReadExternally = false;
+    std::vector<vtkSmartPointer<vtkProp>> ForwardedProps;
+    std::vector<vtkSmartPointer<vtkLight>> ForwardedLights;
+  };
+
+  StagingStruct* GetStaging(vtkImporter* importer)
+  {
+    auto it = std::ranges::find_if(
+      this->Stagings, [&](const auto& staging) { return staging->Importer == importer; });
+    return it != this->Stagings.end() ? it->get() : nullptr;
+  }
+
+  /**
+   * Forward props and lights of a staging renderer into the provided renderer
+   * and remove the ones that have been removed since the last call.
+   */
+  static void ForwardStagedContent(StagingStruct& staging, vtkRenderer* renderer)
+  {
+    std::vector<vtkSmartPointer<vtkProp>> props;
+    vtkPropCollection* propCollection = staging.Renderer->GetViewProps();
+    vtkCollectionSimpleIterator pit;
+    propCollection->InitTraversal(pit);
+    while (vtkProp* prop = propCollection->GetNextProp(pit))
+    {
+      props.emplace_back(prop);
+    }
+
+    std::vector<vtkSmartPointer<vtkLight>> lights;
+    vtkLightCollection* lightCollection = staging.Renderer->GetLights();
+    vtkCollectionSimpleIterator lit;
+    lightCollection->InitTraversal(lit);
+    while (vtkLight* light = lightCollection->GetNextLight(lit))
+    {
+      lights.emplace_back(light);
+    }
+
+    for (const auto& prop : staging.ForwardedProps)
+    {
+      if (std::ranges::find(props, prop) == props.end())
+      {
+        renderer->RemoveViewProp(prop);
+      }
+    }
+    for (const auto& prop : props)
+    {
+      if (!renderer->HasViewProp(prop))
+      {
+        renderer->AddViewProp(prop);
+      }
+    }
+
+    for (const auto& light : staging.ForwardedLights)
+    {
+      if (std::ranges::find(lights, light) == lights.end())
+      {
+        renderer->RemoveLight(light);
+      }
+    }
+    for (const auto& light : lights)
+    {
+      if (!renderer->GetLights()->IsItemPresent(light))
+      {
+        renderer->AddLight(light);
+      }
+    }
+
+    staging.ForwardedProps = std::move(props);
+    staging.ForwardedLights = std::move(lights);
+  }
+
   // Actors related vectors
   std::vector<vtkF3DMetaImporter::ColoringStruct> ColoringActorsAndMappers;
   std::vector<vtkF3DMetaImporter::NormalGlyphsStruct> NormalGlyphsActorsAndMappers;
   std::vector<vtkF3DMetaImporter::PointSpritesStruct> PointSpritesActorsAndMappers;
   std::vector<vtkF3DMetaImporter::VolumeStruct> VolumePropsAndMappers;
+  std::vector<vtkF3DMetaImporter::InstancedStruct> InstancedActors;
+
+  // Geometry of the expanded instanced actors, updated in place when the instances change
+  struct ExpandedInstancesStruct
+  {
+    vtkGlyph3DMapper* Mapper;
+    vtkSmartPointer<vtkPolyData> Surface;
+    vtkMTimeType MTime;
+  };
+  std::vector<ExpandedInstancesStruct> ExpandedInstances;
+
+  static vtkMTimeType GetInstancesMTime(vtkGlyph3DMapper* mapper)
+  {
+    vtkMTimeType mtime = std::max(mapper->GetMTime(), mapper->GetInput()->GetMTime());
+    return mapper->GetSource() ? std::max(mtime, mapper->GetSource()->GetMTime()) : mtime;
+  }
 
   std::vector<vtkF3DMetaImporter::ImporterInfo> Importers;
+  std::vector<std::unique_ptr<StagingStruct>> Stagings;
   std::optional<vtkIdType> CameraIndex;
   vtkBoundingBox GeometryBoundingBox;
   vtkTimeStamp ColoringInfoTime;
   vtkTimeStamp UpdateTime;
 
   F3DColoringInfoHandler ColoringInfoHandler;
+
+  // Importers being read concurrently and their progress, written by worker threads
+  std::vector<vtkImporter*> ConcurrentImporters;
+  std::unique_ptr<std::atomic<double>[]> ConcurrentProgress;
 };
 
 //----------------------------------------------------------------------------
@@ -150,11 +283,14 @@ vtkF3DMetaImporter::~vtkF3DMetaImporter()
 void vtkF3DMetaImporter::Clear()
 {
   this->Pimpl->Importers.clear();
+  this->Pimpl->Stagings.clear();
   this->Pimpl->GeometryBoundingBox.Reset();
   this->ActorCollection->RemoveAllItems();
   this->Pimpl->ColoringActorsAndMappers.clear();
   this->Pimpl->PointSpritesActorsAndMappers.clear();
   this->Pimpl->VolumePropsAndMappers.clear();
+  this->Pimpl->InstancedActors.clear();
+  this->Pimpl->ExpandedInstances.clear();
   this->Pimpl->ColoringInfoHandler.ClearColoringInfo();
   this->Modified();
 }
@@ -175,6 +311,17 @@ void vtkF3DMetaImporter::AddImporter(
     {
       vtkF3DMetaImporter* self = static_cast<vtkF3DMetaImporter*>(clientData);
       double progress = *static_cast<double*>(callData);
+      if (!self->Pimpl->ConcurrentImporters.empty())
+      {
+        // Called from a worker thread, only store the progress,
+        // the main thread takes care of invoking the event
+        auto it = std::ranges::find(self->Pimpl->ConcurrentImporters, caller);
+        if (it != self->Pimpl->ConcurrentImporters.end())
+        {
+          self->Pimpl->ConcurrentProgress[it - self->Pimpl->ConcurrentImporters.begin()] = progress;
+        }
+        return;
+      }
       double actualProgress = 0.0;
       for (size_t i = 0; i < self->Pimpl->Importers.size(); i++)
       {
@@ -190,6 +337,20 @@ void vtkF3DMetaImporter::AddImporter(
   importer.second->AddObserver(vtkCommand::ProgressEvent, progressCallback);
 }
 
+//----------------------------------------------------------------------------
+void vtkF3DMetaImporter::AddImporter(
+  const std::pair<std::string, vtkSmartPointer<vtkImporter>>& importer,
+  vtkRenderWindow* stagingWindow)
+{
+  this->AddImporter(importer);
+
+  auto& staging = this->Pimpl->Stagings.emplace_back(std::make_unique<Internals::StagingStruct>());
+  staging->Importer = importer.second;
+  staging->RenderWindow = stagingWindow;
+  staging->Renderer = stagingWindow->GetRenderers()->GetFirstRenderer();
+  staging->ReadExternally = true;
+}
+
 //----------------------------------------------------------------------------
 const vtkBoundingBox& vtkF3DMetaImporter::GetGeometryBoundingBox()
 {
@@ -217,6 +378,39 @@ vtkF3DMetaImporter::GetPointSpritesActorsAndMappers()
   return this->Pimpl->PointSpritesActorsAndMappers;
 }
 
+//----------------------------------------------------------------------------
+const std::vector<vtkF3DMetaImporter::InstancedStruct>& vtkF3DMetaImporter::GetInstancedActors()
+{
+  return this->Pimpl->InstancedActors;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DMetaImporter::ExpandInstancedActors()
+{
+  bool expanded = false;
+  std::vector<InstancedStruct> instancedActors;
+  for (InstancedStruct& instanced : this->Pimpl->InstancedActors)
+  {
+    vtkSmartPointer<vtkPolyData> surface = F3DGlyphInstances::Expand(instanced.Mapper);
+    if (!surface)
+    {
+      // Keep rendering unsupported instanced actors as imported
+      instancedActors.emplace_back(std::move(instanced));
+      continue;
+    }
+
+    // Expanded actors are colored by their coloring actor, restore the imported coloring
+    instanced.Mapper->vtkMapper::ShallowCopy(instanced.ImportedColoring);
+    this->Pimpl->ExpandedInstances.emplace_back(Internals::ExpandedInstancesStruct{
+      instanced.Mapper, surface, Internals::GetInstancesMTime(instanced.Mapper) });
+    this->CreateCompanionActors(instanced.Actor, instanced.Importer, surface, surface);
+    expanded = true;
+  }
+
+  this->Pimpl->InstancedActors = std::move(instancedActors);
+  return expanded;
+}
+
 //----------------------------------------------------------------------------
 const std::vector<vtkF3DMetaImporter::VolumeStruct>& vtkF3DMetaImporter::GetVolumePropsAndMappers()
 {
@@ -238,6 +432,7 @@ vtkF3DMetaImporter::ImporterInfo vtkF3DMetaImporter::GetImporterInfo(int index)
 //----------------------------------------------------------------------------
 bool vtkF3DMetaImporter::Update()
 {
+  F3D_TRACE_SCOPE("Import");
   assert(this->RenderWindow);
   this->Renderer = this->RenderWindow->GetRenderers()->GetFirstRenderer();
   assert(this->Renderer);
@@ -257,6 +452,7 @@ bool vtkF3DMetaImporter::Update()
     localCameraIndex = this->Pimpl->CameraIndex.value();
   }
 
+  std::vector<ImporterInfo*> pendingImporters;
   for (auto& importerInfo : this->Pimpl->Importers)
   {
     vtkImporter* importer = importerInfo.Importer;
@@ -268,197 +464,448 @@ bool vtkF3DMetaImporter::Update()
       continue;
     }
 
+    // Importer has already been read in a staging render window, only forward its content
+    if (this->Pimpl->GetStaging(importer))
+    {
+      localCameraIndex -= importer->GetNumberOfCameras();
+      pendingImporters.emplace_back(&importerInfo);
+      continue;
+    }
+
+    // As long as the camera index has not been resolved, importers must be updated
+    // one after the other as the number of cameras is only known after the update
+    if (localCameraIndex < 0)
+    {
+      pendingImporters.emplace_back(&importerInfo);
+      continue;
+    }
+
     importer->SetRenderWindow(this->RenderWindow);
 
     // This is required to avoid updating two times
     // but may cause a warning in VTK
-    if (localCameraIndex >= 0)
-    {
-      importer->SetCamera(localCameraIndex);
-    }
+    importer->SetCamera(localCameraIndex);
 
-    if (!importer->Update())
+    if (!::TracedUpdate(importer))
     {
       return false;
     }
 
     localCameraIndex -= importer->GetNumberOfCameras();
 
-    vtkActorCollection* actorCollection = importer->GetImportedActors();
+    this->ProcessImportedActors(importerInfo);
+  }
+
+  std::vector<ImporterInfo*> importersToRead;
+  std::ranges::copy_if(pendingImporters, std::back_inserter(importersToRead),
+    [&](ImporterInfo* info) { return this->Pimpl->GetStaging(info->Importer) == nullptr; });
 
-    // copy the scene hierarchy if it exists, or create a generic one otherwise
-    if (importer->GetSceneHierarchy() != nullptr)
+  if (importersToRead.size() > 1)
+  {
+    if (!this->ReadConcurrently(importersToRead))
     {
-      importerInfo.DataAssembly->DeepCopy(importer->GetSceneHierarchy());
+      return false;
     }
-    else
+  }
+  else if (importersToRead.size() == 1)
+  {
+    vtkImporter* importer = importersToRead[0]->Importer;
+    importer->SetRenderWindow(this->RenderWindow);
+    if (!::TracedUpdate(importer))
+    {
+      return false;
+    }
+  }
+
+  // Forward staged content and create the companion actors in the original order
+  // so that the result does not depend on which importer finished first
+  for (ImporterInfo* importerInfo : pendingImporters)
+  {
+    if (Internals::StagingStruct* staging = this->Pimpl->GetStaging(importerInfo->Importer))
     {
-      // add one node per actor
-      for (int actorIndex = 0; actorIndex < actorCollection->GetNumberOfItems(); actorIndex++)
+      Internals::ForwardStagedContent(*staging, this->Renderer);
+
+      // When read by ReadStaged with a camera index, the importer owning the requested camera
+      // activated it in its staging renderer
+      if (staging->ReadExternally && this->Pimpl->CameraIndex.has_value() &&
+        staging->Renderer->IsActiveCameraCreated())
       {
-        std::string actorName = "object" + std::to_string(actorIndex);
-        const int nodeid = importerInfo.DataAssembly->AddNode(
-          actorName.c_str(), importerInfo.DataAssembly->GetRootNode());
-        importerInfo.DataAssembly->SetAttribute(nodeid, "flat_actor_id", actorIndex);
+        this->Renderer->SetActiveCamera(staging->Renderer->GetActiveCamera());
       }
     }
+    this->ProcessImportedActors(*importerInfo);
+  }
+
+  if (localCameraIndex > 0)
+  {
+    // Here we know that CameraIndex has a value
+    F3DLog::Print(F3DLog::Severity::Warning,
+      "Camera index " + std::to_string(this->Pimpl->CameraIndex.value()) +
+        " is higher than the number of available camera in the files. Camera may be incorrect.");
+  }
+
+  // XXX: UpdateStatus is not set, but libf3d does not use it
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DMetaImporter::ReadConcurrently(const std::vector<ImporterInfo*>& importerInfos)
+{
+  const size_t nbImporters = importerInfos.size();
+  std::vector<vtkImporter*> importers;
+  for (ImporterInfo* importerInfo : importerInfos)
+  {
+    importers.emplace_back(importerInfo->Importer);
+  }
+
+  this->Pimpl->ConcurrentProgress = std::make_unique<std::atomic<double>[]>(nbImporters);
+  for (size_t i = 0; i < nbImporters; i++)
+  {
+    this->Pimpl->ConcurrentProgress[i] = 0.0;
+  }
+  this->Pimpl->ConcurrentImporters = importers;
+
+  // Progress events are invoked from the main thread only as observers usually render
+  auto invokeProgress = [&]()
+  {
+    double progress = 0.0;
+    for (size_t i = 0; i < nbImporters; i++)
+    {
+      progress += this->Pimpl->ConcurrentProgress[i];
+    }
+    progress /= static_cast<double>(nbImporters);
+    this->InvokeEvent(vtkCommand::ProgressEvent, &progress);
+  };
+
+  std::vector<vtkSmartPointer<vtkRenderWindow>> windows;
+  try
+  {
+    windows = vtkF3DMetaImporter::ReadStaged(importers, -1, invokeProgress);
+  }
+  catch (...)
+  {
+    this->Pimpl->ConcurrentImporters.clear();
+    this->Pimpl->ConcurrentProgress.reset();
+    throw;
+  }
+  this->Pimpl->ConcurrentImporters.clear();
+  this->Pimpl->ConcurrentProgress.reset();
+
+  if (windows.empty())
+  {
+    return false;
+  }
+
+  for (size_t i = 0; i < nbImporters; i++)
+  {
+    auto& staging =
+      this->Pimpl->Stagings.emplace_back(std::make_unique<Internals::StagingStruct>());
+    staging->Importer = importers[i];
+    staging->RenderWindow = windows[i];
+    staging->Renderer = windows[i]->GetRenderers()->GetFirstRenderer();
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+std::vector<vtkSmartPointer<vtkRenderWindow>> vtkF3DMetaImporter::ReadStaged(
+  const std::vector<vtkImporter*>& importers, vtkIdType cameraIndex,
+  const std::function<void()>& poll, const std::atomic<bool>* canceled)
+{
+  auto isCanceled = [canceled]() { return canceled && *canceled; };
 
-    importerInfo.DataAssembly->SetAttribute(
-      vtkDataAssembly::GetRootNode(), "label", importerInfo.Name.c_str());
+  const size_t nbImporters = importers.size();
+  std::vector<vtkSmartPointer<vtkRenderWindow>> windows;
+  for (vtkImporter* importer : importers)
+  {
+    vtkNew<vtkF3DNoRenderWindow> window;
+    vtkNew<vtkRenderer> renderer;
+    window->AddRenderer(renderer);
+    importer->SetRenderWindow(window);
+    windows.emplace_back(window);
+  }
 
-    vtkNew<::vtkF3DCollapseOnLoadVisitor> visitor;
-    importerInfo.DataAssembly->Visit(vtkDataAssembly::GetRootNode(), visitor);
-    // Unset the attr on all nodes which have an ancestor that has it already.
-    // This avoids having to expand the collapsed levels one by one.
-    const std::string xpath = "//*[@f3d_collapsed='1']//*[@f3d_collapsed='1']";
-    for (const int nodeid : importerInfo.DataAssembly->SelectNodes({ xpath }))
+  // Importers needed to resolve the camera index are read one after the other
+  size_t first = 0;
+  for (; first < nbImporters && cameraIndex >= 0; first++)
+  {
+    importers[first]->SetCamera(cameraIndex);
+    if (isCanceled() || !::TracedUpdate(importers[first]))
     {
-      importerInfo.DataAssembly->SetAttribute(nodeid, "f3d_collapsed", 0);
+      return {};
     }
+    cameraIndex -= importers[first]->GetNumberOfCameras();
+  }
 
-    // Recover generic importer if any (for indexed access to points/image)
-    vtkF3DGenericImporter* genericImporter = vtkF3DGenericImporter::SafeDownCast(importer);
-    vtkIdType actorIndex = 0;
+  std::vector<char> results(nbImporters - first, 0);
+
+#ifdef __EMSCRIPTEN__
+  // No thread support, read importers one after the other
+  for (size_t i = first; i < nbImporters; i++)
+  {
+    results[i - first] = !isCanceled() && ::TracedUpdate(importers[i]);
+  }
+  (void)poll;
+#else
+  std::atomic<size_t> nextIndex = first;
+  size_t nbDone = first;
+  std::exception_ptr exception;
+  std::mutex mutex;
+  std::condition_variable doneCondition;
 
-    vtkCollectionSimpleIterator ait;
-    actorCollection->InitTraversal(ait);
-    while (vtkActor* actor = actorCollection->GetNextActor(ait))
+  auto readImporters = [&](size_t workerIndex)
+  {
+    F3DTrace::SetThreadName("importer worker " + std::to_string(workerIndex));
+    for (size_t i = nextIndex++; i < nbImporters; i = nextIndex++)
     {
-      // Check for actor's poly data mapper, skip if none exists
-      vtkPolyDataMapper* pdMapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
-      if (pdMapper == nullptr)
+      bool result = false;
+      try
+      {
+        result = !isCanceled() && ::TracedUpdate(importers[i]);
+      }
+      catch (...)
       {
-        F3DLog::Print(
-          F3DLog::Severity::Warning, "Actor has no mapped poly data and will not be rendered.");
-        continue;
+        std::scoped_lock lock(mutex);
+        exception = std::current_exception();
       }
 
-      // Add to the actor collection
-      this->ActorCollection->AddItem(actor);
+      std::scoped_lock lock(mutex);
+      results[i - first] = result;
+      nbDone++;
+      doneCondition.notify_one();
+    }
+  };
 
-      vtkPolyData* surface = pdMapper->GetInput();
+  const size_t nbWorkers =
+    std::min<size_t>(nbImporters - first, std::max(1u, std::thread::hardware_concurrency()));
+  std::vector<std::thread> workers;
+  workers.reserve(nbWorkers);
+  for (size_t i = 0; i < nbWorkers; i++)
+  {
+    workers.emplace_back(readImporters, i);
+  }
 
-      // convert to PBR materials if needed
-      // this should be moved elsewhere, see https://github.com/f3d-app/f3d/issues/2995
-      if (!genericImporter && actor->GetProperty()->GetInterpolation() != VTK_PBR)
+  {
+    std::unique_lock lock(mutex);
+    while (!doneCondition.wait_for(
+      lock, std::chrono::milliseconds(50), [&]() { return nbDone == nbImporters; }))
+    {
+      if (poll)
       {
-        // get texture
-        vtkSmartPointer<vtkTexture> diffuseTex = actor->GetTexture();
-        if (!diffuseTex)
-        {
-          diffuseTex = actor->GetProperty()->GetTexture("diffuseTex");
-        }
-        if (diffuseTex)
-        {
-          diffuseTex->UseSRGBColorSpaceOn();
-        }
+        lock.unlock();
+        poll();
+        lock.lock();
+      }
+    }
+  }
 
-        if (actor->GetProperty()->GetLighting())
-        {
-          actor->GetProperty()->SetInterpolationToPBR();
+  for (std::thread& worker : workers)
+  {
+    worker.join();
+  }
+
+  if (exception)
+  {
+    std::rethrow_exception(exception);
+  }
+#endif
+
+  if (!std::ranges::all_of(results, [](char result) { return result != 0; }))
+  {
+    return {};
+  }
+  return windows;
+}
 
-          // Convert to linear space
-          auto toLinear = [](double c) { return std::pow(c, 2.2); };
-          double diffuseColor[3];
-          actor->GetProperty()->GetDiffuseColor(diffuseColor);
-          actor->GetProperty()->SetDiffuseColor(
-            toLinear(diffuseColor[0]), toLinear(diffuseColor[1]), toLinear(diffuseColor[2]));
+//----------------------------------------------------------------------------
+void vtkF3DMetaImporter::ProcessImportedActors(ImporterInfo& importerInfo)
+{
+  F3D_TRACE_SCOPE_DETAIL("Process actors", importerInfo.Name);
+  vtkImporter* importer = importerInfo.Importer;
+  vtkActorCollection* actorCollection = importer->GetImportedActors();
 
-          // restore diffuse/specular to 1 and ambient to 0
-          actor->GetProperty()->SetSpecular(1.0);
-          actor->GetProperty()->SetDiffuse(1.0);
-          actor->GetProperty()->SetAmbient(0.0);
+  // copy the scene hierarchy if it exists, or create a generic one otherwise
+  if (importer->GetSceneHierarchy() != nullptr)
+  {
+    importerInfo.DataAssembly->DeepCopy(importer->GetSceneHierarchy());
+  }
+  else
+  {
+    // add one node per actor
+    for (int actorIndex = 0; actorIndex < actorCollection->GetNumberOfItems(); actorIndex++)
+    {
+      std::string actorName = "object" + std::to_string(actorIndex);
+      const int nodeid = importerInfo.DataAssembly->AddNode(
+        actorName.c_str(), importerInfo.DataAssembly->GetRootNode());
+      importerInfo.DataAssembly->SetAttribute(nodeid, "flat_actor_id", actorIndex);
+    }
+  }
 
-          if (diffuseTex)
-          {
-            actor->SetTexture(nullptr);
-            actor->GetProperty()->SetColor(1.0, 1.0, 1.0);
-            actor->GetProperty()->SetBaseColorTexture(diffuseTex);
-          }
-        }
-      }
+  importerInfo.DataAssembly->SetAttribute(
+    vtkDataAssembly::GetRootNode(), "label", importerInfo.Name.c_str());
+
+  vtkNew<::vtkF3DCollapseOnLoadVisitor> visitor;
+  importerInfo.DataAssembly->Visit(vtkDataAssembly::GetRootNode(), visitor);
+  // Unset the attr on all nodes which have an ancestor that has it already.
+  // This avoids having to expand the collapsed levels one by one.
+  const std::string xpath = "//*[@f3d_collapsed='1']//*[@f3d_collapsed='1']";
+  for (const int nodeid : importerInfo.DataAssembly->SelectNodes({ xpath }))
+  {
+    importerInfo.DataAssembly->SetAttribute(nodeid, "f3d_collapsed", 0);
+  }
+
+  // Recover generic importer if any (for indexed access to points/image)
+  vtkF3DGenericImporter* genericImporter = vtkF3DGenericImporter::SafeDownCast(importer);
+  vtkIdType actorIndex = 0;
+
+  vtkCollectionSimpleIterator ait;
+  actorCollection->InitTraversal(ait);
+  while (vtkActor* actor = actorCollection->GetNextActor(ait))
+  {
+    // Instanced actors are rendered as imported, their companions are created on demand
+    // by ExpandInstancedActors
+    vtkGlyph3DMapper* glyphMapper = vtkGlyph3DMapper::SafeDownCast(actor->GetMapper());
+    if (glyphMapper)
+    {
+      this->ActorCollection->AddItem(actor);
+      this->Pimpl->InstancedActors.emplace_back(actor, glyphMapper, importer);
 
-      // Increase bounding box size if needed
       double bounds[6];
-      surface->GetBounds(bounds);
+      glyphMapper->GetBounds(bounds);
       this->Pimpl->GeometryBoundingBox.AddBounds(bounds);
 
-      // Create and configure coloring actors
-      this->Pimpl->ColoringActorsAndMappers.emplace_back(vtkF3DMetaImporter::ColoringStruct(actor));
-      vtkF3DMetaImporter::ColoringStruct& cs = this->Pimpl->ColoringActorsAndMappers.back();
-      cs.Mapper->SetInputData(surface);
-      this->Renderer->AddActor(cs.Actor);
-      cs.Actor->VisibilityOff();
+      actorIndex++;
+      continue;
+    }
 
-      vtkPolyData* points = surface;
-      if (genericImporter)
-      {
-        // Use indexed accessor for composite support
-        points = genericImporter->GetImportedPoints(actorIndex);
-      }
+    // Check for actor's poly data mapper, skip if none exists
+    vtkPolyDataMapper* pdMapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
+    if (pdMapper == nullptr)
+    {
+      F3DLog::Print(
+        F3DLog::Severity::Warning, "Actor has no mapped poly data and will not be rendered.");
+      continue;
+    }
 
-      // Create and configure normal glyph actors
-      this->Pimpl->NormalGlyphsActorsAndMappers.emplace_back(
-        vtkF3DMetaImporter::NormalGlyphsStruct(actor, importer));
-      vtkF3DMetaImporter::NormalGlyphsStruct& ngs =
-        this->Pimpl->NormalGlyphsActorsAndMappers.back();
+    // Add to the actor collection
+    this->ActorCollection->AddItem(actor);
 
-      ngs.InputDataHasNormals = points->GetPointData()->GetNormals() != nullptr;
+    vtkPolyData* surface = pdMapper->GetInput();
 
-      if (ngs.InputDataHasNormals)
+    // convert to PBR materials if needed
+    // this should be moved elsewhere, see https://github.com/f3d-app/f3d/issues/2995
+    if (!genericImporter && actor->GetProperty()->GetInterpolation() != VTK_PBR)
+    {
+      // get texture
+      vtkSmartPointer<vtkTexture> diffuseTex = actor->GetTexture();
+      if (!diffuseTex)
       {
-        vtkNew<vtkArrowSource> arrowSource;
-        ngs.GlyphMapper->SetInputData(points);
-        ngs.GlyphMapper->SetSourceConnection(arrowSource->GetOutputPort());
-        ngs.GlyphMapper->SetOrientationModeToDirection();
-        ngs.GlyphMapper->SetOrientationArray(vtkDataSetAttributes::NORMALS);
-        ngs.GlyphMapper->ScalingOn();
-        ngs.Actor->SetMapper(ngs.GlyphMapper);
-        this->Renderer->AddActor(ngs.Actor);
-        ngs.Actor->VisibilityOff();
+        diffuseTex = actor->GetProperty()->GetTexture("diffuseTex");
+      }
+      if (diffuseTex)
+      {
+        diffuseTex->UseSRGBColorSpaceOn();
       }
 
-      // Create and configure point sprites actors
-      this->Pimpl->PointSpritesActorsAndMappers.emplace_back(
-        vtkF3DMetaImporter::PointSpritesStruct(actor, importer));
-      vtkF3DMetaImporter::PointSpritesStruct& pss =
-        this->Pimpl->PointSpritesActorsAndMappers.back();
+      if (actor->GetProperty()->GetLighting())
+      {
+        actor->GetProperty()->SetInterpolationToPBR();
 
-      pss.Mapper->SetInputData(points);
-      this->Renderer->AddActor(pss.Actor);
-      pss.Actor->VisibilityOff();
+        // Convert to linear space
+        auto toLinear = [](double c) { return std::pow(c, 2.2); };
+        double diffuseColor[3];
+        actor->GetProperty()->GetDiffuseColor(diffuseColor);
+        actor->GetProperty()->SetDiffuseColor(
+          toLinear(diffuseColor[0]), toLinear(diffuseColor[1]), toLinear(diffuseColor[2]));
 
-      // Create and configure volume props
-      if (genericImporter)
-      {
-        vtkImageData* image = genericImporter->GetImportedImage(actorIndex);
-        if (image)
+        // restore diffuse/specular to 1 and ambient to 0
+        actor->GetProperty()->SetSpecular(1.0);
+        actor->GetProperty()->SetDiffuse(1.0);
+        actor->GetProperty()->SetAmbient(0.0);
+
+        if (diffuseTex)
         {
-          // XXX: Note that creating this struct takes some time
-          this->Pimpl->VolumePropsAndMappers.emplace_back(vtkF3DMetaImporter::VolumeStruct(actor));
-          vtkF3DMetaImporter::VolumeStruct& vs = this->Pimpl->VolumePropsAndMappers.back();
-          vs.Mapper->SetInputData(image);
-          this->Renderer->AddVolume(vs.Prop);
-          vs.Prop->VisibilityOff();
+          actor->SetTexture(nullptr);
+          actor->GetProperty()->SetColor(1.0, 1.0, 1.0);
+          actor->GetProperty()->SetBaseColorTexture(diffuseTex);
         }
       }
+    }
 
-      actorIndex++;
+    // Increase bounding box size if needed
+    double bounds[6];
+    surface->GetBounds(bounds);
+    this->Pimpl->GeometryBoundingBox.AddBounds(bounds);
+
+    vtkPolyData* points = surface;
+    if (genericImporter)
+    {
+      // Use indexed accessor for composite support
+      points = genericImporter->GetImportedPoints(actorIndex);
     }
 
-    importerInfo.Updated = true;
+    this->CreateCompanionActors(actor, importer, surface, points);
+
+    // Create and configure volume props
+    if (genericImporter)
+    {
+      vtkImageData* image = genericImporter->GetImportedImage(actorIndex);
+      if (image)
+      {
+        // XXX: Note that creating this struct takes some time
+        this->Pimpl->VolumePropsAndMappers.emplace_back(vtkF3DMetaImporter::VolumeStruct(actor));
+        vtkF3DMetaImporter::VolumeStruct& vs = this->Pimpl->VolumePropsAndMappers.back();
+        vs.Mapper->SetInputData(image);
+        this->Renderer->AddVolume(vs.Prop);
+        vs.Prop->VisibilityOff();
+      }
+    }
+
+    actorIndex++;
   }
 
-  if (localCameraIndex > 0)
+  importerInfo.Updated = true;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DMetaImporter::CreateCompanionActors(
+  vtkActor* actor, vtkImporter* importer, vtkPolyData* surface, vtkPolyData* points)
+{
+  // Create and configure coloring actors
+  this->Pimpl->ColoringActorsAndMappers.emplace_back(vtkF3DMetaImporter::ColoringStruct(actor));
+  vtkF3DMetaImporter::ColoringStruct& cs = this->Pimpl->ColoringActorsAndMappers.back();
+  cs.Mapper->SetInputData(surface);
+  this->Renderer->AddActor(cs.Actor);
+  cs.Actor->VisibilityOff();
+
+  // Create and configure normal glyph actors
+  this->Pimpl->NormalGlyphsActorsAndMappers.emplace_back(
+    vtkF3DMetaImporter::NormalGlyphsStruct(actor, importer));
+  vtkF3DMetaImporter::NormalGlyphsStruct& ngs = this->Pimpl->NormalGlyphsActorsAndMappers.back();
+
+  ngs.InputDataHasNormals = points->GetPointData()->GetNormals() != nullptr;
+
+  if (ngs.InputDataHasNormals)
   {
-    // Here we know that CameraIndex has a value
-    F3DLog::Print(F3DLog::Severity::Warning,
-      "Camera index " + std::to_string(this->Pimpl->CameraIndex.value()) +
-        " is higher than the number of available camera in the files. Camera may be incorrect.");
+    vtkNew<vtkArrowSource> arrowSource;
+    ngs.GlyphMapper->SetInputData(points);
+    ngs.GlyphMapper->SetSourceConnection(arrowSource->GetOutputPort());
+    ngs.GlyphMapper->SetOrientationModeToDirection();
+    ngs.GlyphMapper->SetOrientationArray(vtkDataSetAttributes::NORMALS);
+    ngs.GlyphMapper->ScalingOn();
+    ngs.Actor->SetMapper(ngs.GlyphMapper);
+    this->Renderer->AddActor(ngs.Actor);
+    ngs.Actor->VisibilityOff();
   }
 
-  // XXX: UpdateStatus is not set, but libf3d does not use it
-  return true;
+  // Create and configure point sprites actors
+  this->Pimpl->PointSpritesActorsAndMappers.emplace_back(
+    vtkF3DMetaImporter::PointSpritesStruct(actor, importer));
+  vtkF3DMetaImporter::PointSpritesStruct& pss = this->Pimpl->PointSpritesActorsAndMappers.back();
+
+  pss.Mapper->SetInputData(points);
+  this->Renderer->AddActor(pss.Actor);
+  pss.Actor->VisibilityOff();
 }
 
 //----------------------------------------------------------------------------
@@ -726,11 +1173,49 @@ bool vtkF3DMetaImporter::UpdateAtTimeValue(double timeValue)
     ret = ret && importerInfo.Importer->UpdateAtTimeValue(timeValue);
   }
 
+  this->UpdateDerivedActors();
+  return ret;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DMetaImporter::UpdateGenericImporter(vtkF3DGenericImporter* importer)
+{
+  bool ret = importer->UpdateReader();
+  this->UpdateDerivedActors();
+  return ret;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DMetaImporter::UpdateDerivedActors()
+{
+  // Importers may have added or removed props and lights in their staging renderer
+  for (const auto& staging : this->Pimpl->Stagings)
+  {
+    Internals::ForwardStagedContent(*staging, this->Renderer);
+  }
+
+  // Expanded instances are updated in place, so their companions keep using them
+  for (auto& expanded : this->Pimpl->ExpandedInstances)
+  {
+    const vtkMTimeType mtime = Internals::GetInstancesMTime(expanded.Mapper);
+    if (mtime > expanded.MTime)
+    {
+      if (vtkSmartPointer<vtkPolyData> surface = F3DGlyphInstances::Expand(expanded.Mapper))
+      {
+        expanded.Surface->ShallowCopy(surface);
+      }
+      expanded.MTime = mtime;
+    }
+  }
+
   // Update coloring and point sprites
   for (auto& cs : this->Pimpl->ColoringActorsAndMappers)
   {
-    cs.Mapper->SetInputData(
-      vtkPolyDataMapper::SafeDownCast(cs.OriginalActor->GetMapper())->GetInput());
+    vtkPolyDataMapper* pdMapper = vtkPolyDataMapper::SafeDownCast(cs.OriginalActor->GetMapper());
+    if (pdMapper)
+    {
+      cs.Mapper->SetInputData(pdMapper->GetInput());
+    }
 
     bool visi = cs.Actor->GetVisibility();
     cs.Actor->vtkProp3D::ShallowCopy(cs.OriginalActor);
@@ -738,10 +1223,13 @@ bool vtkF3DMetaImporter::UpdateAtTimeValue(double timeValue)
   }
   for (auto& pss : this->Pimpl->PointSpritesActorsAndMappers)
   {
+    vtkPolyDataMapper* pdMapper = vtkPolyDataMapper::SafeDownCast(pss.OriginalActor->GetMapper());
     if (!vtkF3DGenericImporter::SafeDownCast(pss.Importer))
     {
-      pss.Mapper->SetInputData(
-        vtkPolyDataMapper::SafeDownCast(pss.OriginalActor->GetMapper())->GetInput());
+      if (pdMapper)
+      {
+        pss.Mapper->SetInputData(pdMapper->GetInput());
+      }
       bool visi = pss.Actor->GetVisibility();
       pss.Actor->vtkProp3D::ShallowCopy(pss.OriginalActor);
       pss.Actor->SetVisibility(visi);
@@ -749,7 +1237,6 @@ bool vtkF3DMetaImporter::UpdateAtTimeValue(double timeValue)
   }
 
   this->Pimpl->UpdateTime.Modified();
-  return ret;
 }
 
 //----------------------------------------------------------------------------
@@ -770,6 +1257,23 @@ void vtkF3DMetaImporter::UpdateInfoForColoring()
       actorCollection->InitTraversal(ait);
       while (auto* actor = actorCollection->GetNextActor(ait))
       {
+        // Instanced actors are colored using their per instance arrays,
+        // and the arrays of their source once expanded for point sprites or normal glyphs
+        if (vtkGlyph3DMapper* glyphMapper = vtkGlyph3DMapper::SafeDownCast(actor->GetMapper()))
+        {
+          if (glyphMapper->GetInput())
+          {
+            this->Pimpl->ColoringInfoHandler.UpdateColoringInfo(glyphMapper->GetInput(), false);
+          }
+          if (F3DGlyphInstances::IsSupported(glyphMapper))
+          {
+            this->Pimpl->ColoringInfoHandler.UpdateColoringInfo(glyphMapper->GetSource(), false);
+            this->Pimpl->ColoringInfoHandler.UpdateColoringInfo(glyphMapper->GetSource(), true);
+          }
+          actorIndex++;
+          continue;
+        }
+
         vtkPolyDataMapper* pdMapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
         // Check for actor's poly data mapper, skip if none exists
         if (pdMapper == nullptr)
@@ -824,6 +1328,15 @@ std::string vtkF3DMetaImporter::GetMetaDataDescription() const
   this->ActorCollection->InitTraversal(ait);
   while (auto* actor = this->ActorCollection->GetNextActor(ait))
   {
+    if (vtkGlyph3DMapper* glyphMapper = vtkGlyph3DMapper::SafeDownCast(actor->GetMapper()))
+    {
+      vtkPolyData* source = glyphMapper->GetSource();
+      const vtkIdType nInstances = glyphMapper->GetInput()->GetNumberOfPoints();
+      nPoints += source ? nInstances * source->GetNumberOfPoints() : 0;
+      nCells += source ? nInstances * source->GetNumberOfCells() : 0;
+      continue;
+    }
+
     vtkPolyData* surface = vtkPolyDataMapper::SafeDownCast(actor->GetMapper())->GetInput();
     nPoints += surface->GetNumberOfPoints();
     nCells += surface->GetNumberOfCells();
@@ -14,13 +14,19 @@
 #include <vtkGlyph3DMapper.h>
 #include <vtkPointGaussianMapper.h>
 #include <vtkProperty.h>
+#include <vtkRenderWindow.h>
 #include <vtkSmartVolumeMapper.h>
 #include <vtkVolume.h>
 
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 
+class vtkF3DGenericImporter;
+class vtkPolyData;
+
 class vtkF3DMetaImporter : public vtkF3DImporter
 {
 public:
@@ -96,6 +102,23 @@ public:
     vtkActor* OriginalActor;
   };
 
+  struct InstancedStruct
+  {
+    explicit InstancedStruct(vtkActor* actor, vtkGlyph3DMapper* mapper, vtkImporter* importer)
+      : Actor(actor)
+      , Mapper(mapper)
+      , Importer(importer)
+    {
+      // Keep the imported coloring of the mapper to restore it when not coloring
+      this->ImportedColoring->vtkMapper::ShallowCopy(mapper);
+    }
+
+    vtkActor* Actor;
+    vtkGlyph3DMapper* Mapper;
+    vtkImporter* Importer;
+    vtkNew<vtkPolyDataMapper> ImportedColoring;
+  };
+
   struct ImporterInfo
   {
     std::string Name;
@@ -116,6 +139,31 @@ public:
    */
   void AddImporter(const std::pair<std::string, vtkSmartPointer<vtkImporter>>& importer);
 
+  /**
+   * Add an importer that has already been read into a staging render window by ReadStaged.
+   * Its content will be forwarded to the renderer on the next Update.
+   */
+  void AddImporter(const std::pair<std::string, vtkSmartPointer<vtkImporter>>& importer,
+    vtkRenderWindow* stagingWindow);
+
+  /**
+   * Read the provided importers, each into its own staging render window, without
+   * modifying any meta importer nor any renderer in use, so that it can be called from any thread.
+   * Importers needed to resolve cameraIndex, the camera index local to the first importer,
+   * are read one after the other, the others are read concurrently.
+   * Importers not declared thread safe, see vtkF3DImporter::SetThreadSafe, are never read
+   * concurrently with one another.
+   * Use a negative cameraIndex to ignore it.
+   * If provided, poll is called regularly from the calling thread while importers are being read.
+   * If provided, importers that have not started reading are skipped once canceled is set.
+   * Return the staging render windows in the same order than the importers,
+   * or an empty vector if any importer failed to update or has been skipped.
+   * Exceptions thrown by the importers are rethrown.
+   */
+  static std::vector<vtkSmartPointer<vtkRenderWindow>> ReadStaged(
+    const std::vector<vtkImporter*>& importers, vtkIdType cameraIndex,
+    const std::function<void()>& poll = nullptr, const std::atomic<bool>* canceled = nullptr);
+
   /**
    * Get the bounding box of all geometry actors
    * Should be called after actors have been imported
@@ -131,18 +179,35 @@ public:
 
   ///@{
   /**
-   * API to recover information about all imported actors, point sprites and volume if any
+   * API to recover information about all imported actors, point sprites, volume
+   * and glyph mapped instanced actors that have not been expanded if any
    */
   const std::vector<ColoringStruct>& GetColoringActorsAndMappers();
   const std::vector<NormalGlyphsStruct>& GetNormalGlyphsActorsAndMappers();
   const std::vector<PointSpritesStruct>& GetPointSpritesActorsAndMappers();
   const std::vector<VolumeStruct>& GetVolumePropsAndMappers();
+  const std::vector<InstancedStruct>& GetInstancedActors();
   ///@}
 
+  /**
+   * Expand the geometry of the glyph mapped instanced actors on each of their instances
+   * and create their coloring, normal glyphs and point sprites actors, so that they can be
+   * rendered with point sprites or normal glyphs. Instanced actors can be colored by their
+   * per instance arrays without being expanded.
+   * Instanced actors are then listed with the other actors and removed from GetInstancedActors,
+   * they are still rendered using instancing when not colored.
+   * As it uses as much memory as importing without instancing, it should only be done when needed.
+   * Expanded geometry is updated when the instances are modified by an animation.
+   * Return true if any actor has been expanded.
+   */
+  bool ExpandInstancedActors();
+
   /**
    * XXX: HIDE the vtkImporter::Update method and declare our own
    * Import each of of the add importers into the first renderer of the render window.
    * Importers that have already been imported will be skipped
+   * Importers that are not needed to resolve the camera index are read concurrently,
+   * except importers not declared thread safe, which are read one after the other
    * Also handles camera index if specified
    * After import, create point sprites actors for all importers, and volume props
    * for generic importer if compatible.
@@ -200,6 +265,12 @@ public:
    */
   bool UpdateAtTimeValue(double timeValue) override;
 
+  /**
+   * Update the provided generic importer, which must have been added, after the data of its
+   * reader has been modified, and the actors depending on it
+   */
+  bool UpdateGenericImporter(vtkF3DGenericImporter* importer);
+
   /**
    * Get the update mTime
    */
@@ -224,6 +295,31 @@ private:
    */
   void UpdateInfoForColoring();
 
+  /**
+   * Update the actors created from the actors of the importers after they have been updated
+   */
+  void UpdateDerivedActors();
+
+  /**
+   * Update the provided importers concurrently using ReadStaged.
+   * Progress events are invoked from the calling thread.
+   * Return false if any of the importers failed to update.
+   */
+  bool ReadConcurrently(const std::vector<ImporterInfo*>& importerInfos);
+
+  /**
+   * Copy the scene hierarchy of an updated importer and create
+   * the coloring, normal glyphs, point sprites and volume companions of its actors
+   */
+  void ProcessImportedActors(ImporterInfo& importerInfo);
+
+  /**
+   * Create the coloring, normal glyphs and point sprites companions of an actor
+   * from its surface and its points
+   */
+  void CreateCompanionActors(
+    vtkActor* actor, vtkImporter* importer, vtkPolyData* surface, vtkPolyData* points);
+
   struct Internals;
   std::unique_ptr<Internals> Pimpl;
 };
@@ -1,5 +1,8 @@
 #include "vtkF3DOverlayRenderPass.h"
 
+#include "F3DFrameProfiler.h"
+#include "vtkF3DRenderer.h"
+
 #include <vtkCameraPass.h>
 #include <vtkDefaultPass.h>
 #include <vtkObjectFactory.h>
@@ -38,7 +41,16 @@ void vtkF3DOverlayRenderPass::Render(const vtkRenderState* s)
     this->OverlayProps.data(), static_cast<int>(this->OverlayProps.size()));
   overlayState.SetFrameBuffer(s->GetFrameBuffer());
 
-  this->OverlayPass->Render(&overlayState);
+  vtkF3DRenderer* renderer = vtkF3DRenderer::SafeDownCast(r);
+  if (renderer)
+  {
+    F3DFrameProfiler::ScopedPass scope(renderer->GetFrameProfiler(), "UI");
+    this->OverlayPass->Render(&overlayState);
+  }
+  else
+  {
+    this->OverlayPass->Render(&overlayState);
+  }
   r->SetBackground(bgColor);
 
   this->CompositeOverlay(s);
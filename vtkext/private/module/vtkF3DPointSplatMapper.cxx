@@ -1,5 +1,7 @@
 #include "vtkF3DPointSplatMapper.h"
 
+#include "F3DSplatRadixSort.h"
+
 #if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
 #include "vtkF3DBitonicSort.h"
 #include "vtkF3DComputeDepthCS.h"
@@ -80,8 +82,7 @@ private:
   vtkNew<vtkF3DBitonicSort> Sorter;
 #endif
 
-  std::vector<unsigned int> CPUSortedIndices;
-  std::vector<float> CPUDepths;
+  F3DSplatRadixSort CPUSorter;
 
   static constexpr double DirectionThreshold = 0.999;
   double LastDirection[3] = { 0.0, 0.0, 0.0 };
@@ -384,32 +385,13 @@ void vtkF3DSplatMapperHelper::SortSplatsCPU(vtkRenderer* ren)
     return;
   }
 
-  int numVerts = this->VBOs->GetNumberOfTuples("vertexMC");
-
-  this->CPUSortedIndices.resize(static_cast<size_t>(numVerts));
-
-  this->Primitives[PrimitivePoints].IBO->Download(
-    this->CPUSortedIndices.data(), static_cast<size_t>(numVerts));
-
-  this->CPUDepths.resize(static_cast<size_t>(numVerts));
-  // compute depth for each splat
-  vtkPolyData* poly = this->CurrentInput;
-
-  vtkPoints* points = poly->GetPoints();
-
-  for (int i = 0; i < numVerts; ++i)
-  {
-    const double* pos = points->GetPoint(i);
-    this->CPUDepths[i] = pos[0] * this->LastDirection[0] + pos[1] * this->LastDirection[1] +
-      pos[2] * this->LastDirection[2];
-  }
-
   // Match bitonic sort ordering: sort ascending by depth (back-to-front given reversed direction)
-  std::ranges::sort(this->CPUSortedIndices,
-    [&](const GLuint& a, const GLuint& b) { return this->CPUDepths[a] < this->CPUDepths[b]; });
+  // The whole index buffer is rewritten, so there is no need to download it first
+  const std::vector<unsigned int>& sortedIndices =
+    this->CPUSorter.Sort(this->CurrentInput->GetPoints()->GetData(), this->LastDirection);
 
-  this->Primitives[PrimitivePoints].IBO->Upload(this->CPUSortedIndices.data(),
-    static_cast<size_t>(numVerts), vtkOpenGLBufferObject::ObjectType::ElementArrayBuffer);
+  this->Primitives[PrimitivePoints].IBO->Upload(sortedIndices.data(), sortedIndices.size(),
+    vtkOpenGLBufferObject::ObjectType::ElementArrayBuffer);
 }
 
 //----------------------------------------------------------------------------
@@ -1,8 +1,12 @@
 #include "vtkF3DPolyDataMapper.h"
 
 #include "F3DLog.h"
+#include "vtkF3DMemoryMesh.h"
 
 #include <vtkActor.h>
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkDataArrayRange.h>
 #include <vtkDoubleArray.h>
 #include <vtkMatrix4x4.h>
 #include <vtkObjectFactory.h>
@@ -18,9 +22,18 @@
 #include <vtkTexture.h>
 #include <vtkUniforms.h>
 #include <vtkVersion.h>
+#include <vtk_glad.h>
+
+#include <algorithm>
 
 vtkStandardNewMacro(vtkF3DPolyDataMapper);
 
+namespace
+{
+// VBOs filled with the arrays returned by GetDirtyRangesArrays
+constexpr std::array<const char*, 3> DirtyRangesVBONames = { "vertexMC", "normalMC", "tcoord" };
+}
+
 //-----------------------------------------------------------------------------
 vtkF3DPolyDataMapper::vtkF3DPolyDataMapper()
 {
@@ -359,3 +372,155 @@ void vtkF3DPolyDataMapper::ReplaceShaderTCoord(
 
   this->Superclass::ReplaceShaderTCoord(shaders, ren, actor);
 }
+
+//-----------------------------------------------------------------------------
+void vtkF3DPolyDataMapper::BuildBufferObjects(vtkRenderer* ren, vtkActor* act)
+{
+  if (this->UploadDirtyRanges(act))
+  {
+    // as done by the superclass, so that the buffer objects are not considered outdated anymore
+    this->VBOBuildTime.Modified();
+    return;
+  }
+
+  this->Superclass::BuildBufferObjects(ren, act);
+
+  const std::array<vtkDataArray*, 3> arrays = this->GetDirtyRangesArrays();
+  for (size_t i = 0; i < arrays.size(); i++)
+  {
+    this->BufferObjectsDirtyRangesArrays[i] = { arrays[i], arrays[i] ? arrays[i]->GetMTime() : 0 };
+  }
+  this->CollectInputState(arrays, this->BufferObjectsInputState);
+  this->BufferObjectsInput = this->CurrentInput;
+  this->BufferObjectsPropertyMTime = act->GetProperty()->GetMTime();
+  this->BufferObjectsBuildTime.Modified();
+}
+
+//-----------------------------------------------------------------------------
+bool vtkF3DPolyDataMapper::UploadDirtyRanges(vtkActor* act)
+{
+  vtkPolyData* poly = this->CurrentInput;
+  if (!poly || !poly->GetPoints() || poly != this->BufferObjectsInput ||
+    act->GetProperty()->GetMTime() != this->BufferObjectsPropertyMTime ||
+    this->GetMTime() > this->BufferObjectsBuildTime ||
+    (act->GetTexture() && act->GetTexture()->GetMTime() > this->BufferObjectsBuildTime))
+  {
+    return false;
+  }
+
+  // everything else than the arrays uploaded by ranges must be unchanged
+  const std::array<vtkDataArray*, 3> arrays = this->GetDirtyRangesArrays();
+  std::vector<std::pair<vtkObject*, vtkMTimeType>> state;
+  this->CollectInputState(arrays, state);
+  if (state != this->BufferObjectsInputState)
+  {
+    return false;
+  }
+
+  // check that all the modified arrays have ranges recorded since their last upload
+  std::array<std::vector<std::array<vtkIdType, 2>>, 3> ranges;
+  std::array<vtkOpenGLVertexBufferObject*, 3> vbos{};
+  for (size_t i = 0; i < arrays.size(); i++)
+  {
+    vtkDataArray* array = arrays[i];
+    const auto& [uploadedArray, uploadedMTime] = this->BufferObjectsDirtyRangesArrays[i];
+    if (array != uploadedArray)
+    {
+      return false;
+    }
+    if (!array || array->GetMTime() == uploadedMTime)
+    {
+      continue;
+    }
+    if (vtkF3DMemoryMesh::GetDirtyRanges(array, ranges[i]) != uploadedMTime)
+    {
+      return false;
+    }
+
+    // texture coordinates VBO can be filled with the color coordinates instead
+    vbos[i] = this->VBOs->GetVBO(::DirtyRangesVBONames[i]);
+    if (vbos[i] &&
+      (vbos[i]->GetDataType() != VTK_FLOAT || vbos[i]->GetCoordShiftAndScaleEnabled() ||
+        vbos[i]->GetNumberOfTuples() != array->GetNumberOfTuples() ||
+        vbos[i]->GetNumberOfComponents() != array->GetNumberOfComponents() ||
+        vbos[i]->GetStride() != array->GetNumberOfComponents() * sizeof(float) ||
+        (i == 2 && this->ColorCoordinates)))
+    {
+      return false;
+    }
+  }
+
+  std::vector<float> values;
+  for (size_t i = 0; i < arrays.size(); i++)
+  {
+    vtkDataArray* array = arrays[i];
+    if (!array || array->GetMTime() == this->BufferObjectsDirtyRangesArrays[i].second)
+    {
+      continue;
+    }
+
+    // a VBO may not exist if the array is not used for rendering
+    if (vbos[i])
+    {
+      const vtkIdType nbComponents = array->GetNumberOfComponents();
+      vbos[i]->Bind();
+      for (const auto& [begin, end] : ranges[i])
+      {
+        const auto range =
+          vtk::DataArrayValueRange(array, begin * nbComponents, end * nbComponents);
+        values.resize(range.size());
+        std::copy(range.cbegin(), range.cend(), values.begin());
+        glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(begin * vbos[i]->GetStride()),
+          static_cast<GLsizeiptr>(values.size() * sizeof(float)), values.data());
+      }
+      vbos[i]->Release();
+    }
+    this->BufferObjectsDirtyRangesArrays[i].second = array->GetMTime();
+  }
+
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+std::array<vtkDataArray*, 3> vtkF3DPolyDataMapper::GetDirtyRangesArrays()
+{
+  vtkPolyData* poly = this->CurrentInput;
+  return { poly->GetPoints() ? poly->GetPoints()->GetData() : nullptr,
+    poly->GetPointData()->GetNormals(), poly->GetPointData()->GetTCoords() };
+}
+
+//-----------------------------------------------------------------------------
+void vtkF3DPolyDataMapper::CollectInputState(
+  const std::array<vtkDataArray*, 3>& dirtyRangesArrays,
+  std::vector<std::pair<vtkObject*, vtkMTimeType>>& state)
+{
+  vtkPolyData* poly = this->CurrentInput;
+  state.clear();
+
+  for (vtkCellArray* cells : { poly->GetVerts(), poly->GetLines(), poly->GetPolys(),
+         poly->GetStrips() })
+  {
+    state.emplace_back(cells, cells ? cells->GetMTime() : 0);
+    if (cells)
+    {
+      state.emplace_back(cells->GetOffsetsArray(), cells->GetOffsetsArray()->GetMTime());
+      state.emplace_back(
+        cells->GetConnectivityArray(), cells->GetConnectivityArray()->GetMTime());
+    }
+  }
+
+  // the modification times of the arrays uploaded by ranges are checked separately
+  for (vtkDataSetAttributes* attributes :
+    { static_cast<vtkDataSetAttributes*>(poly->GetPointData()),
+      static_cast<vtkDataSetAttributes*>(poly->GetCellData()) })
+  {
+    state.emplace_back(attributes->GetScalars(), 0);
+    for (int i = 0; i < attributes->GetNumberOfArrays(); i++)
+    {
+      vtkAbstractArray* array = attributes->GetAbstractArray(i);
+      const bool uploadedByRanges =
+        std::ranges::find(dirtyRangesArrays, array) != dirtyRangesArrays.end();
+      state.emplace_back(array, uploadedByRanges ? 0 : array->GetMTime());
+    }
+  }
+}
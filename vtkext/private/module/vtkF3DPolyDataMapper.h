@@ -6,6 +6,8 @@
  * - skinning and morphing capabilities
  * - support for MatCap rendering
  * - support for TAA jittering
+ * - partial upload of the points, normals and texture coordinates modified in place,
+ *   see vtkF3DMemoryMesh::SetDirtyRanges
  */
 
 #ifndef vtkF3DPolyDataMapper_h
@@ -14,6 +16,13 @@
 #include <vtkOpenGLPolyDataMapper.h>
 #include <vtkVersion.h>
 
+#include <array>
+#include <utility>
+#include <vector>
+
+class vtkDataArray;
+class vtkPolyData;
+
 class vtkF3DPolyDataMapper : public vtkOpenGLPolyDataMapper
 {
 public:
@@ -42,13 +51,44 @@ protected:
   vtkF3DPolyDataMapper();
   ~vtkF3DPolyDataMapper() override = default;
 
+  /**
+   * Upload only the dirty ranges of the points, normals and texture coordinates if they are
+   * the only changes since the last build of the buffer objects.
+   * Otherwise, build all the buffer objects.
+   */
+  void BuildBufferObjects(vtkRenderer* ren, vtkActor* act) override;
+
 private:
+  /**
+   * Try to upload the dirty ranges of the modified arrays to their VBOs.
+   * Returns false if a full build of the buffer objects is needed.
+   */
+  bool UploadDirtyRanges(vtkActor* act);
+
+  /**
+   * Get the arrays which can be uploaded by ranges, in the order of DirtyRangesVBONames
+   */
+  std::array<vtkDataArray*, 3> GetDirtyRangesArrays();
+
+  /**
+   * Collect the other arrays and cells of the input with their modification times
+   */
+  void CollectInputState(const std::array<vtkDataArray*, 3>& dirtyRangesArrays,
+    std::vector<std::pair<vtkObject*, vtkMTimeType>>& state);
+
   /**
    * Returns true if a MatCap texture is defined by the user and the actor has normals
    */
   bool RenderWithMatCap(vtkActor* actor);
 
   vtkNew<vtkOpenGLBufferObject> JointMatrices;
+
+  // State of the input when the buffer objects were last uploaded
+  vtkTimeStamp BufferObjectsBuildTime;
+  vtkPolyData* BufferObjectsInput = nullptr;
+  vtkMTimeType BufferObjectsPropertyMTime = 0;
+  std::vector<std::pair<vtkObject*, vtkMTimeType>> BufferObjectsInputState;
+  std::array<std::pair<vtkDataArray*, vtkMTimeType>, 3> BufferObjectsDirtyRangesArrays{};
 };
 
 #endif
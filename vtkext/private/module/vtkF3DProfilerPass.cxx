@@ -0,0 +1,40 @@
+#include "vtkF3DProfilerPass.h"
+
+#include "F3DFrameProfiler.h"
+#include "vtkF3DRenderer.h"
+
+#include <vtkObjectFactory.h>
+#include <vtkRenderState.h>
+
+#include <cassert>
+
+vtkStandardNewMacro(vtkF3DProfilerPass);
+
+//------------------------------------------------------------------------------
+void vtkF3DProfilerPass::Render(const vtkRenderState* state)
+{
+  assert(this->DelegatePass != nullptr);
+
+  vtkF3DRenderer* renderer = vtkF3DRenderer::SafeDownCast(state->GetRenderer());
+  if (renderer)
+  {
+    F3DFrameProfiler::ScopedPass scope(renderer->GetFrameProfiler(), this->PassName);
+    this->DelegatePass->Render(state);
+  }
+  else
+  {
+    this->DelegatePass->Render(state);
+  }
+
+  this->NumberOfRenderedProps = this->DelegatePass->GetNumberOfRenderedProps();
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkF3DProfilerPass> vtkF3DProfilerPass::Wrap(
+  const std::string& name, vtkRenderPass* delegate)
+{
+  vtkSmartPointer<vtkF3DProfilerPass> pass = vtkSmartPointer<vtkF3DProfilerPass>::New();
+  pass->SetPassName(name);
+  pass->SetDelegatePass(delegate);
+  return pass;
+}
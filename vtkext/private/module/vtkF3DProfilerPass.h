@@ -0,0 +1,60 @@
+/**
+ * @class   vtkF3DProfilerPass
+ * @brief   Record the rendering of the delegate pass in the frame profiler.
+ *
+ * This pass only renders its delegate pass, inside a named pass of the frame profiler
+ * of the vtkF3DRenderer, so that render passes that are not implemented in F3D can be
+ * measured. Does nothing else if the renderer is not a vtkF3DRenderer.
+ *
+ * @sa
+ * F3DFrameProfiler
+ */
+
+#ifndef vtkF3DProfilerPass_h
+#define vtkF3DProfilerPass_h
+
+#include "vtkImageProcessingPass.h"
+
+#include <vtkSmartPointer.h>
+
+#include <string>
+
+class vtkF3DProfilerPass : public vtkImageProcessingPass
+{
+public:
+  static vtkF3DProfilerPass* New();
+  vtkTypeMacro(vtkF3DProfilerPass, vtkImageProcessingPass);
+
+  /**
+   * Render the delegate pass inside a named profiler pass.
+   */
+  void Render(const vtkRenderState* state) override;
+
+  /**
+   * Set the name of the profiler pass.
+   */
+  void SetPassName(const std::string& name)
+  {
+    this->PassName = name;
+  }
+
+  /**
+   * Convenience method creating a profiler pass named name that delegates to delegate.
+   */
+  static vtkSmartPointer<vtkF3DProfilerPass> Wrap(
+    const std::string& name, vtkRenderPass* delegate);
+
+  /**
+   * Forbidden copies.
+   */
+  vtkF3DProfilerPass(const vtkF3DProfilerPass&) = delete;
+  void operator=(const vtkF3DProfilerPass&) = delete;
+
+private:
+  vtkF3DProfilerPass() = default;
+  ~vtkF3DProfilerPass() override = default;
+
+  std::string PassName;
+};
+
+#endif
@@ -1,8 +1,10 @@
 #include "vtkF3DRenderPass.h"
 
+#include "F3DFrameProfiler.h"
 #include "vtkF3DHexagonalBokehBlurPass.h"
 #include "vtkF3DImporter.h"
 #include "vtkF3DOpenGLGridMapper.h"
+#include "vtkF3DProfilerPass.h"
 #include "vtkF3DRenderer.h"
 #include "vtkF3DStochasticTransparentPass.h"
 #include "vtkF3DTAAPass.h"
@@ -147,7 +149,7 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
     vtkNew<vtkF3DHexagonalBokehBlurPass> blur;
     blur->SetCircleOfConfusionRadius(this->CircleOfConfusionRadius);
     blur->SetDelegatePass(bgCamP);
-    this->BackgroundPass->SetDelegatePass(blur);
+    this->BackgroundPass->SetDelegatePass(vtkF3DProfilerPass::Wrap("Blur", blur));
   }
   else
   {
@@ -183,13 +185,14 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
         vtkNew<vtkCameraPass> ssaoCamP;
         ssaoCamP->SetDelegatePass(opaqueP);
 
+        // profile the opaque geometry separately so that the SSAO pass only measures the AO
         vtkNew<vtkSSAOPass> ssaoP;
         ssaoP->SetRadius(0.1 * bbox.GetDiagonalLength());
         ssaoP->SetBias(0.001 * bbox.GetDiagonalLength());
         ssaoP->SetKernelSize(200);
-        ssaoP->SetDelegatePass(ssaoCamP);
+        ssaoP->SetDelegatePass(vtkF3DProfilerPass::Wrap("Opaque", ssaoCamP));
 
-        collection->AddItem(ssaoP);
+        collection->AddItem(vtkF3DProfilerPass::Wrap("SSAO", ssaoP));
       }
       else
       {
@@ -238,15 +241,16 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
     // TAA
     if (renderer && renderer->GetAntiAliasingMode() == vtkF3DRenderer::AntiAliasingMode::TAA)
     {
+      // profile the geometry separately so that the TAA pass only measures the resolve
       vtkNew<vtkF3DTAAPass> taaP;
-      taaP->SetDelegatePass(camP);
+      taaP->SetDelegatePass(vtkF3DProfilerPass::Wrap("Geometry", camP));
 
       s->GetRenderer()->GetRenderWindow()->AddObserver(
         vtkCommand::WindowResizeEvent, taaP.Get(), &vtkF3DTAAPass::ResetIterations);
       s->GetRenderer()->GetRenderWindow()->GetInteractor()->GetInteractorStyle()->AddObserver(
         vtkCommand::InteractionEvent, taaP.Get(), &vtkF3DTAAPass::ResetIterations);
 
-      this->MainPass->SetDelegatePass(taaP);
+      this->MainPass->SetDelegatePass(vtkF3DProfilerPass::Wrap("TAA", taaP));
     }
     else
     {
@@ -315,6 +319,11 @@ void vtkF3DRenderPass::Render(const vtkRenderState* s)
   // problems when compositing layers in the Blend() function
   r->SetBackground(0.0, 0.0, 0.0);
 
+  // passes are recorded in the frame profiler of the renderer if any
+  vtkF3DRenderer* renderer = vtkF3DRenderer::SafeDownCast(r);
+  F3DFrameProfiler unusedProfiler;
+  F3DFrameProfiler& profiler = renderer ? renderer->GetFrameProfiler() : unusedProfiler;
+
   if (!uiOnly)
   {
     vtkRenderState backgroundState(s->GetRenderer());
@@ -322,10 +331,11 @@ void vtkF3DRenderPass::Render(const vtkRenderState* s)
       this->BackgroundProps.data(), static_cast<int>(this->BackgroundProps.size()));
     backgroundState.SetFrameBuffer(s->GetFrameBuffer());
 
+    profiler.BeginPass("Background");
     this->BackgroundPass->Render(&backgroundState);
+    profiler.EndPass();
 
     // the reflection result is used in the main pass so it must be rendered before
-    vtkF3DRenderer* renderer = vtkF3DRenderer::SafeDownCast(r);
 
 #if F3D_MODULE_RAYTRACING
     if (!this->UseRaytracing)
@@ -347,7 +357,9 @@ void vtkF3DRenderPass::Render(const vtkRenderState* s)
         this->ReflectCamera(originalCam, actorMatrix, reflectedCam);
         r->SetActiveCamera(reflectedCam);
 
+        profiler.BeginPass("Reflection");
         this->BakeReflectionPass->Render(&reflState);
+        profiler.EndPass();
 
         // restore camera
         r->SetActiveCamera(originalCam);
@@ -359,20 +371,26 @@ void vtkF3DRenderPass::Render(const vtkRenderState* s)
       this->MainProps.data(), static_cast<int>(this->MainProps.size()));
     mainState.SetFrameBuffer(s->GetFrameBuffer());
 
+    profiler.BeginPass("Main");
     this->MainPass->Render(&mainState);
+    profiler.EndPass();
 
     vtkRenderState mainOnTopState(s->GetRenderer());
     mainOnTopState.SetPropArrayAndCount(
       this->MainOnTopProps.data(), static_cast<int>(this->MainOnTopProps.size()));
     mainOnTopState.SetFrameBuffer(s->GetFrameBuffer());
 
+    profiler.BeginPass("MainOnTop");
     this->MainOnTopPass->Render(&mainOnTopState);
+    profiler.EndPass();
   }
 
   // restore background color before compositing the layers
   r->SetBackground(bgColor);
 
+  profiler.BeginPass("Blend");
   this->Blend(s);
+  profiler.EndPass();
 
   this->NumberOfRenderedProps = this->MainPass->GetNumberOfRenderedProps();
 }
@@ -1,9 +1,12 @@
 #include "vtkF3DRenderer.h"
 
+#include "F3DCacheKey.h"
 #include "F3DCheckerBoard.h"
 #include "F3DColoringInfoHandler.h"
 #include "F3DDefaultHDRI.h"
+#include "F3DHDRICache.h"
 #include "F3DLog.h"
+#include "F3DTrace.h"
 #include "F3DUtils.h"
 #include "vtkF3DCachedLUTTexture.h"
 #include "vtkF3DCachedSpecularTexture.h"
@@ -14,6 +17,7 @@
 #include "vtkF3DPointSplatMapper.h"
 #include "vtkF3DPointSplatUtilsSDF.h"
 #include "vtkF3DPolyDataMapper.h"
+#include "vtkF3DProfilerPass.h"
 #include "vtkF3DRenderPass.h"
 #include "vtkF3DSolidBackgroundPass.h"
 #include "vtkF3DUserRenderPass.h"
@@ -39,7 +43,6 @@
 #include <vtkMath.h>
 #include <vtkMathUtilities.h>
 #include <vtkMatrix4x4.h>
-#include <vtkMultiBlockDataSet.h>
 #include <vtkObjectFactory.h>
 #include <vtkOpaquePass.h>
 #include <vtkOpenGLFXAAPass.h>
@@ -72,14 +75,7 @@
 #include <vtkUniforms.h>
 #include <vtkVersion.h>
 #include <vtkVolumeProperty.h>
-#include <vtkXMLImageDataReader.h>
-#include <vtkXMLImageDataWriter.h>
-#include <vtkXMLMultiBlockDataWriter.h>
-#include <vtkXMLTableReader.h>
-#include <vtkXMLTableWriter.h>
 #include <vtk_glad.h>
-#include <vtksys/FStream.hxx>
-#include <vtksys/MD5.h>
 #include <vtksys/SystemTools.hxx>
 
 #if F3D_MODULE_UI
@@ -98,10 +94,11 @@
 #include <vtkOSPRayRendererNode.h>
 #endif
 
+#include <algorithm>
 #include <cctype>
-#include <chrono>
 #include <numbers>
 #include <sstream>
+#include <vector>
 
 namespace
 {
@@ -130,32 +127,6 @@ std::string DeprecatedCollapsePath(const fs::path& path)
   return collapsed;
 }
 
-//----------------------------------------------------------------------------
-// Compute the MD5 hash of an existing file on disk
-std::string ComputeFileHash(const std::string& filepath)
-{
-  unsigned char digest[16];
-  char md5Hash[33];
-  md5Hash[32] = '\0';
-
-  std::size_t length = vtksys::SystemTools::FileLength(filepath);
-  std::vector<char> buffer(length);
-
-  vtksys::ifstream file;
-  file.open(filepath.c_str(), std::ios_base::binary);
-  file.read(buffer.data(), length);
-
-  vtksysMD5* md5 = vtksysMD5_New();
-  vtksysMD5_Initialize(md5);
-  vtksysMD5_Append(
-    md5, reinterpret_cast<const unsigned char*>(buffer.data()), static_cast<int>(length));
-  vtksysMD5_Finalize(md5, digest);
-  vtksysMD5_DigestToHex(digest, md5Hash);
-  vtksysMD5_Delete(md5);
-
-  return md5Hash;
-}
-
 //----------------------------------------------------------------------------
 // Download texture from the GPU to a vtkImageData
 vtkSmartPointer<vtkImageData> SaveTextureToImage(
@@ -276,11 +247,7 @@ vtkF3DRenderer::~vtkF3DRenderer() = default;
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ReleaseGraphicsResources(vtkWindow* w)
 {
-  if (this->Timer != 0)
-  {
-    glDeleteQueries(1, &this->Timer);
-    this->Timer = 0;
-  }
+  this->FrameProfiler.ReleaseGraphicsResources();
 
   this->UIActor->ReleaseGraphicsResources(w);
 
@@ -506,7 +473,7 @@ void vtkF3DRenderer::ConfigureRenderPasses()
       this->ConfigureColoringAndVisibilities();
       depthP->SetColorMap(this->ColorTransferFunction);
     }
-    renderingPass = depthP;
+    renderingPass = vtkF3DProfilerPass::Wrap("DisplayDepth", depthP);
   }
 
   if (this->AntiAliasingModeEnabled == vtkF3DRenderer::AntiAliasingMode::SSAA)
@@ -516,7 +483,7 @@ void vtkF3DRenderer::ConfigureRenderPasses()
     ssaaP->SetColorFormat(vtkTextureObject::Float16);
 #endif
     ssaaP->SetDelegatePass(renderingPass);
-    renderingPass = ssaaP;
+    renderingPass = vtkF3DProfilerPass::Wrap("SSAA", ssaaP);
   }
 
   if (this->UseToneMappingPass)
@@ -524,7 +491,7 @@ void vtkF3DRenderer::ConfigureRenderPasses()
     vtkNew<vtkToneMappingPass> toneP;
     toneP->SetToneMappingType(vtkToneMappingPass::NeutralPBR);
     toneP->SetDelegatePass(renderingPass);
-    renderingPass = toneP;
+    renderingPass = vtkF3DProfilerPass::Wrap("ToneMapping", toneP);
   }
 
   if (!this->HDRISkyboxVisible)
@@ -533,7 +500,7 @@ void vtkF3DRenderer::ConfigureRenderPasses()
     // before it goes through the next passes
     vtkNew<vtkF3DSolidBackgroundPass> bgPass;
     bgPass->SetDelegatePass(renderingPass);
-    renderingPass = bgPass;
+    renderingPass = vtkF3DProfilerPass::Wrap("SolidBackground", bgPass);
   }
 
   if (this->AntiAliasingModeEnabled == vtkF3DRenderer::AntiAliasingMode::FXAA)
@@ -542,7 +509,7 @@ void vtkF3DRenderer::ConfigureRenderPasses()
     fxaaP->SetDelegatePass(renderingPass);
 
     this->SetPass(fxaaP);
-    renderingPass = fxaaP;
+    renderingPass = vtkF3DProfilerPass::Wrap("FXAA", fxaaP);
   }
 
   if (this->FinalShader.has_value())
@@ -553,7 +520,7 @@ void vtkF3DRenderer::ConfigureRenderPasses()
       vtkNew<vtkF3DUserRenderPass> userP;
       userP->SetUserShader(this->FinalShader.value().c_str());
       userP->SetDelegatePass(renderingPass);
-      renderingPass = userP;
+      renderingPass = vtkF3DProfilerPass::Wrap("FinalShader", userP);
     }
     else
     {
@@ -804,6 +771,7 @@ void vtkF3DRenderer::ShowGrid(bool show)
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ConfigureGridUsingCurrentActors()
 {
+  F3D_TRACE_SCOPE("Configure grid");
   // Configure grid using visible prop bounds and actors
   // Also initialize GridInfo
   bool show = this->GridVisible;
@@ -1181,19 +1149,19 @@ void vtkF3DRenderer::SetCachePath(const std::string& cachePath)
 }
 
 //----------------------------------------------------------------------------
-bool vtkF3DRenderer::CheckForSHCache(std::string& path)
+bool vtkF3DRenderer::CheckForIBLCache(std::string& path, F3DHDRICache* cache)
 {
-  assert(this->HasValidHDRIHash);
-  path = this->CachePath + "/" + this->HDRIHash + "/sh.vtt";
-  return vtksys::SystemTools::FileExists(path, true);
-}
+  if (!this->HasValidHDRIHash)
+  {
+    return false;
+  }
+  path = this->CachePath + "/" + this->HDRIHash + "/ibl.bin";
 
-//----------------------------------------------------------------------------
-bool vtkF3DRenderer::CheckForSpecCache(std::string& path)
-{
-  assert(this->HasValidHDRIHash);
-  path = this->CachePath + "/" + this->HDRIHash + "/specular.vtm";
-  return vtksys::SystemTools::FileExists(path, true);
+  // Opening the cache only maps it and validates its header and size
+  F3DHDRICache localCache;
+  F3DHDRICache& iblCache = cache ? *cache : localCache;
+  return !this->CachePath.empty() && iblCache.Open(path) && iblCache.HasLayout(6, 3) &&
+    iblCache.GetNumberOfSphericalHarmonics() > 0;
 }
 
 //----------------------------------------------------------------------------
@@ -1238,6 +1206,7 @@ void vtkF3DRenderer::ConfigureHDRI()
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ConfigureHDRIReader()
 {
+  F3D_TRACE_SCOPE_DETAIL("Configure HDRI reader", this->HDRIFile);
   if (!this->HasValidHDRIReader && (this->HDRISkyboxVisible || this->GetUseImageBasedLighting()))
   {
     this->HDRIReader = nullptr;
@@ -1296,12 +1265,23 @@ void vtkF3DRenderer::ConfigureHDRIReader()
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ConfigureHDRIHash()
 {
+  F3D_TRACE_SCOPE_DETAIL("Hash HDRI", this->HDRIFile);
   if (!this->HasValidHDRIHash && this->GetUseImageBasedLighting() && this->HasValidHDRIReader)
   {
-    // Compute HDRI MD5, here we know the HDRIFile is not empty
-    this->HDRIHash = ::ComputeFileHash(this->HDRIFile);
-    this->HasValidHDRIHash = true;
-    this->CreateCacheDirectory();
+    // Compute HDRI hash, here we know the HDRIFile is not empty
+    // It is memoized in the cache directory so that an unchanged HDRI is not read again
+    this->HDRIHash = F3DCacheKey::ComputeFileHash(this->HDRIFile, this->CachePath);
+    if (this->HDRIHash.empty())
+    {
+      // without a hash, the caches of this HDRI cannot be told apart from the ones of another
+      F3DLog::Print(F3DLog::Severity::Warning,
+        "Cannot compute the hash of HDRI file " + this->HDRIFile + ", it will not be cached.");
+    }
+    else
+    {
+      this->HasValidHDRIHash = true;
+      this->CreateCacheDirectory();
+    }
     this->HDRIHashConfigured = true;
   }
 }
@@ -1309,6 +1289,7 @@ void vtkF3DRenderer::ConfigureHDRIHash()
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ConfigureHDRITexture()
 {
+  F3D_TRACE_SCOPE_DETAIL("Configure HDRI texture", this->HDRIFile);
   if (!this->HasValidHDRITexture)
   {
     bool needHDRITexture = this->HDRISkyboxVisible || this->GetUseImageBasedLighting();
@@ -1318,8 +1299,7 @@ void vtkF3DRenderer::ConfigureHDRITexture()
       std::string dummy;
       needHDRITexture = this->HDRISkyboxVisible ||
         (this->GetUseImageBasedLighting() &&
-          (!this->CheckForSHCache(dummy) || !this->CheckForSpecCache(dummy) ||
-            this->UseRaytracing));
+          (!this->CheckForIBLCache(dummy) || this->UseRaytracing));
     }
 
     if (needHDRITexture)
@@ -1365,18 +1345,20 @@ void vtkF3DRenderer::ConfigureHDRITexture()
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ConfigureHDRILUT()
 {
+  F3D_TRACE_SCOPE("Configure HDRI LUT");
   if (this->GetUseImageBasedLighting() && !this->HasValidHDRILUT)
   {
     vtkF3DCachedLUTTexture* lut = vtkF3DCachedLUTTexture::SafeDownCast(this->EnvMapLookupTable);
     assert(lut);
 
     // Check LUT cache
-    std::string lutCachePath = this->CachePath + "/lut.vti";
-    bool lutCacheExists = vtksys::SystemTools::FileExists(lutCachePath, true);
-    if (lutCacheExists)
+    std::string lutCachePath = this->CachePath + "/lut.bin";
+    F3DHDRICache lutCache;
+    if (!this->CachePath.empty() && lutCache.Open(lutCachePath) && lutCache.HasLayout(1, 2))
     {
       lut->SetFileName(lutCachePath.c_str());
       lut->UseCacheOn();
+      F3DLog::Print(F3DLog::Severity::Debug, "Using HDRI LUT cache " + lutCachePath);
     }
     else
     {
@@ -1394,10 +1376,17 @@ void vtkF3DRenderer::ConfigureHDRILUT()
           ::SaveTextureToImage(lut->GetTextureObject(), GL_TEXTURE_2D, 0, lut->GetLUTSize());
         assert(img);
 
-        vtkNew<vtkXMLImageDataWriter> writer;
-        writer->SetFileName(lutCachePath.c_str());
-        writer->SetInputData(img);
-        writer->Write();
+        F3DHDRICache::TextureInfo info;
+        info.DataType = img->GetScalarType();
+        info.Components = static_cast<unsigned int>(img->GetNumberOfScalarComponents());
+        info.Faces = 1;
+        info.Size = lut->GetLUTSize();
+        info.Levels = 1;
+        if (!F3DHDRICache::Write(lutCachePath, info, { img->GetScalarPointer() }))
+        {
+          F3DLog::Print(F3DLog::Severity::Warning,
+            std::string("Cannot write HDRI LUT texture cache ") + lutCachePath);
+        }
       }
       else
       {
@@ -1413,47 +1402,30 @@ void vtkF3DRenderer::ConfigureHDRILUT()
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ConfigureHDRISphericalHarmonics()
 {
+  F3D_TRACE_SCOPE_DETAIL("Configure HDRI spherical harmonics", this->HDRIFile);
   if (this->GetUseImageBasedLighting() && !this->HasValidHDRISH)
   {
-    // Check spherical harmonics cache
-    std::string shCachePath;
-    if (this->CheckForSHCache(shCachePath))
+    // Check image based lighting cache, the spherical harmonics are written with the specular
+    std::string iblCachePath;
+    F3DHDRICache iblCache;
+    if (this->CheckForIBLCache(iblCachePath, &iblCache))
     {
-      vtkNew<vtkXMLTableReader> reader;
-      reader->SetFileName(shCachePath.c_str());
-      reader->Update();
-
-      this->SphericalHarmonics = vtkFloatArray::SafeDownCast(reader->GetOutput()->GetColumn(0));
+      this->SphericalHarmonics = vtkSmartPointer<vtkFloatArray>::New();
+      this->SphericalHarmonics->SetName("SphericalHarmonics");
+      this->SphericalHarmonics->SetNumberOfComponents(3);
+      this->SphericalHarmonics->SetNumberOfTuples(iblCache.GetNumberOfSphericalHarmonics());
+      std::copy_n(iblCache.GetSphericalHarmonics(), iblCache.GetNumberOfSphericalHarmonics() * 3,
+        this->SphericalHarmonics->GetPointer(0));
     }
-    else
+    else if (!this->SphericalHarmonics ||
+      this->HDRITexture->GetInput()->GetMTime() > this->SphericalHarmonics->GetMTime() ||
+      !this->HasValidHDRISH)
     {
-      if (!this->SphericalHarmonics ||
-        this->HDRITexture->GetInput()->GetMTime() > this->SphericalHarmonics->GetMTime() ||
-        !this->HasValidHDRISH)
-      {
-        vtkNew<vtkSphericalHarmonics> sh;
-        sh->SetInputData(this->HDRITexture->GetInput());
-        sh->Update();
-        this->SphericalHarmonics = vtkFloatArray::SafeDownCast(
-          vtkTable::SafeDownCast(sh->GetOutputDataObject(0))->GetColumn(0));
-      }
-
-      if (!this->CachePath.empty())
-      {
-        // Create spherical harmonics cache file
-        vtkNew<vtkTable> table;
-        table->AddColumn(this->SphericalHarmonics);
-
-        vtkNew<vtkXMLTableWriter> writer;
-        writer->SetInputData(table);
-        writer->SetFileName(shCachePath.c_str());
-        writer->Write();
-      }
-      else
-      {
-        F3DLog::Print(F3DLog::Severity::Warning,
-          "Cannot cache HDRI Spherical Harmonics as no cache path has been set.");
-      }
+      vtkNew<vtkSphericalHarmonics> sh;
+      sh->SetInputData(this->HDRITexture->GetInput());
+      sh->Update();
+      this->SphericalHarmonics = vtkFloatArray::SafeDownCast(
+        vtkTable::SafeDownCast(sh->GetOutputDataObject(0))->GetColumn(0));
     }
     this->HasValidHDRISH = true;
   }
@@ -1463,18 +1435,21 @@ void vtkF3DRenderer::ConfigureHDRISphericalHarmonics()
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ConfigureHDRISpecular()
 {
+  F3D_TRACE_SCOPE_DETAIL("Configure HDRI specular", this->HDRIFile);
   if (this->GetUseImageBasedLighting() && !this->HasValidHDRISpec)
   {
     vtkF3DCachedSpecularTexture* spec =
       vtkF3DCachedSpecularTexture::SafeDownCast(this->EnvMapPrefiltered);
     assert(spec);
 
-    // Check specular cache
-    std::string specCachePath;
-    if (this->CheckForSpecCache(specCachePath))
+    // Check image based lighting cache
+    std::string iblCachePath;
+    if (this->CheckForIBLCache(iblCachePath))
     {
-      spec->SetFileName(specCachePath.c_str());
+      spec->SetFileName(iblCachePath.c_str());
       spec->UseCacheOn();
+      F3DLog::Print(
+        F3DLog::Severity::Debug, "Using HDRI image based lighting cache " + iblCachePath);
     }
     else
     {
@@ -1486,32 +1461,47 @@ void vtkF3DRenderer::ConfigureHDRISpecular()
       }
       assert(spec->GetTextureObject());
 
-      if (!this->CachePath.empty())
+      // an HDRI without a hash has already been reported as not cached
+      if (!this->CachePath.empty() && this->HasValidHDRIHash)
       {
         unsigned int nbLevels = spec->GetPrefilterLevels();
         unsigned int size = spec->GetPrefilterSize();
 
-        vtkNew<vtkMultiBlockDataSet> mb;
-        mb->SetNumberOfBlocks(nbLevels);
-
+        // Levels are kept alive until written, each one holds the 6 faces contiguously
+        std::vector<vtkSmartPointer<vtkImageData>> images;
+        std::vector<const void*> levels;
         for (unsigned int i = 0; i < nbLevels; i++)
         {
           vtkSmartPointer<vtkImageData> img = ::SaveTextureToImage(
             spec->GetTextureObject(), GL_TEXTURE_CUBE_MAP_POSITIVE_X, i, size >> i);
           assert(img);
-          mb->SetBlock(i, img);
+          levels.emplace_back(img->GetScalarPointer());
+          images.emplace_back(img);
+        }
+
+        F3DHDRICache::TextureInfo info;
+        info.DataType = images[0]->GetScalarType();
+        info.Components = static_cast<unsigned int>(images[0]->GetNumberOfScalarComponents());
+        info.Faces = 6;
+        info.Size = size;
+        info.Levels = nbLevels;
+
+        // Store the spherical harmonics alongside so that a single file is needed per HDRI
+        std::vector<float> sphericalHarmonics;
+        if (this->SphericalHarmonics)
+        {
+          const float* shData = this->SphericalHarmonics->GetPointer(0);
+          sphericalHarmonics.assign(shData,
+            shData + this->SphericalHarmonics->GetNumberOfTuples() * 3);
         }
 
-        vtkNew<vtkXMLMultiBlockDataWriter> writer;
-        writer->SetCompressorTypeToNone();
-        writer->SetDataModeToAppended();
-        writer->EncodeAppendedDataOff();
-        writer->SetHeaderTypeToUInt64();
-        writer->SetFileName(specCachePath.c_str());
-        writer->SetInputData(mb);
-        writer->Write();
+        if (!F3DHDRICache::Write(iblCachePath, info, levels, sphericalHarmonics))
+        {
+          F3DLog::Print(F3DLog::Severity::Warning,
+            std::string("Cannot write HDRI image based lighting cache ") + iblCachePath);
+        }
       }
-      else
+      else if (this->CachePath.empty())
       {
         F3DLog::Print(F3DLog::Severity::Warning,
           "Cannot cache HDRI Specular texture as no cache path has been set.");
@@ -1526,6 +1516,7 @@ void vtkF3DRenderer::ConfigureHDRISpecular()
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ConfigureHDRISkybox()
 {
+  F3D_TRACE_SCOPE("Configure HDRI skybox");
   this->SkyboxActor->SetTexture(this->HDRITexture);
   this->SkyboxActor->SetVisibility(this->HDRISkyboxVisible);
   this->HDRISkyboxConfigured = true;
@@ -1830,6 +1821,16 @@ void vtkF3DRenderer::ShowTimer(bool show)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::ShowFrameStats(bool show)
+{
+  if (this->FrameStatsVisible != show)
+  {
+    this->FrameStatsVisible = show;
+    this->UIActor->SetFrameStatsVisibility(show);
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ShowFilename(bool show)
 {
@@ -2076,6 +2077,7 @@ void vtkF3DRenderer::SetInteractionStyle(const std::string& style)
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::UpdateActors()
 {
+  F3D_TRACE_SCOPE("Update actors");
   assert(this->Importer);
 
   // Handle importer changes
@@ -2116,6 +2118,19 @@ void vtkF3DRenderer::UpdateActors()
   }
   this->ImporterUpdateTimeStamp = importerUpdateMTime;
 
+  // Instanced actors are only expanded when needed by the point sprites or the normal glyphs,
+  // as it costs as much as not using instancing, they are colored by their instances otherwise
+  if ((this->UsePointSprites || this->UseNormalGlyphs) &&
+    !this->Importer->GetInstancedActors().empty() && this->Importer->ExpandInstancedActors())
+  {
+    this->ActorsPropertiesConfigured = false;
+    this->PointSpritesConfigured = false;
+    this->ColoringConfigured = false;
+    this->ColoringMappersConfigured = false;
+    this->ColoringPointSpritesMappersConfigured = false;
+    this->NormalGlyphsConfigured = false;
+  }
+
   if (!this->ActorsPropertiesConfigured)
   {
     this->ConfigureActorsProperties();
@@ -2194,48 +2209,32 @@ void vtkF3DRenderer::Render()
     this->UpdateNormalGlyphsScale();
   }
 
-  if (!this->TimerVisible)
-  {
-    this->Superclass::Render();
-    return;
-  }
-
-  auto cpuStart = std::chrono::high_resolution_clock::now();
-  if (this->Timer == 0)
-  {
-    glGenQueries(1, &this->Timer);
-  }
-
   vtkInformation* info = this->GetInformation();
   bool uiOnly = info->Get(vtkF3DRenderPass::RENDER_UI_ONLY());
-
-#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
-  if (!uiOnly)
+  if (uiOnly)
   {
-    glBeginQuery(GL_TIME_ELAPSED, this->Timer);
+    this->Superclass::Render();
+    return;
   }
-#endif
 
+  // GPU times are read back a few frames later, the latest resolved frame is displayed
+  this->FrameProfiler.BeginFrame();
   this->Superclass::Render();
+  this->FrameProfiler.EndFrame();
 
-  auto cpuElapsed = std::chrono::high_resolution_clock::now() - cpuStart;
-
-  if (!uiOnly)
+  const F3DFrameProfiler::FrameStats& stats = this->FrameProfiler.GetLatestStats();
+  if (stats.Frame != this->LastProfiledFrame)
   {
-    // Get CPU frame time
-    double elapsedTime =
-      std::chrono::duration_cast<std::chrono::microseconds>(cpuElapsed).count() * 1e-6;
-
-#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
-    glEndQuery(GL_TIME_ELAPSED);
-    GLint elapsed;
-    glGetQueryObjectiv(this->Timer, GL_QUERY_RESULT, &elapsed);
+    this->LastProfiledFrame = stats.Frame;
 
     // Get min between CPU frame time and GPU frame time
-    elapsedTime = std::min(elapsedTime, elapsed * 1e-9);
-#endif
-
+    double elapsedTime = stats.CPUTime;
+    if (stats.GPUTime >= 0.0)
+    {
+      elapsedTime = std::min(elapsedTime, stats.GPUTime);
+    }
     this->UIActor->UpdateFpsValue(elapsedTime);
+    this->UIActor->UpdateFrameStats(stats);
   }
 }
 
@@ -2506,6 +2505,7 @@ void vtkF3DRenderer::SetPointSpritesUseInstancing(bool useInstancing)
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ConfigureActorsProperties()
 {
+  F3D_TRACE_SCOPE("Configure actors properties");
   assert(this->Importer);
 
   const double* surfaceColor = nullptr;
@@ -2756,6 +2756,7 @@ void vtkF3DRenderer::ConfigureActorsProperties()
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ConfigurePointSprites()
 {
+  F3D_TRACE_SCOPE("Configure point sprites");
   if (!this->UsePointSprites)
   {
     return;
@@ -3143,6 +3144,7 @@ void vtkF3DRenderer::SetComponentForColoring(int component)
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ConfigureColoringAndVisibilities()
 {
+  F3D_TRACE_SCOPE("Configure coloring");
   assert(this->Importer);
 
   // Recover coloring information and update handler
@@ -3187,6 +3189,23 @@ void vtkF3DRenderer::ConfigureColoringAndVisibilities()
       coloring.OriginalActor->VisibilityOff();
     }
   }
+  for (const auto& instanced : this->Importer->GetInstancedActors())
+  {
+    instanced.Actor->SetVisibility(geometriesVisible &&
+      !(instanced.Actor->GetPropertyKeys() &&
+        instanced.Actor->GetPropertyKeys()->Has(vtkF3DMetaImporter::ACTOR_HIDDEN())));
+    if (geometriesVisible)
+    {
+      // Instanced actors are colored directly by the point arrays of their instances,
+      // cell arrays of the instances are not supported by the glyph mapper
+      if (!hasColoring || this->UseCellColoring ||
+        !vtkF3DRenderer::ConfigureMapperForColoring(instanced.Mapper, info.value().Name,
+          this->ComponentForColoring, this->ColorTransferFunction, this->ColorRange, false))
+      {
+        instanced.Mapper->vtkMapper::ShallowCopy(instanced.ImportedColoring);
+      }
+    }
+  }
   if (geometriesVisible)
   {
     this->ColoringMappersConfigured = true;
@@ -3300,12 +3319,19 @@ std::string vtkF3DRenderer::GetColoringDescription()
 }
 
 //----------------------------------------------------------------------------
-bool vtkF3DRenderer::ConfigureMapperForColoring(vtkPolyDataMapper* mapper, const std::string& name,
+bool vtkF3DRenderer::ConfigureMapperForColoring(vtkMapper* mapper, const std::string& name,
   int component, vtkColorTransferFunction* ctf, double range[2], bool cellFlag)
 {
+  vtkDataSet* input = mapper->GetInputAsDataSet();
+  if (!input)
+  {
+    mapper->ScalarVisibilityOff();
+    return false;
+  }
+
   vtkDataSetAttributes* data = cellFlag
-    ? static_cast<vtkDataSetAttributes*>(mapper->GetInput()->GetCellData())
-    : static_cast<vtkDataSetAttributes*>(mapper->GetInput()->GetPointData());
+    ? static_cast<vtkDataSetAttributes*>(input->GetCellData())
+    : static_cast<vtkDataSetAttributes*>(input->GetPointData());
   vtkDataArray* array = data->GetArray(name.c_str());
   if (!array || component >= array->GetNumberOfComponents())
   {
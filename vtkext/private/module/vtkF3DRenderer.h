@@ -11,6 +11,7 @@
 #ifndef vtkF3DRenderer_h
 #define vtkF3DRenderer_h
 
+#include "F3DFrameProfiler.h"
 #include "F3DStyle.h"
 
 #include "vtkF3DMetaImporter.h"
@@ -28,6 +29,7 @@
 
 namespace fs = std::filesystem;
 
+class F3DHDRICache;
 class vtkCameraOrientationRepresentation;
 class vtkCameraOrientationWidget;
 class vtkColorTransferFunction;
@@ -93,6 +95,7 @@ public:
   void ShowAxesGrid(bool show);
   void ShowEdge(const std::optional<bool>& show);
   void ShowTimer(bool show);
+  void ShowFrameStats(bool show);
   void ShowMetaData(bool show);
   void ShowFilename(bool show);
   void ShowHDRIFilename(bool show);
@@ -189,10 +192,19 @@ public:
    * Reimplemented to configure:
    *  - ActorsProperties
    *  - Timer
-   * before actual rendering, only when needed
+   * before actual rendering, only when needed.
+   * The frame is recorded in the frame profiler, except when only rendering the UI.
    */
   void Render() override;
 
+  /**
+   * Get the frame profiler recording the CPU and GPU times of the render passes
+   */
+  F3DFrameProfiler& GetFrameProfiler()
+  {
+    return this->FrameProfiler;
+  }
+
   /**
    * Reimplemented to account for grid actor
    */
@@ -619,13 +631,12 @@ private:
   void ConfigureHDRISkybox();
   ///@}
 
-  ///@{
   /**
-   * Methods to check if certain HDRI caches are available
+   * Get the path of the image based lighting cache of the current HDRI,
+   * holding both the spherical harmonics and the prefiltered specular texture,
+   * and check it is a valid cache file. If provided, cache is left open on success.
    */
-  bool CheckForSpecCache(std::string& path);
-  bool CheckForSHCache(std::string& path);
-  ///@}
+  bool CheckForIBLCache(std::string& path, F3DHDRICache* cache = nullptr);
 
   /**
    * Apply the given up vector to the scene, computing an appropriate right vector.
@@ -670,10 +681,10 @@ private:
   void ConfigureColoringAndVisibilities();
 
   /**
-   * Convenience method for configuring a poly data mapper for coloring
+   * Convenience method for configuring a poly data or glyph mapper for coloring
    * Return true if mapper was configured for coloring, false otherwise.
    */
-  static bool ConfigureMapperForColoring(vtkPolyDataMapper* mapper, const std::string& name,
+  static bool ConfigureMapperForColoring(vtkMapper* mapper, const std::string& name,
     int component, vtkColorTransferFunction* ctf, double range[2], bool cellFlag = false);
 
   /**
@@ -745,7 +756,8 @@ private:
   vtkNew<vtkSkybox> SkyboxActor;
   vtkNew<vtkF3DUIActor> UIActor;
 
-  unsigned int Timer = 0; // Timer OpenGL query
+  F3DFrameProfiler FrameProfiler;
+  uint64_t LastProfiledFrame = 0;
 
   bool CheatSheetConfigured = false;
   bool ActorsPropertiesConfigured = false;
@@ -774,6 +786,7 @@ private:
 #endif
   std::optional<bool> EdgeVisible;
   bool TimerVisible = false;
+  bool FrameStatsVisible = false;
   bool FilenameVisible = false;
   bool MetaDataVisible = false;
   bool HDRIFilenameVisible = false;
@@ -120,6 +120,12 @@ void vtkF3DUIActor::SetFpsCounterVisibility(bool show)
   this->FpsCounterVisible = show;
 }
 
+//----------------------------------------------------------------------------
+void vtkF3DUIActor::SetFrameStatsVisibility(bool show)
+{
+  this->FrameStatsVisible = show;
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DUIActor::SetNotificationVisibility(bool show)
 {
@@ -177,6 +183,12 @@ void vtkF3DUIActor::UpdateFpsValue(const double elapsedFrameTime)
   this->FpsValue = static_cast<int>(std::round(1.0 / averageFrameTime));
 }
 
+//----------------------------------------------------------------------------
+void vtkF3DUIActor::UpdateFrameStats(const F3DFrameProfiler::FrameStats& stats)
+{
+  this->FrameStats = stats;
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DUIActor::SetFontFile(const std::string& font)
 {
@@ -295,6 +307,11 @@ int vtkF3DUIActor::RenderOverlay(vtkViewport* vp)
     this->RenderFpsCounter();
   }
 
+  if (this->FrameStatsVisible)
+  {
+    this->RenderFrameStats();
+  }
+
   if (this->AnimationProgressMode != AnimationProgressBarMode::NONE)
   {
     this->RenderAnimationProgressBar();
@@ -8,6 +8,7 @@
 #ifndef vtkF3DUIActor_h
 #define vtkF3DUIActor_h
 
+#include <F3DFrameProfiler.h>
 #include <F3DStyle.h>
 #include <array>
 #include <chrono>
@@ -171,6 +172,12 @@ public:
    */
   void SetFpsCounterVisibility(bool show);
 
+  /**
+   * Set the frame stats visibility
+   * False by default
+   */
+  void SetFrameStatsVisibility(bool show);
+
   /**
    * Set the notification visibility
    * False by default
@@ -189,6 +196,11 @@ public:
    */
   void UpdateFpsValue(const double elapsedFrameTime);
 
+  /**
+   * Updates the frame stats displayed per render pass
+   */
+  void UpdateFrameStats(const F3DFrameProfiler::FrameStats& stats);
+
   /**
    * Set the font file path
    * Use Inter font by default if empty
@@ -339,6 +351,13 @@ protected:
   {
   }
 
+  /**
+   * Render the frame stats UI widget
+   */
+  virtual void RenderFrameStats()
+  {
+  }
+
   /**
    * Render the console widget
    */
@@ -398,6 +417,9 @@ protected:
   double TotalFrameTimes = 0.0;
   int FpsValue = 0;
 
+  bool FrameStatsVisible = false;
+  F3DFrameProfiler::FrameStats FrameStats;
+
   std::string FontFile = "";
   double FontScale = 1.0;
 
@@ -0,0 +1,336 @@
+#include "F3DCacheKey.h"
+
+#include <vtksys/Encoding.hxx>
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#ifdef _WIN32
+// std::min is used below
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <sys/stat.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+//----------------------------------------------------------------------------
+// Streaming implementation of the XXH64 hash
+class Hasher
+{
+public:
+  void Append(const unsigned char* data, std::size_t size)
+  {
+    this->TotalSize += size;
+
+    // Complete a pending stripe first
+    if (this->BufferSize > 0)
+    {
+      const std::size_t count = std::min(size, StripeSize - this->BufferSize);
+      std::memcpy(this->Buffer.data() + this->BufferSize, data, count);
+      this->BufferSize += count;
+      data += count;
+      size -= count;
+      if (this->BufferSize < StripeSize)
+      {
+        return;
+      }
+      this->ProcessStripe(this->Buffer.data());
+      this->BufferSize = 0;
+    }
+
+    for (; size >= StripeSize; data += StripeSize, size -= StripeSize)
+    {
+      this->ProcessStripe(data);
+    }
+
+    std::memcpy(this->Buffer.data(), data, size);
+    this->BufferSize = size;
+  }
+
+  std::string Finalize() const
+  {
+    uint64_t hash;
+    if (this->TotalSize >= StripeSize)
+    {
+      hash = std::rotl(this->Lanes[0], 1) + std::rotl(this->Lanes[1], 7) +
+        std::rotl(this->Lanes[2], 12) + std::rotl(this->Lanes[3], 18);
+      for (uint64_t lane : this->Lanes)
+      {
+        hash = (hash ^ Round(0, lane)) * Prime1 + Prime4;
+      }
+    }
+    else
+    {
+      hash = Prime5;
+    }
+    hash += this->TotalSize;
+
+    const unsigned char* data = this->Buffer.data();
+    std::size_t size = this->BufferSize;
+    for (; size >= 8; data += 8, size -= 8)
+    {
+      hash = std::rotl(hash ^ Round(0, Read<uint64_t>(data)), 27) * Prime1 + Prime4;
+    }
+    if (size >= 4)
+    {
+      hash = std::rotl(hash ^ (Read<uint32_t>(data) * Prime1), 23) * Prime2 + Prime3;
+      data += 4;
+      size -= 4;
+    }
+    for (; size > 0; data++, size--)
+    {
+      hash = std::rotl(hash ^ (*data * Prime5), 11) * Prime1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= Prime2;
+    hash ^= hash >> 29;
+    hash *= Prime3;
+    hash ^= hash >> 32;
+
+    std::ostringstream stream;
+    stream << std::hex;
+    stream.width(16);
+    stream.fill('0');
+    stream << hash;
+    return stream.str();
+  }
+
+private:
+  static constexpr uint64_t Prime1 = 11400714785074694791ULL;
+  static constexpr uint64_t Prime2 = 14029467366897019727ULL;
+  static constexpr uint64_t Prime3 = 1609587929392839161ULL;
+  static constexpr uint64_t Prime4 = 9650029242287828579ULL;
+  static constexpr uint64_t Prime5 = 2870177450012600261ULL;
+  static constexpr std::size_t StripeSize = 32;
+
+  template<typename T>
+  static uint64_t Read(const unsigned char* data)
+  {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+  }
+
+  static uint64_t Round(uint64_t lane, uint64_t input)
+  {
+    return std::rotl(lane + input * Prime2, 31) * Prime1;
+  }
+
+  void ProcessStripe(const unsigned char* data)
+  {
+    for (std::size_t i = 0; i < 4; i++)
+    {
+      this->Lanes[i] = Round(this->Lanes[i], Read<uint64_t>(data + i * 8));
+    }
+  }
+
+  std::array<uint64_t, 4> Lanes = { Prime1 + Prime2, Prime2, 0, 0 - Prime1 };
+  std::array<unsigned char, StripeSize> Buffer{};
+  std::size_t BufferSize = 0;
+  uint64_t TotalSize = 0;
+};
+
+//----------------------------------------------------------------------------
+// Metadata identifying a version of a file, a file is read again if any of it changes
+struct FileStamp
+{
+  uint64_t Size = 0;
+  int64_t ModificationTime = 0;
+  uint64_t Device = 0;
+  uint64_t Identifier = 0;
+
+  bool operator==(const FileStamp&) const = default;
+};
+
+//----------------------------------------------------------------------------
+bool GetFileStamp(const std::string& path, FileStamp& stamp)
+{
+  std::error_code ec;
+#ifdef _WIN32
+  const std::filesystem::path fsPath = vtksys::Encoding::ToWide(path);
+#else
+  const std::filesystem::path fsPath = path;
+#endif
+  stamp.Size = std::filesystem::file_size(fsPath, ec);
+  if (ec)
+  {
+    return false;
+  }
+  stamp.ModificationTime = std::filesystem::last_write_time(fsPath, ec).time_since_epoch().count();
+  if (ec)
+  {
+    return false;
+  }
+
+#ifdef _WIN32
+  HANDLE file = CreateFileW(fsPath.c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    return false;
+  }
+  BY_HANDLE_FILE_INFORMATION info;
+  const bool valid = GetFileInformationByHandle(file, &info);
+  CloseHandle(file);
+  if (!valid)
+  {
+    return false;
+  }
+  stamp.Device = info.dwVolumeSerialNumber;
+  stamp.Identifier = (static_cast<uint64_t>(info.nFileIndexHigh) << 32) | info.nFileIndexLow;
+#else
+  struct stat info;
+  if (stat(path.c_str(), &info) != 0)
+  {
+    return false;
+  }
+  stamp.Device = static_cast<uint64_t>(info.st_dev);
+  stamp.Identifier = static_cast<uint64_t>(info.st_ino);
+#endif
+  return true;
+}
+
+//----------------------------------------------------------------------------
+std::string ComputeContentHash(const std::string& path)
+{
+  vtksys::ifstream file(path.c_str(), std::ios_base::binary);
+  if (!file.is_open())
+  {
+    return {};
+  }
+
+  ::Hasher hasher;
+  std::vector<char> buffer(1 << 20);
+  while (file)
+  {
+    file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    const std::streamsize count = file.gcount();
+    if (count > 0)
+    {
+      hasher.Append(
+        reinterpret_cast<const unsigned char*>(buffer.data()), static_cast<std::size_t>(count));
+    }
+  }
+  if (file.bad())
+  {
+    return {};
+  }
+  return hasher.Finalize();
+}
+
+//----------------------------------------------------------------------------
+// Memoized hashes of the current process, keyed on the full path of the files
+struct MemoizedHash
+{
+  FileStamp Stamp;
+  std::string Hash;
+};
+std::mutex MemoizedHashesMutex;
+std::map<std::string, MemoizedHash> MemoizedHashes;
+
+//----------------------------------------------------------------------------
+bool ReadMemoizedHash(const std::string& memoPath, const FileStamp& stamp, std::string& hash)
+{
+  vtksys::ifstream file(memoPath.c_str());
+  FileStamp memoStamp;
+  std::string memoHash;
+  if (!(file >> memoStamp.Size >> memoStamp.ModificationTime >> memoStamp.Device >>
+        memoStamp.Identifier >> memoHash) ||
+    !(memoStamp == stamp))
+  {
+    return false;
+  }
+  hash = memoHash;
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void WriteMemoizedHash(const std::string& memoPath, const FileStamp& stamp, const std::string& hash)
+{
+  // Write to a temporary file first so that concurrent processes never read a partial file
+  const std::string tmpPath = memoPath + ".tmp";
+  bool success = false;
+  {
+    vtksys::ofstream file(tmpPath.c_str(), std::ios_base::trunc);
+    file << stamp.Size << ' ' << stamp.ModificationTime << ' ' << stamp.Device << ' '
+         << stamp.Identifier << ' ' << hash << '\n';
+    success = file.good();
+  }
+  if (!success || !vtksys::SystemTools::RenameFile(tmpPath, memoPath).IsSuccess())
+  {
+    vtksys::SystemTools::RemoveFile(tmpPath);
+  }
+}
+}
+
+//----------------------------------------------------------------------------
+std::string F3DCacheKey::ComputeStringHash(const std::string& str)
+{
+  ::Hasher hasher;
+  hasher.Append(reinterpret_cast<const unsigned char*>(str.data()), str.size());
+  return hasher.Finalize();
+}
+
+//----------------------------------------------------------------------------
+std::string F3DCacheKey::ComputeFileHash(const std::string& path, const std::string& cacheDir)
+{
+  const std::string fullPath = vtksys::SystemTools::CollapseFullPath(path);
+
+  ::FileStamp stamp;
+  if (!::GetFileStamp(fullPath, stamp))
+  {
+    return {};
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(::MemoizedHashesMutex);
+    auto it = ::MemoizedHashes.find(fullPath);
+    if (it != ::MemoizedHashes.end() && it->second.Stamp == stamp)
+    {
+      return it->second.Hash;
+    }
+  }
+
+  std::string memoPath;
+  if (!cacheDir.empty())
+  {
+    const std::string memoDir = cacheDir + "/hashes";
+    if (vtksys::SystemTools::MakeDirectory(memoDir))
+    {
+      memoPath = memoDir + "/" + F3DCacheKey::ComputeStringHash(fullPath);
+    }
+  }
+
+  std::string hash;
+  if (memoPath.empty() || !::ReadMemoizedHash(memoPath, stamp, hash))
+  {
+    hash = ::ComputeContentHash(fullPath);
+    if (hash.empty())
+    {
+      return {};
+    }
+    if (!memoPath.empty())
+    {
+      ::WriteMemoizedHash(memoPath, stamp, hash);
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(::MemoizedHashesMutex);
+  ::MemoizedHashes[fullPath] = { stamp, hash };
+  return hash;
+}
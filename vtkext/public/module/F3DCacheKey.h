@@ -0,0 +1,40 @@
+/**
+ * @class   F3DCacheKey
+ * @brief   Compute content hashes used as cache keys
+ *
+ * Compute fast, non cryptographic, 64 bits hashes of strings and file contents,
+ * formatted as 16 hexadecimal characters, to be used as keys of on-disk caches.
+ * Files are read in chunks so that their size does not matter.
+ *
+ * File hashes are memoized, in memory and optionally in a cache directory, keyed on the path,
+ * size, modification time and identifier (inode) of the file, so that the content of
+ * an unchanged file is not read again to compute its key.
+ */
+
+#ifndef F3DCacheKey_h
+#define F3DCacheKey_h
+
+#include "vtkextModule.h"
+
+/// @cond
+#include <string>
+/// @endcond
+
+class VTKEXT_EXPORT F3DCacheKey
+{
+public:
+  /**
+   * Compute the hash of the provided string
+   */
+  static std::string ComputeStringHash(const std::string& str);
+
+  /**
+   * Compute the hash of the content of the provided file.
+   * If cacheDir is not empty, the result is also memoized in a "hashes" subdirectory of it
+   * so that it is reused across processes.
+   * Return an empty string if the file cannot be read.
+   */
+  static std::string ComputeFileHash(const std::string& path, const std::string& cacheDir = {});
+};
+
+#endif
@@ -0,0 +1,124 @@
+#include "F3DMemoryMappedFile.h"
+
+#include <vtksys/Encoding.hxx>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//----------------------------------------------------------------------------
+F3DMemoryMappedFile::~F3DMemoryMappedFile()
+{
+  this->Close();
+}
+
+//----------------------------------------------------------------------------
+bool F3DMemoryMappedFile::Open(const std::string& path)
+{
+  this->Close();
+
+#ifdef _WIN32
+  HANDLE file = CreateFileW(vtksys::Encoding::ToWide(path).c_str(), GENERIC_READ,
+    FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    return false;
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size))
+  {
+    CloseHandle(file);
+    return false;
+  }
+
+  this->FileHandle = file;
+  if (size.QuadPart == 0)
+  {
+    return true;
+  }
+
+  HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mapping)
+  {
+    this->Close();
+    return false;
+  }
+  this->MappingHandle = mapping;
+
+  void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!data)
+  {
+    this->Close();
+    return false;
+  }
+  this->Data = static_cast<const std::byte*>(data);
+  this->Size = static_cast<std::size_t>(size.QuadPart);
+#else
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    return false;
+  }
+
+  struct stat info;
+  if (::fstat(fd, &info) != 0)
+  {
+    ::close(fd);
+    return false;
+  }
+
+  if (info.st_size > 0)
+  {
+    void* data = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED)
+    {
+      ::close(fd);
+      return false;
+    }
+#if !defined(__EMSCRIPTEN__)
+    // Content is usually consumed from the beginning to the end
+    ::madvise(data, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+#endif
+    this->Data = static_cast<const std::byte*>(data);
+    this->Size = static_cast<std::size_t>(info.st_size);
+  }
+
+  // The mapping stays valid after closing the file descriptor
+  ::close(fd);
+#endif
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void F3DMemoryMappedFile::Close()
+{
+#ifdef _WIN32
+  if (this->Data)
+  {
+    UnmapViewOfFile(this->Data);
+  }
+  if (this->MappingHandle)
+  {
+    CloseHandle(this->MappingHandle);
+    this->MappingHandle = nullptr;
+  }
+  if (this->FileHandle)
+  {
+    CloseHandle(this->FileHandle);
+    this->FileHandle = nullptr;
+  }
+#else
+  if (this->Data)
+  {
+    ::munmap(const_cast<std::byte*>(this->Data), this->Size);
+  }
+#endif
+  this->Data = nullptr;
+  this->Size = 0;
+}
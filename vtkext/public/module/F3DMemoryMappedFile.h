@@ -0,0 +1,66 @@
+/**
+ * @class   F3DMemoryMappedFile
+ * @brief   A read-only memory mapping of a file
+ *
+ * Map a whole file in memory in read-only mode, using mmap on POSIX platforms and
+ * file mappings on Windows. The mapping is released on destruction.
+ * Any pointer returned by GetData is only valid while the mapping is alive.
+ */
+
+#ifndef F3DMemoryMappedFile_h
+#define F3DMemoryMappedFile_h
+
+#include "vtkextModule.h"
+
+/// @cond
+#include <cstddef>
+#include <string>
+/// @endcond
+
+class VTKEXT_EXPORT F3DMemoryMappedFile
+{
+public:
+  F3DMemoryMappedFile() = default;
+  ~F3DMemoryMappedFile();
+
+  F3DMemoryMappedFile(const F3DMemoryMappedFile&) = delete;
+  F3DMemoryMappedFile& operator=(const F3DMemoryMappedFile&) = delete;
+
+  /**
+   * Map the provided file, releasing any previous mapping.
+   * Return true on success, false otherwise.
+   * An empty file is mapped successfully, with a null data pointer.
+   */
+  bool Open(const std::string& path);
+
+  /**
+   * Release the mapping, if any
+   */
+  void Close();
+
+  /**
+   * Get a pointer to the mapped content, nullptr if nothing is mapped
+   */
+  const std::byte* GetData() const
+  {
+    return this->Data;
+  }
+
+  /**
+   * Get the size of the mapped content in bytes
+   */
+  std::size_t GetSize() const
+  {
+    return this->Size;
+  }
+
+private:
+  const std::byte* Data = nullptr;
+  std::size_t Size = 0;
+#ifdef _WIN32
+  void* FileHandle = nullptr;
+  void* MappingHandle = nullptr;
+#endif
+};
+
+#endif
@@ -0,0 +1,234 @@
+#include "F3DTrace.h"
+
+#include <vtkObject.h>
+#include <vtkSetGet.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+struct TraceEvent
+{
+  std::string Name;
+  std::string Detail;
+  int ThreadId;
+  Clock::time_point Begin;
+  Clock::time_point End;
+};
+
+/**
+ * Global state of the trace, the trace is written at exit if still recording
+ */
+struct TraceState
+{
+  std::atomic<bool> Enabled = false;
+  std::mutex Mutex;
+  std::string Path;
+  Clock::time_point Origin;
+  std::vector<TraceEvent> Events;
+  std::map<int, std::string> ThreadNames;
+
+  ~TraceState()
+  {
+    if (this->Enabled.exchange(false))
+    {
+      this->Write();
+    }
+  }
+
+  bool Write();
+};
+
+TraceState& GetState()
+{
+  static TraceState state;
+  return state;
+}
+
+// small sequential ids are easier to read in the trace viewers than native thread ids
+int GetThreadId()
+{
+  static std::atomic<int> counter = 0;
+  thread_local const int id = ++counter;
+  return id;
+}
+
+std::string EscapeJSON(const std::string& str)
+{
+  std::string escaped;
+  escaped.reserve(str.size());
+  for (char c : str)
+  {
+    switch (c)
+    {
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      case '\t':
+        escaped += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20)
+        {
+          char buffer[8];
+          std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+          escaped += buffer;
+        }
+        else
+        {
+          escaped += c;
+        }
+    }
+  }
+  return escaped;
+}
+
+double ToMicroseconds(Clock::duration duration)
+{
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+//----------------------------------------------------------------------------
+bool TraceState::Write()
+{
+  const std::lock_guard<std::mutex> lock(this->Mutex);
+
+  std::ofstream file(this->Path);
+  if (!file.is_open())
+  {
+    vtkWarningWithObjectMacro(nullptr, "Could not write the trace file: " << this->Path);
+    return false;
+  }
+
+  file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+  for (const auto& [threadId, name] : this->ThreadNames)
+  {
+    file << (first ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+         << threadId << ",\"args\":{\"name\":\"" << ::EscapeJSON(name) << "\"}}";
+    first = false;
+  }
+
+  // fixed notation with a sub microsecond precision for the timestamps
+  file.setf(std::ios::fixed);
+  file.precision(3);
+  for (const TraceEvent& event : this->Events)
+  {
+    file << (first ? "\n" : ",\n") << "{\"name\":\"" << ::EscapeJSON(event.Name)
+         << "\",\"cat\":\"f3d\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.ThreadId
+         << ",\"ts\":" << ::ToMicroseconds(event.Begin - this->Origin)
+         << ",\"dur\":" << ::ToMicroseconds(event.End - event.Begin);
+    if (!event.Detail.empty())
+    {
+      file << ",\"args\":{\"detail\":\"" << ::EscapeJSON(event.Detail) << "\"}";
+    }
+    file << "}";
+    first = false;
+  }
+  file << "\n]}\n";
+
+  this->Events.clear();
+  return file.good();
+}
+
+// start tracing as soon as the library is loaded so that plugin loading is traced too
+[[maybe_unused]] const bool StartedFromEnvironment = []()
+{
+  const char* path = std::getenv("F3D_TRACE_FILE");
+  if (path && *path)
+  {
+    F3DTrace::Start(path);
+    return true;
+  }
+  return false;
+}();
+}
+
+//----------------------------------------------------------------------------
+void F3DTrace::Start(const std::string& path)
+{
+  TraceState& state = ::GetState();
+  {
+    const std::lock_guard<std::mutex> lock(state.Mutex);
+    state.Path = path;
+    state.Origin = Clock::now();
+    state.Events.clear();
+    state.ThreadNames.try_emplace(::GetThreadId(), "main");
+  }
+  state.Enabled = true;
+}
+
+//----------------------------------------------------------------------------
+bool F3DTrace::Stop()
+{
+  TraceState& state = ::GetState();
+  if (!state.Enabled.exchange(false))
+  {
+    return true;
+  }
+
+  return state.Write();
+}
+
+//----------------------------------------------------------------------------
+bool F3DTrace::IsEnabled()
+{
+  return ::GetState().Enabled.load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------
+void F3DTrace::SetThreadName(const std::string& name)
+{
+  TraceState& state = ::GetState();
+  const std::lock_guard<std::mutex> lock(state.Mutex);
+  state.ThreadNames[::GetThreadId()] = name;
+}
+
+//----------------------------------------------------------------------------
+void F3DTrace::AddEvent(const std::string& name, const std::string& detail,
+  Clock::time_point begin, Clock::time_point end)
+{
+  TraceState& state = ::GetState();
+  if (!state.Enabled.load(std::memory_order_relaxed))
+  {
+    return;
+  }
+
+  const int threadId = ::GetThreadId();
+  const std::lock_guard<std::mutex> lock(state.Mutex);
+  state.Events.emplace_back(TraceEvent{ name, detail, threadId, begin, end });
+}
+
+//----------------------------------------------------------------------------
+F3DTrace::Scope::Scope(const char* name)
+  : Name(name)
+  , Active(F3DTrace::IsEnabled())
+{
+  if (this->Active)
+  {
+    this->Begin = Clock::now();
+  }
+}
+
+//----------------------------------------------------------------------------
+F3DTrace::Scope::~Scope()
+{
+  if (this->Active)
+  {
+    F3DTrace::AddEvent(this->Name, this->Detail, this->Begin, Clock::now());
+  }
+}
@@ -0,0 +1,121 @@
+/**
+ * @class   F3DTrace
+ * @brief   Scoped trace events written as a Chrome trace
+ *
+ * Record scoped events of the loading and rendering pipeline and write them
+ * as a Chrome `trace_event` JSON file, that can be opened in `chrome://tracing`
+ * or in the Perfetto UI. Each event is recorded with the thread it ran on
+ * and an optional detail, usually the file or actor it belongs to.
+ *
+ * Tracing is started automatically when the `F3D_TRACE_FILE` environment variable
+ * is set, and the trace is written when tracing is stopped or at exit.
+ * When tracing is not enabled, a scope only costs a check of a flag,
+ * its detail is not even computed.
+ *
+ * Use the F3D_TRACE_SCOPE and F3D_TRACE_SCOPE_DETAIL macros to record events.
+ */
+
+#ifndef F3DTrace_h
+#define F3DTrace_h
+
+#include "vtkextModule.h"
+
+/// @cond
+#include <chrono>
+#include <string>
+/// @endcond
+
+class VTKEXT_EXPORT F3DTrace
+{
+public:
+  /**
+   * Start recording events that will be written in the provided file.
+   * Previously recorded events are discarded.
+   */
+  static void Start(const std::string& path);
+
+  /**
+   * Stop recording events and write the trace file.
+   * Return true on success or if tracing was not started, false otherwise.
+   */
+  static bool Stop();
+
+  /**
+   * Return true if events are being recorded
+   */
+  static bool IsEnabled();
+
+  /**
+   * Name the calling thread in the trace.
+   * The thread that started tracing is named "main" if not named.
+   */
+  static void SetThreadName(const std::string& name);
+
+  /**
+   * Record an event that happened on the calling thread between begin and end
+   */
+  static void AddEvent(const std::string& name, const std::string& detail,
+    std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end);
+
+  /**
+   * Record an event lasting for the lifetime of the scope.
+   * The detail function is only called if tracing is enabled.
+   */
+  class VTKEXT_EXPORT Scope
+  {
+  public:
+    explicit Scope(const char* name);
+
+    template<typename F>
+    Scope(const char* name, F&& detail)
+      : Scope(name)
+    {
+      if (this->Active)
+      {
+        this->Detail = detail();
+      }
+    }
+
+    ~Scope();
+
+    /**
+     * Set the detail of the event once known.
+     * The detail function is only called if tracing is enabled.
+     */
+    template<typename F>
+    void SetDetail(F&& detail)
+    {
+      if (this->Active)
+      {
+        this->Detail = detail();
+      }
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+  private:
+    const char* Name;
+    bool Active;
+    std::string Detail;
+    std::chrono::steady_clock::time_point Begin;
+  };
+};
+
+#define F3D_TRACE_CONCAT_IMPL(a, b) a##b
+#define F3D_TRACE_CONCAT(a, b) F3D_TRACE_CONCAT_IMPL(a, b)
+
+/**
+ * Record an event named `name` lasting until the end of the current scope.
+ */
+#define F3D_TRACE_SCOPE(name) F3DTrace::Scope F3D_TRACE_CONCAT(f3dTraceScope, __LINE__)(name)
+
+/**
+ * Record an event named `name` with a detail lasting until the end of the current scope.
+ * `detail` must be convertible to a std::string and is only evaluated when tracing is enabled.
+ */
+#define F3D_TRACE_SCOPE_DETAIL(name, detail)                                                       \
+  F3DTrace::Scope F3D_TRACE_CONCAT(f3dTraceScope, __LINE__)(                                       \
+    name, [&]() { return std::string(detail); })
+
+#endif
@@ -0,0 +1,72 @@
+#include "F3DCacheKey.h"
+
+#include <vtksys/SystemTools.hxx>
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+int TestF3DCacheKey(int argc, char* argv[])
+{
+  // Reference XXH64 values
+  if (F3DCacheKey::ComputeStringHash("") != "ef46db3751d8e999" ||
+    F3DCacheKey::ComputeStringHash("abc") != "44bc2cf5ad770999")
+  {
+    std::cerr << "Unexpected string hash\n";
+    return EXIT_FAILURE;
+  }
+
+  // Larger than a read chunk, and not a multiple of the hash stripes
+  std::string content;
+  for (int i = 0; i < (1 << 20) + 77; i++)
+  {
+    content += static_cast<char>(i * 7);
+  }
+
+  const std::string path = std::string(argv[2]) + "TestF3DCacheKey.bin";
+  const std::string cacheDir = std::string(argv[2]) + "TestF3DCacheKeyCache";
+  vtksys::SystemTools::RemoveADirectory(cacheDir);
+  {
+    std::ofstream file(path, std::ios_base::binary | std::ios_base::trunc);
+    file << content;
+  }
+
+  const std::string hash = F3DCacheKey::ComputeFileHash(path, cacheDir);
+  if (hash != F3DCacheKey::ComputeStringHash(content))
+  {
+    std::cerr << "File hash does not match the hash of its content: " << hash << "\n";
+    return EXIT_FAILURE;
+  }
+
+  if (!vtksys::SystemTools::FileIsDirectory(cacheDir + "/hashes"))
+  {
+    std::cerr << "File hash has not been memoized in the cache directory\n";
+    return EXIT_FAILURE;
+  }
+
+  if (F3DCacheKey::ComputeFileHash(path, cacheDir) != hash)
+  {
+    std::cerr << "Memoized file hash is different\n";
+    return EXIT_FAILURE;
+  }
+
+  // A modified file must be hashed again
+  {
+    std::ofstream file(path, std::ios_base::binary | std::ios_base::app);
+    file << "modified";
+  }
+  if (F3DCacheKey::ComputeFileHash(path, cacheDir) !=
+    F3DCacheKey::ComputeStringHash(content + "modified"))
+  {
+    std::cerr << "Hash of a modified file has not been updated\n";
+    return EXIT_FAILURE;
+  }
+
+  if (!F3DCacheKey::ComputeFileHash(path + ".missing").empty())
+  {
+    std::cerr << "Hash of a missing file is not empty\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,145 @@
+#include "vtkF3DFaceVaryingPointDispatcher.h"
+
+#include <vtkCellArray.h>
+#include <vtkFloatArray.h>
+#include <vtkIdTypeArray.h>
+#include <vtkInformation.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+
+#include <iostream>
+
+namespace
+{
+// Check that every corner of the output has the same values as the corner of the input
+bool CheckCorners(vtkPolyData* input, vtkPolyData* output)
+{
+  vtkCellArray* inputPolys = input->GetPolys();
+  vtkCellArray* outputPolys = output->GetPolys();
+  if (inputPolys->GetNumberOfCells() != outputPolys->GetNumberOfCells())
+  {
+    return false;
+  }
+
+  vtkDataArray* inputUV = input->GetPointData()->GetArray("UV");
+  vtkDataArray* inputTemperature = input->GetPointData()->GetArray("Temperature");
+  vtkDataArray* outputUV = output->GetPointData()->GetArray("UV");
+  vtkDataArray* outputTemperature = output->GetPointData()->GetArray("Temperature");
+  vtkIdTypeArray* sourceIds =
+    vtkIdTypeArray::SafeDownCast(output->GetPointData()->GetArray("SourceIds"));
+  if (!outputUV || !outputTemperature || !sourceIds ||
+    outputUV->GetNumberOfTuples() != output->GetNumberOfPoints() ||
+    sourceIds->GetNumberOfTuples() != output->GetNumberOfPoints())
+  {
+    return false;
+  }
+
+  vtkIdType corner = 0;
+  for (vtkIdType i = 0; i < inputPolys->GetNumberOfCells(); i++)
+  {
+    vtkIdType inputSize, outputSize;
+    const vtkIdType* inputIds;
+    const vtkIdType* outputIds;
+    inputPolys->GetCellAtId(i, inputSize, inputIds);
+    outputPolys->GetCellAtId(i, outputSize, outputIds);
+    if (inputSize != outputSize)
+    {
+      return false;
+    }
+
+    for (vtkIdType j = 0; j < inputSize; j++, corner++)
+    {
+      double inputPoint[3], outputPoint[3];
+      input->GetPoint(inputIds[j], inputPoint);
+      output->GetPoint(outputIds[j], outputPoint);
+      if (inputPoint[0] != outputPoint[0] || inputPoint[1] != outputPoint[1] ||
+        inputPoint[2] != outputPoint[2] || sourceIds->GetValue(outputIds[j]) != inputIds[j] ||
+        inputTemperature->GetComponent(inputIds[j], 0) !=
+          outputTemperature->GetComponent(outputIds[j], 0) ||
+        inputUV->GetComponent(corner, 0) != outputUV->GetComponent(outputIds[j], 0) ||
+        inputUV->GetComponent(corner, 1) != outputUV->GetComponent(outputIds[j], 1))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestF3DFaceVaryingPointDispatcher(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
+{
+  // Two adjacent quads sharing the edge 1-4
+  vtkNew<vtkPoints> points;
+  for (int y = 0; y < 2; y++)
+  {
+    for (int x = 0; x < 3; x++)
+    {
+      points->InsertNextPoint(x, y, 0);
+    }
+  }
+
+  vtkNew<vtkCellArray> polys;
+  const vtkIdType quad0[4] = { 0, 1, 4, 3 };
+  const vtkIdType quad1[4] = { 1, 2, 5, 4 };
+  polys->InsertNextCell(4, quad0);
+  polys->InsertNextCell(4, quad1);
+
+  vtkNew<vtkFloatArray> temperature;
+  temperature->SetName("Temperature");
+  for (int i = 0; i < 6; i++)
+  {
+    temperature->InsertNextValue(static_cast<float>(i) * 10.f);
+  }
+
+  // UVs are continuous on the shared edge, except on point 4 which is a seam
+  vtkNew<vtkFloatArray> uv;
+  uv->SetName("UV");
+  uv->SetNumberOfComponents(2);
+  const float uvs[8][2] = { { 0, 0 }, { 0.5, 0 }, { 0.5, 1 }, { 0, 1 }, { 0.5, 0 }, { 1, 0 },
+    { 1, 1 }, { 0.6f, 1 } };
+  for (const auto& value : uvs)
+  {
+    uv->InsertNextTuple2(value[0], value[1]);
+  }
+  uv->GetInformation()->Set(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE(), 1);
+
+  vtkNew<vtkPolyData> polydata;
+  polydata->SetPoints(points);
+  polydata->SetPolys(polys);
+  polydata->GetPointData()->AddArray(temperature);
+  polydata->GetPointData()->SetTCoords(uv);
+
+  vtkNew<vtkF3DFaceVaryingPointDispatcher> dispatcher;
+  dispatcher->SetInputData(polydata);
+  dispatcher->Update();
+  vtkPolyData* output = dispatcher->GetOutput();
+
+  if (output->GetNumberOfPoints() != 8 || !::CheckCorners(polydata, output))
+  {
+    std::cerr << "Unexpected output without merging corners\n";
+    return EXIT_FAILURE;
+  }
+
+  dispatcher->MergeCornersOn();
+  dispatcher->Update();
+  output = dispatcher->GetOutput();
+
+  // only point 1 is merged, point 4 has different UVs
+  if (output->GetNumberOfPoints() != 7 || !::CheckCorners(polydata, output))
+  {
+    std::cerr << "Unexpected output when merging corners: " << output->GetNumberOfPoints()
+              << " points\n";
+    return EXIT_FAILURE;
+  }
+
+  if (output->GetPointData()->GetTCoords() != output->GetPointData()->GetArray("UV"))
+  {
+    std::cerr << "Active texture coordinates have not been kept\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,78 @@
+#include "F3DTrace.h"
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+int TestF3DTrace(int argc, char* argv[])
+{
+  const std::string path = std::string(argv[2]) + "TestF3DTrace.json";
+
+  // Tracing may have been started from the environment
+  F3DTrace::Stop();
+
+  bool detailEvaluated = false;
+  {
+    F3D_TRACE_SCOPE_DETAIL("Disabled", (detailEvaluated = true, "detail"));
+  }
+  if (detailEvaluated)
+  {
+    std::cerr << "Trace detail evaluated while tracing is disabled\n";
+    return EXIT_FAILURE;
+  }
+
+  F3DTrace::Start(path);
+  if (!F3DTrace::IsEnabled())
+  {
+    std::cerr << "Tracing is not enabled after start\n";
+    return EXIT_FAILURE;
+  }
+
+  {
+    F3D_TRACE_SCOPE_DETAIL("Outer", "file \"with\" quotes.obj");
+    F3D_TRACE_SCOPE("Inner");
+  }
+
+  std::thread worker(
+    []()
+    {
+      F3DTrace::SetThreadName("worker");
+      F3D_TRACE_SCOPE("Threaded");
+    });
+  worker.join();
+
+  if (!F3DTrace::Stop() || F3DTrace::IsEnabled())
+  {
+    std::cerr << "Could not stop tracing\n";
+    return EXIT_FAILURE;
+  }
+
+  {
+    F3D_TRACE_SCOPE("After stop");
+  }
+
+  std::ifstream file(path);
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  const std::string trace = buffer.str();
+
+  for (const char* expected : { "\"traceEvents\"", "\"name\":\"Outer\"", "\"name\":\"Inner\"",
+         "\"name\":\"Threaded\"", "\"name\":\"worker\"", "\"name\":\"main\"",
+         "file \\\"with\\\" quotes.obj" })
+  {
+    if (trace.find(expected) == std::string::npos)
+    {
+      std::cerr << "Trace does not contain " << expected << ":\n" << trace << "\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (trace.find("After stop") != std::string::npos)
+  {
+    std::cerr << "Trace contains an event recorded after stop\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
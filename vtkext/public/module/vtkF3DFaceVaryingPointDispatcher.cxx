@@ -1,16 +1,131 @@
 #include "vtkF3DFaceVaryingPointDispatcher.h"
 
-#include "vtkFloatArray.h"
+#include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationIntegerKey.h"
 #include "vtkInformationVector.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <vector>
 
 vtkStandardNewMacro(vtkF3DFaceVaryingPointDispatcher);
 
 vtkInformationKeyMacro(vtkF3DFaceVaryingPointDispatcher, INTERPOLATION_TYPE, Integer);
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Raw bytes of the tuples of a face-varying array, indexed by corner
+struct CornerValues
+{
+  const unsigned char* Data;
+  std::size_t TupleSize;
+
+  const unsigned char* GetTuple(vtkIdType corner) const
+  {
+    return this->Data + corner * this->TupleSize;
+  }
+};
+
+//------------------------------------------------------------------------------
+// Assign to each corner the first corner with the same point and face-varying values
+void ComputeRepresentatives(const vtkIdType* points, const std::vector<CornerValues>& values,
+  std::vector<vtkIdType>& representatives)
+{
+  const vtkIdType nbCorners = static_cast<vtkIdType>(representatives.size());
+
+  // hash each corner in parallel, the point is part of the key
+  std::vector<uint64_t> hashes(nbCorners);
+  vtkSMPTools::For(0, nbCorners,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType c = begin; c < end; c++)
+      {
+        // FNV-1a
+        uint64_t hash = 14695981039346656037ULL ^ static_cast<uint64_t>(points[c]);
+        for (const CornerValues& value : values)
+        {
+          const unsigned char* tuple = value.GetTuple(c);
+          for (std::size_t i = 0; i < value.TupleSize; i++)
+          {
+            hash = (hash ^ tuple[i]) * 1099511628211ULL;
+          }
+        }
+        hashes[c] = hash;
+      }
+    });
+
+  // sort corners so that candidates to merge are contiguous, in corner order
+  std::vector<vtkIdType> order(nbCorners);
+  std::iota(order.begin(), order.end(), 0);
+  vtkSMPTools::Sort(order.begin(), order.end(),
+    [&](vtkIdType a, vtkIdType b)
+    {
+      if (points[a] != points[b])
+      {
+        return points[a] < points[b];
+      }
+      if (hashes[a] != hashes[b])
+      {
+        return hashes[a] < hashes[b];
+      }
+      return a < b;
+    });
+
+  auto isSame = [&](vtkIdType a, vtkIdType b)
+  {
+    for (const CornerValues& value : values)
+    {
+      if (std::memcmp(value.GetTuple(a), value.GetTuple(b), value.TupleSize) != 0)
+      {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  // compare corners within runs of identical keys, hash collisions are handled
+  // by keeping every distinct representative of the run
+  std::vector<vtkIdType> runRepresentatives;
+  for (vtkIdType runBegin = 0; runBegin < nbCorners;)
+  {
+    const vtkIdType first = order[runBegin];
+    vtkIdType runEnd = runBegin + 1;
+    while (runEnd < nbCorners && points[order[runEnd]] == points[first] &&
+      hashes[order[runEnd]] == hashes[first])
+    {
+      runEnd++;
+    }
+
+    runRepresentatives.clear();
+    for (vtkIdType i = runBegin; i < runEnd; i++)
+    {
+      const vtkIdType corner = order[i];
+      representatives[corner] = corner;
+      for (vtkIdType representative : runRepresentatives)
+      {
+        if (isSame(representative, corner))
+        {
+          representatives[corner] = representative;
+          break;
+        }
+      }
+      if (representatives[corner] == corner)
+      {
+        runRepresentatives.emplace_back(corner);
+      }
+    }
+    runBegin = runEnd;
+  }
+}
+}
+
 //------------------------------------------------------------------------------
 vtkF3DFaceVaryingPointDispatcher::vtkF3DFaceVaryingPointDispatcher() = default;
 
@@ -55,21 +170,83 @@ int vtkF3DFaceVaryingPointDispatcher::RequestData(vtkInformation* vtkNotUsed(req
   vtkPoints* inputPoints = input->GetPoints();
   vtkCellArray* inputFaces = input->GetPolys();
 
-  vtkIdType nbCells = inputFaces->GetNumberOfCells();
   vtkIdType nbConnectivity = inputFaces->GetNumberOfConnectivityIds();
 
-  // the number of output points is the number of total cells connectivity
+  // the point of each corner, converted once so that it can be accessed directly
+  vtkNew<vtkIdTypeArray> cornerPoints;
+  cornerPoints->DeepCopy(inputFaces->GetConnectivityArray());
+  const vtkIdType* points = cornerPoints->GetPointer(0);
+
+  // by default, each corner is its own representative and becomes an output point
+  std::vector<vtkIdType> representatives(nbConnectivity);
+  std::iota(representatives.begin(), representatives.end(), 0);
+
+  if (this->MergeCorners)
+  {
+    std::vector<::CornerValues> values;
+    bool canMerge = true;
+    for (vtkIdType i = 0; i < nbArrays; i++)
+    {
+      vtkDataArray* inputArray = inputPointData->GetArray(i);
+      if (inputArray->GetInformation()->Get(
+            vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE()) != 0)
+      {
+        if (!inputArray->HasStandardMemoryLayout() ||
+          inputArray->GetNumberOfTuples() < nbConnectivity)
+        {
+          canMerge = false;
+          break;
+        }
+        values.push_back({ static_cast<const unsigned char*>(inputArray->GetVoidPointer(0)),
+          static_cast<std::size_t>(inputArray->GetNumberOfComponents()) *
+            static_cast<std::size_t>(inputArray->GetDataTypeSize()) });
+      }
+    }
+
+    if (canMerge)
+    {
+      ::ComputeRepresentatives(points, values, representatives);
+    }
+  }
+
+  // number the output points in corner order, which is where the cells reference them first
+  // sourceCorners and sourcePoints give the corner and the input point of each output point
+  vtkNew<vtkIdTypeArray> outputConnectivity;
+  outputConnectivity->SetNumberOfTuples(nbConnectivity);
+  vtkIdType* outputIds = outputConnectivity->GetPointer(0);
+
+  vtkNew<vtkIdList> sourceCorners;
+  vtkNew<vtkIdList> sourcePoints;
+  sourceCorners->Allocate(nbConnectivity);
+  sourcePoints->Allocate(nbConnectivity);
+  for (vtkIdType c = 0; c < nbConnectivity; c++)
+  {
+    if (representatives[c] == c)
+    {
+      outputIds[c] = sourceCorners->GetNumberOfIds();
+      sourceCorners->InsertNextId(c);
+      sourcePoints->InsertNextId(points[c]);
+    }
+    else
+    {
+      // representatives always come first
+      outputIds[c] = outputIds[representatives[c]];
+    }
+  }
+  const vtkIdType nbOutputPoints = sourceCorners->GetNumberOfIds();
+
   vtkNew<vtkPoints> outputPoints;
-  outputPoints->SetNumberOfPoints(nbConnectivity);
+  outputPoints->SetDataType(inputPoints->GetDataType());
+  outputPoints->SetNumberOfPoints(nbOutputPoints);
+  inputPoints->GetData()->GetTuples(sourcePoints, outputPoints->GetData());
 
   vtkPointData* outputPointData = output->GetPointData();
 
-  // all point data attributes are copied so that face-varying attributes are not modified
-  // since the output polydata will have the expected number of points
+  // all point data attributes are copied so that active attributes are kept,
+  // then each array is replaced by its values dispatched to the output points,
+  // gathered from input points for vertex attributes and from corners for face-varying ones
   outputPointData->ShallowCopy(inputPointData);
 
-  // However, for vertex attributes, the arrays must be replaced by dispatching the values
-  // in order to duplicate values and correspond to the new point location
   for (vtkIdType i = 0; i < nbArrays; i++)
   {
     vtkDataArray* inputArray = inputPointData->GetArray(i);
@@ -77,65 +254,34 @@ int vtkF3DFaceVaryingPointDispatcher::RequestData(vtkInformation* vtkNotUsed(req
     vtkInformation* info = inputArray->GetInformation();
     int interpType = info->Get(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE());
 
-    if (interpType == 0) // vertex
+    if (interpType != 0 && nbOutputPoints == nbConnectivity)
     {
-      auto outputArray = vtkSmartPointer<vtkDataArray>::Take(
-        vtkDataArray::CreateDataArray(inputArray->GetDataType()));
-      outputArray->SetNumberOfComponents(inputArray->GetNumberOfComponents());
-      outputArray->SetNumberOfTuples(nbConnectivity);
-      outputArray->SetName(inputArray->GetName());
-
-      outputPointData->AddArray(outputArray);
+      // no corner has been merged, face-varying values are already in place
+      continue;
     }
+
+    auto outputArray = vtkSmartPointer<vtkDataArray>::Take(inputArray->NewInstance());
+    outputArray->SetNumberOfComponents(inputArray->GetNumberOfComponents());
+    outputArray->SetNumberOfTuples(nbOutputPoints);
+    outputArray->SetName(inputArray->GetName());
+    inputArray->GetTuples(interpType == 0 ? sourcePoints : sourceCorners, outputArray);
+
+    outputPointData->AddArray(outputArray);
   }
 
-  vtkNew<vtkCellArray> outputFaces;
   vtkNew<vtkIdTypeArray> sourceIds;
   sourceIds->SetName("SourceIds");
-  sourceIds->SetNumberOfTuples(nbConnectivity);
+  sourceIds->SetNumberOfTuples(nbOutputPoints);
+  std::copy_n(sourcePoints->GetPointer(0), nbOutputPoints, sourceIds->GetPointer(0));
 
   outputPointData->AddArray(sourceIds);
 
-  std::vector<vtkIdType> cell;
-  cell.resize(inputFaces->GetMaxCellSize());
-
-  vtkIdType currentVertexIndex = 0;
-
-  for (vtkIdType i = 0; i < nbCells; i++)
-  {
-    vtkIdType cellSize;
-    const vtkIdType* cellPoints;
-    inputFaces->GetCellAtId(i, cellSize, cellPoints);
-
-    for (vtkIdType j = 0; j < cellSize; j++)
-    {
-      cell[j] = currentVertexIndex + j;
-      outputPoints->SetPoint(currentVertexIndex + j, inputPoints->GetPoint(cellPoints[j]));
-      sourceIds->SetValue(currentVertexIndex + j, cellPoints[j]);
-
-      for (vtkIdType k = 0; k < nbArrays; k++)
-      {
-        vtkDataArray* inputArray = inputPointData->GetArray(k);
-
-        vtkInformation* info = inputArray->GetInformation();
-        int interpType = info->Get(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE());
+  // cells keep their sizes, only the connectivity is remapped
+  vtkNew<vtkIdTypeArray> outputOffsets;
+  outputOffsets->DeepCopy(inputFaces->GetOffsetsArray());
 
-        if (interpType == 0) // vertex
-        {
-          vtkDataArray* outputArray = outputPointData->GetArray(inputArray->GetName());
-
-          if (outputArray)
-          {
-            outputArray->SetTuple(currentVertexIndex + j, inputArray->GetTuple(cellPoints[j]));
-          }
-        }
-      }
-    }
-
-    outputFaces->InsertNextCell(cellSize, cell.data());
-
-    currentVertexIndex += cellSize;
-  }
+  vtkNew<vtkCellArray> outputFaces;
+  outputFaces->SetData(outputOffsets, outputConnectivity);
 
   output->SetPoints(outputPoints);
   output->SetPolys(outputFaces);
@@ -10,6 +10,13 @@
  * For example, if we have two adjacent quads, we will have 6 points and 8 cell indices (4 per
  * quad). Face-varying attributes, even if located on point data will have 8 tuples, and not 6. It
  * can be seen as attributes, but this filter will normalize it by outputting 8 points.
+ *
+ * When MergeCorners is enabled, corners referencing the same point with identical face-varying
+ * values are merged into a single output point, so that the output keeps as many points as needed
+ * only. In the example above, if both quads have the same face-varying values on their shared
+ * edge, 6 points are output.
+ *
+ * In all cases, the "SourceIds" point data array gives the input point of each output point.
  */
 #ifndef vtkF3DFaceVaryingPointDispatcher_h
 #define vtkF3DFaceVaryingPointDispatcher_h
@@ -31,12 +38,29 @@ public:
    */
   static vtkInformationIntegerKey* INTERPOLATION_TYPE();
 
+  ///@{
+  /**
+   * Set/Get whether corners referencing the same point with identical face-varying values
+   * are merged into a single output point.
+   * Corners are compared bitwise, and are never merged if a face-varying array
+   * does not have a standard memory layout.
+   * Should not be enabled if face-varying values of the output are updated afterwards,
+   * as corners merged for some values may differ for others.
+   * Default is false.
+   */
+  vtkSetMacro(MergeCorners, bool);
+  vtkGetMacro(MergeCorners, bool);
+  vtkBooleanMacro(MergeCorners, bool);
+  ///@}
+
 protected:
   vtkF3DFaceVaryingPointDispatcher();
   ~vtkF3DFaceVaryingPointDispatcher() override;
 
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
+  bool MergeCorners = false;
+
 private:
   vtkF3DFaceVaryingPointDispatcher(const vtkF3DFaceVaryingPointDispatcher&) = delete;
   void operator=(const vtkF3DFaceVaryingPointDispatcher&) = delete;
@@ -75,6 +75,17 @@ public:
    */
   void SetFailureStatus();
 
+  ///@{
+  /**
+   * Set/Get if this importer can be updated concurrently with other importers.
+   * Importers are serialized unless their reader declares them thread safe.
+   * Default is false.
+   */
+  vtkSetMacro(ThreadSafe, bool);
+  vtkGetMacro(ThreadSafe, bool);
+  vtkBooleanMacro(ThreadSafe, bool);
+  ///@}
+
 #if VTK_VERSION_NUMBER < VTK_VERSION_CHECK(9, 5, 20250923)
   ///@{
   /**
@@ -94,6 +105,8 @@ public:
 #endif
 
 private:
+  bool ThreadSafe = false;
+
 #if VTK_VERSION_NUMBER < VTK_VERSION_CHECK(9, 5, 20250923)
   char* FileName = nullptr;
   vtkSmartPointer<vtkResourceStream> Stream;
@@ -255,7 +255,8 @@ EMSCRIPTEN_BINDINGS(f3d)
           emscripten::typed_memory_view(totalSize, static_cast<const uint8_t*>(img.getContent())));
       },
       emscripten::allow_raw_pointers())
-    .function("compare", &f3d::image::compare)
+    .function("compare",
+      +[](const f3d::image& img, const f3d::image& reference) { return img.compare(reference); })
     .function(
       "save",
       +[](const f3d::image& img, const std::string& path,